@@ -0,0 +1,97 @@
+/*
+ * CellSpans.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/Polygon.hpp"
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <vector>
+
+// Eigen
+#include <Eigen/Core>
+
+namespace grid_map {
+
+/*!
+ * Run of cells that are contiguous in memory, i.e. cells of one column of the
+ * buffer with consecutive row indices. A span never wraps around the circular buffer.
+ * The cells of a span in layer `data` are `data.col(startIndex(1)).segment(startIndex(0), length)`.
+ */
+struct CellSpan
+{
+  //! Buffer index of the first cell of the span.
+  Index startIndex;
+
+  //! Number of cells in the span.
+  int length;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+using CellSpans = std::vector<CellSpan>;
+
+/*!
+ * Circular region (same cells as the `CircleIterator`).
+ */
+struct CircleRegion
+{
+  Position center;
+  double radius;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/*!
+ * Elliptic region (same cells as the `EllipseIterator`).
+ */
+struct EllipseRegion
+{
+  Position center;
+  //! Lengths of the main axes [m].
+  Length length;
+  //! Rotation of the ellipse [rad].
+  double rotation;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/*!
+ * Axis-aligned rectangular region.
+ */
+struct RectangleRegion
+{
+  Position center;
+  Length length;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/*!
+ * Rasterizes a region into spans of cells of the grid map. A cell is part of the
+ * region if its center lies inside the region, which yields the same cells as the
+ * corresponding iterators (`PolygonIterator`, `CircleIterator`, `EllipseIterator`).
+ * The region is rasterized analytically column by column, i.e. without testing every
+ * cell of the bounding box.
+ * @param gridMap the grid map defining the geometry.
+ * @param region the region to rasterize.
+ * @return the spans of cells covered by the region.
+ */
+CellSpans getCellSpans(const GridMap& gridMap, const Polygon& region);
+CellSpans getCellSpans(const GridMap& gridMap, const CircleRegion& region);
+CellSpans getCellSpans(const GridMap& gridMap, const EllipseRegion& region);
+CellSpans getCellSpans(const GridMap& gridMap, const RectangleRegion& region);
+
+/*!
+ * Returns the number of cells in a list of spans.
+ * @param spans the spans.
+ * @return the number of cells.
+ */
+size_t getNumberOfCells(const CellSpans& spans);
+
+}  // namespace grid_map
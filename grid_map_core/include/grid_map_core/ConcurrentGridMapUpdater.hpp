@@ -0,0 +1,242 @@
+/*
+ * ConcurrentGridMapUpdater.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Eigen
+#include <Eigen/Core>
+
+namespace grid_map {
+
+/*!
+ * Reducer which keeps the maximum of the cell value and the new value (invalid cells are overwritten).
+ */
+struct MaxReducer
+{
+  void operator()(float& cell, float value) const
+  {
+    if (!(cell >= value)) {
+      cell = value;
+    }
+  }
+};
+
+/*!
+ * Reducer which keeps the minimum of the cell value and the new value (invalid cells are overwritten).
+ */
+struct MinReducer
+{
+  void operator()(float& cell, float value) const
+  {
+    if (!(cell <= value)) {
+      cell = value;
+    }
+  }
+};
+
+/*!
+ * Reducer which overwrites the cell value with the new value.
+ */
+struct OverwriteReducer
+{
+  void operator()(float& cell, float value) const { cell = value; }
+};
+
+/*!
+ * Atomically sets the cell to the maximum of its value and `value` (invalid cells are overwritten).
+ * All concurrent writes to the cell have to be atomic as well.
+ * @param cell the cell to update.
+ * @param value the new value.
+ */
+void atomicMax(float& cell, float value);
+
+/*!
+ * Atomically sets the cell to the minimum of its value and `value` (invalid cells are overwritten).
+ * All concurrent writes to the cell have to be atomic as well.
+ * @param cell the cell to update.
+ * @param value the new value.
+ */
+void atomicMin(float& cell, float value);
+
+/*!
+ * Facility to update the layers of a grid map from several threads concurrently.
+ * The buffer of the map is partitioned into tiles, each protected by its own lock. A batch of
+ * points is first sorted by tile and then each tile is locked only once per batch, such that
+ * writers to different parts of the map do not block each other.
+ *
+ * Readers that need a consistent view of a tile lock it with `lockTile()`, or all tiles with `lockAllTiles()`.
+ * The geometry of the map (and its set of layers) must not change while updaters are in use.
+ */
+class ConcurrentGridMapUpdater
+{
+ public:
+  /*!
+   * Constructor.
+   * @param gridMap the grid map to update (has to outlive the updater).
+   * @param tileSize the size of the tiles in cells.
+   */
+  explicit ConcurrentGridMapUpdater(GridMap& gridMap, const Size& tileSize = Size(64, 64));
+
+  /*!
+   * Updates a layer with a batch of points. The cell of each point is updated with
+   * `reducer(float& cell, float value)`, where the value is the z-coordinate of the point.
+   * Points outside of the map are ignored. Can be called from several threads at once.
+   * @param layer the layer to update.
+   * @param points the points (x, y, value) as columns.
+   * @param reducer the reducer, e.g. `MaxReducer`.
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  template <typename Derived, typename Reducer>
+  void update(const std::string& layer, const Eigen::MatrixBase<Derived>& points, const Reducer& reducer);
+
+  /*!
+   * Updates a layer with a batch of points with lock-free atomic minimum/maximum operations
+   * instead of tile locks. Can be called from several threads at once, but not mixed with `update()`
+   * on the same layer.
+   * @param layer the layer to update.
+   * @param points the points (x, y, value) as columns.
+   * @param reduceToMax true for the maximum, false for the minimum.
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  template <typename Derived>
+  void updateAtomic(const std::string& layer, const Eigen::MatrixBase<Derived>& points, bool reduceToMax);
+
+  /*!
+   * Locks a tile for reading or writing it directly.
+   * @param tileIndex the index of the tile.
+   * @return the lock.
+   */
+  std::unique_lock<std::mutex> lockTile(const Index& tileIndex);
+
+  /*!
+   * Locks all tiles (in a fixed order), e.g. to copy the map consistently.
+   * @return the locks.
+   */
+  std::vector<std::unique_lock<std::mutex>> lockAllTiles();
+
+  /*!
+   * Gets the tile containing a cell.
+   * @param bufferIndex the buffer index of the cell.
+   * @return the index of the tile.
+   */
+  Index getTileIndex(const Index& bufferIndex) const;
+
+  /*!
+   * Gets the number of tiles in each dimension.
+   * @return the number of tiles.
+   */
+  const Size& getNumberOfTiles() const;
+
+ private:
+  /*!
+   * Computes the buffer index of the cells of the points and sorts them by tile.
+   * @param[in] points the points.
+   * @param[out] tileOffsets the offsets of the tiles in `cells` and `values` (size number of tiles + 1).
+   * @param[out] cells the linear buffer indices of the cells, sorted by tile.
+   * @param[out] values the values, sorted by tile.
+   */
+  template <typename Derived>
+  void sortByTile(const Eigen::MatrixBase<Derived>& points, std::vector<size_t>& tileOffsets, std::vector<Eigen::Index>& cells,
+                  std::vector<float>& values) const;
+
+  //! Grid map to update.
+  GridMap& gridMap_;
+
+  //! Size of a tile in cells.
+  Size tileSize_;
+
+  //! Number of tiles.
+  Size nTiles_;
+
+  //! Locks of the tiles (in column-major order).
+  std::vector<std::mutex> mutexes_;
+};
+
+template <typename Derived>
+void ConcurrentGridMapUpdater::sortByTile(const Eigen::MatrixBase<Derived>& points, std::vector<size_t>& tileOffsets,
+                                          std::vector<Eigen::Index>& cells, std::vector<float>& values) const
+{
+  static_assert(Derived::RowsAtCompileTime == 3, "The points have to be given as 3 x N matrix.");
+  const Size& size = gridMap_.getSize();
+  const Eigen::Index nPoints = points.cols();
+  std::vector<Eigen::Index> pointCells(nPoints, -1);
+  std::vector<unsigned int> pointTiles(nPoints);
+
+  // Counting sort by tile.
+  tileOffsets.assign(mutexes_.size() + 1, 0);
+  Index index;
+  for (Eigen::Index i = 0; i < nPoints; ++i) {
+    if (!gridMap_.getIndex(Position(points(0, i), points(1, i)), index)) {
+      continue;
+    }
+    pointCells[i] = static_cast<Eigen::Index>(index(1)) * size(0) + index(0);
+    pointTiles[i] = (index(1) / tileSize_(1)) * nTiles_(0) + index(0) / tileSize_(0);
+    ++tileOffsets[pointTiles[i] + 1];
+  }
+  for (size_t tile = 1; tile < tileOffsets.size(); ++tile) {
+    tileOffsets[tile] += tileOffsets[tile - 1];
+  }
+
+  cells.resize(tileOffsets.back());
+  values.resize(tileOffsets.back());
+  std::vector<size_t> next(tileOffsets.begin(), tileOffsets.end() - 1);
+  for (Eigen::Index i = 0; i < nPoints; ++i) {
+    if (pointCells[i] < 0) {
+      continue;
+    }
+    const size_t position = next[pointTiles[i]]++;
+    cells[position] = pointCells[i];
+    values[position] = static_cast<float>(points(2, i));
+  }
+}
+
+template <typename Derived, typename Reducer>
+void ConcurrentGridMapUpdater::update(const std::string& layer, const Eigen::MatrixBase<Derived>& points, const Reducer& reducer)
+{
+  Matrix& data = gridMap_[layer];
+  std::vector<size_t> tileOffsets;
+  std::vector<Eigen::Index> cells;
+  std::vector<float> values;
+  sortByTile(points, tileOffsets, cells, values);
+
+  for (size_t tile = 0; tile < mutexes_.size(); ++tile) {
+    if (tileOffsets[tile] == tileOffsets[tile + 1]) {
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(mutexes_[tile]);
+    for (size_t i = tileOffsets[tile]; i < tileOffsets[tile + 1]; ++i) {
+      reducer(data(cells[i]), values[i]);
+    }
+  }
+}
+
+template <typename Derived>
+void ConcurrentGridMapUpdater::updateAtomic(const std::string& layer, const Eigen::MatrixBase<Derived>& points, const bool reduceToMax)
+{
+  static_assert(Derived::RowsAtCompileTime == 3, "The points have to be given as 3 x N matrix.");
+  Matrix& data = gridMap_[layer];
+  Index index;
+  for (Eigen::Index i = 0; i < points.cols(); ++i) {
+    if (!gridMap_.getIndex(Position(points(0, i), points(1, i)), index)) {
+      continue;
+    }
+    if (reduceToMax) {
+      atomicMax(data(index(0), index(1)), static_cast<float>(points(2, i)));
+    } else {
+      atomicMin(data(index(0), index(1)), static_cast<float>(points(2, i)));
+    }
+  }
+}
+
+}  // namespace grid_map
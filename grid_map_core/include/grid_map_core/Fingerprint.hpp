@@ -0,0 +1,82 @@
+/*
+ * Fingerprint.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <cstdint>
+#include <string>
+
+// Eigen
+#include <Eigen/Core>
+
+namespace grid_map {
+
+/*!
+ * 64 bit fingerprint of the content of a layer (or a region of it), to detect changes cheaply.
+ * Equal content results in equal fingerprints, different content in different fingerprints with
+ * high probability. The values are compared bit-wise (e.g. different NAN payloads differ).
+ */
+using Fingerprint = uint64_t;
+
+/*!
+ * Fingerprints of the tiles of a layer. Tile (i, j) covers the cells with the unwrapped indices
+ * [i * tileSize, (i + 1) * tileSize) x [j * tileSize, (j + 1) * tileSize), tiles at the border
+ * may be smaller.
+ */
+using TileFingerprints = Eigen::Matrix<Fingerprint, Eigen::Dynamic, Eigen::Dynamic>;
+
+/*!
+ * Computes the fingerprint of the data of a layer. The cells are taken in unwrapped order, such
+ * that the fingerprint does not depend on the start index of the circular buffer.
+ * @param data the layer data.
+ * @param bufferStartIndex the start index of the circular buffer.
+ * @return the fingerprint.
+ */
+Fingerprint computeFingerprint(const Matrix& data, const Index& bufferStartIndex = Index::Zero());
+
+/*!
+ * Computes the fingerprint of a layer of a map.
+ * @param gridMap the grid map.
+ * @param layer the layer.
+ * @return the fingerprint.
+ * @throw std::out_of_range if no map layer with name `layer` is present.
+ */
+Fingerprint computeFingerprint(const GridMap& gridMap, const std::string& layer);
+
+/*!
+ * Computes the fingerprints of the tiles of the data of a layer, e.g. to find the changed regions.
+ * With a zero start index, the tiles are in buffer coordinates: when the map is moved, only the
+ * fingerprints of the tiles overlapping the new regions change.
+ * @param data the layer data.
+ * @param bufferStartIndex the start index of the circular buffer.
+ * @param tileSize the number of cells of the tiles per dimension (at least 1).
+ * @return the fingerprints of the tiles.
+ */
+TileFingerprints computeTileFingerprints(const Matrix& data, const Index& bufferStartIndex, int tileSize);
+
+/*!
+ * Computes the fingerprints of the tiles of a layer of a map.
+ * @param gridMap the grid map.
+ * @param layer the layer.
+ * @param tileSize the number of cells of the tiles per dimension (at least 1).
+ * @return the fingerprints of the tiles.
+ * @throw std::out_of_range if no map layer with name `layer` is present.
+ */
+TileFingerprints computeTileFingerprints(const GridMap& gridMap, const std::string& layer, int tileSize);
+
+/*!
+ * Combines two fingerprints, e.g. of several layers, depending on the order.
+ * @param first the first fingerprint.
+ * @param second the second fingerprint.
+ * @return the combined fingerprint.
+ */
+Fingerprint combineFingerprints(Fingerprint first, Fingerprint second);
+
+}  // namespace grid_map
@@ -0,0 +1,247 @@
+/*
+ * ForEachCell.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/TypeDefs.hpp"
+#include "grid_map_core/utils/parallel.hpp"
+
+// STL
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace grid_map {
+
+/*!
+ * Execution policy of `forEachCell(...)`: visits the cells in storage order on the calling thread.
+ */
+struct SerialExecution
+{
+};
+
+/*!
+ * Execution policy of `forEachCell(...)`: visits the cells in storage order on the calling thread,
+ * in blocks of a fixed number of cells. The loop over a full block has a constant trip count, which
+ * allows the compiler to unroll and vectorize it without handling the remainder in every iteration.
+ */
+template <size_t BlockSize = 256>
+struct BlockExecution
+{
+  static_assert(BlockSize > 0, "The block size has to be positive.");
+};
+
+/*!
+ * Execution policy of `forEachCell(...)`: visits contiguous chunks of the cells on several threads
+ * (in blocks, see `BlockExecution`). The function is called concurrently and must therefore only
+ * write to the cells passed to it.
+ */
+struct ParallelExecution
+{
+  explicit ParallelExecution(unsigned int numberOfThreads = 0, size_t minChunkSize = 16384)
+      : numberOfThreads(numberOfThreads),
+        minChunkSize(minChunkSize)
+  {
+  }
+
+  //! Maximum number of threads, 0 for the number of hardware threads.
+  unsigned int numberOfThreads;
+
+  //! Minimum number of cells visited by one thread.
+  size_t minChunkSize;
+};
+
+namespace internal {
+
+//! Compile-time sequence of indices (std::index_sequence is only available from C++14).
+template <size_t... Indices>
+struct IndexSequence
+{
+};
+
+template <size_t N, size_t... Indices>
+struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Indices...>
+{
+};
+
+template <size_t... Indices>
+struct MakeIndexSequence<0, Indices...>
+{
+  using Type = IndexSequence<Indices...>;
+};
+
+//! Argument types of a function object (e.g. a lambda), a function pointer or a function.
+template <typename Function>
+struct FunctionArguments : FunctionArguments<decltype(&Function::operator())>
+{
+};
+
+template <typename Class, typename Result, typename... Arguments>
+struct FunctionArguments<Result (Class::*)(Arguments...) const>
+{
+  using Types = std::tuple<Arguments...>;
+};
+
+template <typename Class, typename Result, typename... Arguments>
+struct FunctionArguments<Result (Class::*)(Arguments...)>
+{
+  using Types = std::tuple<Arguments...>;
+};
+
+template <typename Result, typename... Arguments>
+struct FunctionArguments<Result (*)(Arguments...)>
+{
+  using Types = std::tuple<Arguments...>;
+};
+
+template <typename Result, typename... Arguments>
+struct FunctionArguments<Result(Arguments...)>
+{
+  using Types = std::tuple<Arguments...>;
+};
+
+/*!
+ * Pointer to the data of the layer passed as an argument of the function:
+ * writable for `float&`, read-only for `const float&` and `float`.
+ */
+template <typename Argument>
+struct CellPointer
+{
+  static_assert(std::is_same<typename std::decay<Argument>::type, DataType>::value,
+                "The cell arguments of the function have to be of type float&, const float& or float.");
+  static constexpr bool isWritable =
+      std::is_lvalue_reference<Argument>::value && !std::is_const<typename std::remove_reference<Argument>::type>::value;
+  using Type = typename std::conditional<isWritable, DataType*, const DataType*>::type;
+};
+
+template <typename Map>
+DataType* getLayerData(Map& map, const std::string& layer, DataType* /*tag*/)
+{
+  static_assert(!std::is_const<Map>::value, "Writable cell arguments (float&) require a non-const map.");
+  return map.get(layer).data();
+}
+
+template <typename Map>
+const DataType* getLayerData(Map& map, const std::string& layer, const DataType* /*tag*/)
+{
+  return static_cast<const GridMap&>(map).get(layer).data();
+}
+
+/*!
+ * Resolves the layers of a cell visitor once, with the access (read-only or read-write)
+ * given by the argument types of the function.
+ */
+template <typename Function>
+struct CellVisitor
+{
+  using Arguments = typename FunctionArguments<typename std::decay<Function>::type>::Types;
+  static constexpr size_t nLayers = std::tuple_size<Arguments>::value;
+  using Indices = typename MakeIndexSequence<nLayers>::Type;
+
+  template <typename... CellArguments, typename Map, typename... Layers>
+  static std::tuple<typename CellPointer<CellArguments>::Type...> getPointers(std::tuple<CellArguments...>* /*tag*/, Map& map,
+                                                                              const Layers&... layers)
+  {
+    static_assert(sizeof...(Layers) == nLayers, "The number of layers has to match the number of arguments of the function.");
+    return std::tuple<typename CellPointer<CellArguments>::Type...>(
+        getLayerData(map, layers, static_cast<typename CellPointer<CellArguments>::Type>(nullptr))...);
+  }
+
+  template <typename Map, typename... Layers>
+  static auto getPointers(Map& map, const Layers&... layers) -> decltype(getPointers(static_cast<Arguments*>(nullptr), map, layers...))
+  {
+    return getPointers(static_cast<Arguments*>(nullptr), map, layers...);
+  }
+};
+
+template <typename Function, typename Pointers, size_t... Indices>
+inline void visitCells(Function& function, const Pointers& pointers, const size_t begin, const size_t end,
+                       IndexSequence<Indices...> /*indices*/)
+{
+  for (size_t i = begin; i < end; ++i) {
+    function(std::get<Indices>(pointers)[i]...);
+  }
+}
+
+template <size_t BlockSize, typename Function, typename Pointers, size_t... Indices>
+inline void visitCellsInBlocks(Function& function, const Pointers& pointers, const size_t begin, const size_t end,
+                               IndexSequence<Indices...> indices)
+{
+  size_t i = begin;
+  for (; i + BlockSize <= end; i += BlockSize) {
+    for (size_t j = i; j < i + BlockSize; ++j) {
+      function(std::get<Indices>(pointers)[j]...);
+    }
+  }
+  visitCells(function, pointers, i, end, indices);
+}
+
+template <typename Map>
+using EnableIfGridMap = typename std::enable_if<std::is_base_of<GridMap, typename std::remove_const<Map>::type>::value>::type;
+
+}  // namespace internal
+
+/*!
+ * Calls a function for each cell of the map with the values of several layers, e.g.
+ *
+ *   forEachCell(map, [](float& elevation, const float& variance) { ... }, "elevation", "variance");
+ *
+ * The layers are looked up once and the cells are visited by linear index, which compiles to the
+ * same loop as written by hand over the layer data. The function has one argument per layer:
+ * `float&` for read-write access, `const float&` or `float` for read-only access (only read-only
+ * access is possible on a const map). The cells are visited in storage order, not in the order
+ * of the circular buffer.
+ * @param[in] policy the execution policy (`SerialExecution`, `BlockExecution` or `ParallelExecution`).
+ * @param[in/out] map the grid map.
+ * @param[in] function the function to call for each cell, a lambda or a function (generic lambdas
+ *                     are not supported, as the argument types are deduced from the function).
+ * @param[in] layers the names of the layers, one per argument of the function.
+ * @throw std::out_of_range if a layer does not exist.
+ */
+template <typename Map, typename Function, typename... Layers>
+void forEachCell(const SerialExecution& /*policy*/, Map& map, Function&& function, const Layers&... layers)
+{
+  using Visitor = internal::CellVisitor<Function>;
+  const auto pointers = Visitor::getPointers(map, layers...);
+  internal::visitCells(function, pointers, 0, static_cast<size_t>(map.getSize().prod()), typename Visitor::Indices());
+}
+
+template <size_t BlockSize, typename Map, typename Function, typename... Layers>
+void forEachCell(const BlockExecution<BlockSize>& /*policy*/, Map& map, Function&& function, const Layers&... layers)
+{
+  using Visitor = internal::CellVisitor<Function>;
+  const auto pointers = Visitor::getPointers(map, layers...);
+  internal::visitCellsInBlocks<BlockSize>(function, pointers, 0, static_cast<size_t>(map.getSize().prod()),
+                                          typename Visitor::Indices());
+}
+
+template <typename Map, typename Function, typename... Layers>
+void forEachCell(const ParallelExecution& policy, Map& map, Function&& function, const Layers&... layers)
+{
+  using Visitor = internal::CellVisitor<Function>;
+  const auto pointers = Visitor::getPointers(map, layers...);
+  parallelFor(
+      0, static_cast<size_t>(map.getSize().prod()),
+      [&](const size_t begin, const size_t end) {
+        internal::visitCellsInBlocks<256>(function, pointers, begin, end, typename Visitor::Indices());
+      },
+      policy.numberOfThreads, policy.minChunkSize);
+}
+
+/*!
+ * Calls a function for each cell of the map with the values of several layers, serially.
+ * See `forEachCell(const SerialExecution&, ...)`.
+ */
+template <typename Map, typename Function, typename... Layers, typename = internal::EnableIfGridMap<Map>>
+void forEachCell(Map& map, Function&& function, const Layers&... layers)
+{
+  forEachCell(SerialExecution(), map, std::forward<Function>(function), layers...);
+}
+
+}  // namespace grid_map
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "grid_map_core/BufferRegion.hpp"
+#include "grid_map_core/LayerAllocation.hpp"
+#include "grid_map_core/SparseLayer.hpp"
 #include "grid_map_core/SubmapGeometry.hpp"
 #include "grid_map_core/TypeDefs.hpp"
 
@@ -36,6 +38,10 @@ class SubmapGeometry;
  * - "quality"
  * - "surface_normal_x", "surface_normal_y", "surface_normal_z"
  * etc.
+ *
+ * Layers are dense (a matrix per layer) or sparse (see `addSparse(...)`). Sparse layers are
+ * in-memory only: they are not serialized or converted (e.g. by the ROS message and bag
+ * conversions) and not handled by the functions working on the layer matrices.
  */
 class GridMap {
  public:
@@ -90,13 +96,23 @@ class GridMap {
 
   /*!
    * Add a new data layer (if the layer already exists, overwrite its data, otherwise add layer and data).
+   * The layer is allocated and written according to the allocation options (see `setAllocationOptions()`).
    * @param layer the name of the layer.
    * @param data the data to be added.
    */
   void add(const std::string& layer, const Matrix& data);
 
   /*!
-   * Checks if data layer exists.
+   * Add a new data layer by moving the data (if the layer already exists, its data is replaced).
+   * If the allocation options apply to the layer (see `LayerAllocationOptions::appliesTo()`), the
+   * data is copied as with `add(const std::string&, const Matrix&)` instead.
+   * @param layer the name of the layer.
+   * @param data the data to be added.
+   */
+  void add(const std::string& layer, Matrix&& data);
+
+  /*!
+   * Checks if data layer exists (dense or sparse).
    * @param layer the name of the layer.
    * @return true if layer exists, false otherwise.
    */
@@ -144,11 +160,68 @@ class GridMap {
   bool erase(const std::string& layer);
 
   /*!
-   * Gets the names of the layers.
+   * Gets the names of the layers (without the sparse layers, see `getSparseLayers()`).
    * @return the names of the layers.
    */
   const std::vector<std::string>& getLayers() const;
 
+  /*!
+   * Adds a new empty sparse layer, which only stores the populated cells (see `SparseLayer`).
+   * Sparse layers are read and written with `at(...)` and checked with `isValid(...)` as the dense
+   * layers (reading through a non-const map populates the cells, read through a const map instead),
+   * but are not accessible as matrix with `get(...)` and not part of `getLayers()`.
+   * Sparse layers are in-memory only: consumers working on `getLayers()` skip them (e.g. the ROS
+   * message and bag conversions, the serializable maps, `addDataFrom(...)` with all layers), and
+   * the functions working on the layer matrices (e.g. `computeFingerprint(...)`, `forEachCell(...)`)
+   * throw for them. Use `convertToDense(...)` to export a sparse layer.
+   * A dense layer with the same name is replaced.
+   * @param layer the name of the layer.
+   */
+  void addSparse(const std::string& layer);
+
+  /*!
+   * Checks if a layer is a sparse layer.
+   * @param layer the name of the layer.
+   * @return true if the sparse layer exists.
+   */
+  bool isSparse(const std::string& layer) const;
+
+  /*!
+   * Returns the data of a sparse layer.
+   * @param layer the name of the sparse layer.
+   * @return the sparse layer data.
+   * @throw std::out_of_range if no sparse layer with name `layer` is present.
+   */
+  const SparseLayer& getSparse(const std::string& layer) const;
+
+  /*!
+   * Returns the data of a sparse layer as non-const.
+   * @param layer the name of the sparse layer.
+   * @return the sparse layer data.
+   * @throw std::out_of_range if no sparse layer with name `layer` is present.
+   */
+  SparseLayer& getSparse(const std::string& layer);
+
+  /*!
+   * Gets the names of the sparse layers.
+   * @return the names of the sparse layers.
+   */
+  const std::vector<std::string>& getSparseLayers() const;
+
+  /*!
+   * Converts a dense layer to a sparse layer, the finite cells are populated.
+   * @param layer the name of the layer.
+   * @throw std::out_of_range if no dense layer with name `layer` is present.
+   */
+  void convertToSparse(const std::string& layer);
+
+  /*!
+   * Converts a sparse layer to a dense layer, the unpopulated cells are NAN.
+   * @param layer the name of the layer.
+   * @throw std::out_of_range if no sparse layer with name `layer` is present.
+   */
+  void convertToDense(const std::string& layer);
+
   /*!
    * Set the basic layers that need to be valid for a cell to be considered as valid.
    * Also, the basic layers are set to NAN when clearing the cells with `clearBasic()`.
@@ -169,6 +242,20 @@ class GridMap {
    */
   bool hasBasicLayers() const;
 
+  /*!
+   * Set the options for the allocation and initialization of the layers, e.g. to use
+   * huge pages and parallel first touch for large maps. Applies to layers allocated
+   * or cleared after the call.
+   * @param options the allocation options.
+   */
+  void setAllocationOptions(const LayerAllocationOptions& options);
+
+  /*!
+   * Gets the options for the allocation and initialization of the layers.
+   * @return the allocation options.
+   */
+  const LayerAllocationOptions& getAllocationOptions() const;
+
   /*!
    * Checks if another grid map contains the same layers as this grid map.
    * The other grid map could contain more layers than the checked ones.
@@ -179,7 +266,7 @@ class GridMap {
   bool hasSameLayers(const grid_map::GridMap& other) const;
 
   /*!
-   * Get cell data at requested position.
+   * Get cell data at requested position. For a sparse layer, see `at(...)`.
    * @param layer the name of the layer to be accessed.
    * @param position the requested position.
    * @return the data of the cell.
@@ -199,7 +286,8 @@ class GridMap {
                    InterpolationMethods interpolationMethod = InterpolationMethods::INTER_NEAREST) const;
 
   /*!
-   * Get cell data for requested index.
+   * Get cell data for requested index. For a sparse layer, an unpopulated cell is populated (with NAN),
+   * use the const version to read without populating cells.
    * @param layer the name of the layer to be accessed.
    * @param index the requested index.
    * @return the data of the cell.
@@ -543,6 +631,13 @@ class GridMap {
    */
   bool atPositionBicubicInterpolated(const std::string& layer, const Position& position, float& value) const;
 
+  /*!
+   * Removes a sparse layer (but keeps it in the basic layers).
+   * @param layer the name of the layer.
+   * @return true if the sparse layer existed.
+   */
+  bool eraseSparse(const std::string& layer);
+
   /*!
    * Resize the buffer.
    * @param bufferSize the requested buffer size.
@@ -561,6 +656,12 @@ class GridMap {
   //! Names of the data layers.
   std::vector<std::string> layers_;
 
+  //! Sparse layers.
+  std::unordered_map<std::string, SparseLayer> sparseData_;
+
+  //! Names of the sparse layers.
+  std::vector<std::string> sparseLayers_;
+
   //! List of layers from `data_` that are the basic grid map layers.
   //! This means that for a cell to be valid, all basic layers need to be valid.
   //! Also, the basic layers are set to NAN when clearing the map with `clear()`.
@@ -581,6 +682,9 @@ class GridMap {
   //! Circular buffer start indices.
   Index startIndex_;
 
+  //! Options for the allocation and initialization of the layers.
+  LayerAllocationOptions allocationOptions_;
+
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
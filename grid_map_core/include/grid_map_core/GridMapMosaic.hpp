@@ -0,0 +1,63 @@
+/*
+ * GridMapMosaic.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/GridMap.hpp"
+
+// STL
+#include <string>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Policies to merge the values of overlapping maps. Invalid (non-finite) values are ignored.
+ */
+enum class MosaicPolicy {
+  OVERWRITE_BY_TIMESTAMP, // Value of the map with the latest timestamp.
+  MAX,                    // Maximum value.
+  WEIGHTED_MEAN           // Mean weighted by `MosaicOptions::weightLayer` (or 1).
+};
+
+/*!
+ * Options for `mosaic()`.
+ */
+struct MosaicOptions
+{
+  //! Policy to merge overlapping values.
+  MosaicPolicy policy = MosaicPolicy::OVERWRITE_BY_TIMESTAMP;
+
+  //! Layers of the mosaic, all layers of the maps if empty.
+  std::vector<std::string> layers;
+
+  //! Layer with the weights for `MosaicPolicy::WEIGHTED_MEAN`. If empty or not present in a map,
+  //! the cells of the map are weighted with 1. Cells with invalid or non-positive weight are ignored.
+  std::string weightLayer;
+
+  //! Number of columns of the tiles assigned to the threads.
+  int tileColumns = 64;
+
+  //! Maximum number of threads, 0 for the number of hardware threads.
+  unsigned int numberOfThreads = 0;
+};
+
+/*!
+ * Merges a batch of maps into one map covering all of them.
+ * The geometry of the mosaic (aligned to the cells of the first map) is computed once, then its
+ * columns are split into tiles that are processed in parallel. Each tile merges only the parts
+ * of the maps overlapping it, such that the cost is proportional to the total area of the maps.
+ * The maps need to have the same resolution and frame, and should be aligned to the same grid
+ * (otherwise the cells are assigned to the closest cell of the mosaic).
+ * The timestamp of the mosaic is the latest timestamp of the maps.
+ * @param[in] maps the maps to merge.
+ * @param[out] mosaic the merged map.
+ * @param[in] options the options.
+ * @return false if no maps are given or the maps have different resolutions or frames.
+ */
+bool mosaic(const std::vector<const GridMap*>& maps, GridMap& mosaic, const MosaicOptions& options = MosaicOptions());
+
+}  // namespace grid_map
@@ -0,0 +1,57 @@
+/*
+ * GridMapPoints.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <string>
+#include <vector>
+
+// Eigen
+#include <Eigen/Core>
+
+namespace grid_map {
+
+//! Additional per-point channels in structure of arrays layout (one row per channel).
+using PointChannels = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/*!
+ * Converts the valid cells of a height layer to 3d points (cell center and height), in
+ * the storage order of the map (same order as the `GridMapIterator`).
+ * The cell centers are computed arithmetically per row and column instead of per cell,
+ * and the valid cells are packed in parallel with a prefix sum over chunks of columns.
+ * The results are identical to `GridMap::getPosition3(...)` (converted to float).
+ * @param[in] gridMap the grid map.
+ * @param[in] heightLayer the layer with the heights (z-coordinates). Cells with invalid height are skipped.
+ * @param[in] extraLayers the layers to copy into `channels` for each point (may be invalid).
+ * @param[out] points the points, one per column.
+ * @param[out] channels the values of `extraLayers` for each point, row `i` holds layer `extraLayers[i]`.
+ * @param[in] maskLayer if not empty, only cells that are valid in this layer are converted.
+ * @param[in] numberOfThreads the maximum number of threads, 0 for the number of hardware threads.
+ * @return the number of points.
+ * @throw std::out_of_range if one of the layers is not present.
+ */
+size_t toPoints(const GridMap& gridMap, const std::string& heightLayer, const std::vector<std::string>& extraLayers,
+                Eigen::Matrix3Xf& points, PointChannels& channels, const std::string& maskLayer = "",
+                unsigned int numberOfThreads = 0);
+
+/*!
+ * Converts the valid cells of a height layer to 3d points (see above), without extra channels.
+ * @param[in] gridMap the grid map.
+ * @param[in] heightLayer the layer with the heights (z-coordinates). Cells with invalid height are skipped.
+ * @param[out] points the points, one per column.
+ * @param[in] maskLayer if not empty, only cells that are valid in this layer are converted.
+ * @param[in] numberOfThreads the maximum number of threads, 0 for the number of hardware threads.
+ * @return the number of points.
+ * @throw std::out_of_range if one of the layers is not present.
+ */
+size_t toPoints(const GridMap& gridMap, const std::string& heightLayer, Eigen::Matrix3Xf& points, const std::string& maskLayer = "",
+                unsigned int numberOfThreads = 0);
+
+}  // namespace grid_map
@@ -0,0 +1,70 @@
+/*
+ * LayerAllocation.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <cstddef>
+
+namespace grid_map {
+
+/*!
+ * Options for the allocation and initialization of the layers of large maps.
+ * By default, layers are allocated and initialized as plain Eigen matrices.
+ */
+struct LayerAllocationOptions
+{
+  //! If true, the kernel is advised to back the layer data with transparent huge pages
+  //! (Linux only, `madvise(MADV_HUGEPAGE)`), which reduces TLB misses for large maps.
+  bool transparentHugePages = false;
+
+  //! Number of threads that initialize (first touch) the layer data, 0 for the number of hardware threads.
+  //! With a first-touch NUMA policy, the memory pages are placed on the node of the thread that
+  //! initializes them. The data is split into contiguous chunks of cells in storage order, the same
+  //! partitioning as `parallelFor()` over the linear cell index (e.g. `GridMapRange::split()`).
+  unsigned int firstTouchThreads = 1;
+
+  //! Minimum size of a layer [cells] for which the options are applied.
+  size_t minLayerSize = 1 << 18;
+
+  /*!
+   * Checks if the options change the allocation or initialization of a layer (with respect to
+   * plain Eigen matrices).
+   * @param nCells the size of the layer [cells].
+   * @return true if the options apply to the layer.
+   */
+  bool appliesTo(size_t nCells) const { return (transparentHugePages || firstTouchThreads != 1) && nCells >= minLayerSize; }
+};
+
+/*!
+ * Allocates (resizes) layer data without initializing it, such that the first touch
+ * of the data can be done with `fillLayer()`.
+ * @param[out] data the layer data.
+ * @param[in] size the size of the layer.
+ * @param[in] options the allocation options.
+ */
+void allocateLayer(Matrix& data, const Size& size, const LayerAllocationOptions& options);
+
+/*!
+ * Sets all cells of the layer data to a value (in parallel if requested by the options).
+ * @param[in/out] data the layer data.
+ * @param[in] value the value to set the cells to.
+ * @param[in] options the allocation options.
+ */
+void fillLayer(Matrix& data, float value, const LayerAllocationOptions& options);
+
+/*!
+ * Copies the cells of a layer into layer data of the same size (in parallel if requested by the options),
+ * such that the data allocated with `allocateLayer()` is first touched as with `fillLayer()`.
+ * @param[in/out] data the layer data.
+ * @param[in] source the layer to copy.
+ * @param[in] options the allocation options.
+ */
+void copyLayer(Matrix& data, const Matrix& source, const LayerAllocationOptions& options);
+
+}  // namespace grid_map
@@ -0,0 +1,159 @@
+/*
+ * PreparedPolygon.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/Polygon.hpp"
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <vector>
+
+// Eigen
+#include <Eigen/Core>
+
+namespace grid_map {
+
+/*!
+ * Polygon prepared for fast (batch) point-in-polygon queries.
+ * The edges of the polygon are precomputed once and stored as structure of arrays
+ * (sorted by their lower y-coordinate), such that the crossing test of many points
+ * can be vectorized. Optionally, an index of the edges over horizontal slabs is built,
+ * which limits the test of a point to the edges spanning its y-coordinate. This pays off
+ * for polygons with many vertices.
+ * The results are identical to `Polygon::isInside(...)` (even-odd rule).
+ * Note: The prepared polygon is a snapshot, changes to the original polygon are not reflected.
+ */
+class PreparedPolygon
+{
+ public:
+  using Mask = Eigen::Array<bool, Eigen::Dynamic, 1>;
+
+  /*!
+   * Default constructor (empty polygon, nothing is inside).
+   */
+  PreparedPolygon();
+
+  /*!
+   * Constructor.
+   * @param polygon the polygon to prepare.
+   * @param buildEdgeIndex if true, the slab index of the edges is built.
+   */
+  explicit PreparedPolygon(const Polygon& polygon, bool buildEdgeIndex = false);
+
+  /*!
+   * Check if point is inside polygon.
+   * @param point the point to be checked.
+   * @return true if inside, false otherwise.
+   */
+  bool isInside(const Position& point) const;
+
+  /*!
+   * Check for a batch of points if they are inside the polygon. Large batches
+   * are processed in parallel.
+   * @param[in] points the points to be checked (one point per column).
+   * @param[out] mask true for the points inside the polygon, false otherwise.
+   * @param[in] numberOfThreads the maximum number of threads, 0 for the number of hardware threads.
+   */
+  void isInside(const Eigen::Matrix2Xd& points, Mask& mask, unsigned int numberOfThreads = 0) const;
+
+  /*!
+   * Computes the x-coordinates at which the horizontal line at height `y` crosses the edges
+   * of the polygon, sorted in ascending order. A point (x, y) is inside the polygon if
+   * crossings[2k] <= x < crossings[2k + 1] for some k.
+   * @param[in] y the y-coordinate of the horizontal line.
+   * @param[out] crossings the sorted x-coordinates of the crossings.
+   */
+  void getCrossings(double y, std::vector<double>& crossings) const;
+
+  /*!
+   * Returns the range of y-coordinates covered by the polygon.
+   * @param[out] yMin the lower bound.
+   * @param[out] yMax the upper bound.
+   * @return false if the polygon is empty, true otherwise.
+   */
+  bool getBoundsY(double& yMin, double& yMax) const;
+
+  /*!
+   * Returns the number of (non-horizontal) edges used for the crossing test.
+   * @return the number of edges.
+   */
+  size_t nEdges() const;
+
+  /*!
+   * Checks if the slab index of the edges has been built.
+   * @return true if the edge index is available.
+   */
+  bool hasEdgeIndex() const;
+
+ private:
+  /*!
+   * Builds the slab index of the edges.
+   */
+  void buildEdgeIndex();
+
+  /*!
+   * Checks a contiguous block of points with the vectorized crossing test.
+   * @param[in] points the coordinates of the points (x, y interleaved).
+   * @param[in] nPoints the number of points in the block (at most `kBlockSize`).
+   * @param[out] mask the result for the points of the block.
+   */
+  void isInsideBlock(const double* points, int nPoints, bool* mask) const;
+
+  /*!
+   * Checks a point with the help of the edge index.
+   * @param x the x-coordinate of the point.
+   * @param y the y-coordinate of the point.
+   * @return true if inside, false otherwise.
+   */
+  bool isInsideIndexed(double x, double y) const;
+
+  /*!
+   * Checks a single point against the edges spanning its y-coordinate.
+   * @param x the x-coordinate of the point.
+   * @param y the y-coordinate of the point.
+   * @return true if inside, false otherwise.
+   */
+  bool isInsideScalar(double x, double y) const;
+
+  /*!
+   * Computes the x-coordinate at which an edge crosses the horizontal line at height `y`.
+   * @param e the index of the edge.
+   * @param y the y-coordinate of the horizontal line.
+   * @return the x-coordinate of the crossing.
+   */
+  double getEdgeX(size_t e, double y) const;
+
+  //! Number of points processed together by the vectorized crossing test.
+  static constexpr int kBlockSize = 64;
+
+  //! Minimum number of points per thread for batch queries.
+  static constexpr size_t kMinPointsPerThread = 16384;
+
+  //! Edges as structure of arrays, sorted by `edgeYMin_`.
+  //! An edge is crossed by the horizontal ray of a point at (x, y) if
+  //! edgeYMin_ <= y < edgeYMax_ and x < edgeDx_ * (y - edgeY_) / edgeDy_ + edgeX_.
+  std::vector<double> edgeYMin_;
+  std::vector<double> edgeYMax_;
+  std::vector<double> edgeX_;
+  std::vector<double> edgeY_;
+  std::vector<double> edgeDx_;
+  std::vector<double> edgeDy_;
+
+  //! Lower and upper y-bound of the polygon.
+  double yMin_;
+  double yMax_;
+
+  //! Slab index of the edges in compressed row storage. Slab `i` covers the edges
+  //! `slabEdges_[slabOffsets_[i]]` to `slabEdges_[slabOffsets_[i + 1] - 1]`.
+  std::vector<unsigned int> slabOffsets_;
+  std::vector<unsigned int> slabEdges_;
+
+  //! Inverse of the slab height [1/m].
+  double slabInverseHeight_;
+};
+
+}  // namespace grid_map
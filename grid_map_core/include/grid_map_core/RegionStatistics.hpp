@@ -0,0 +1,131 @@
+/*
+ * RegionStatistics.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/CellSpans.hpp"
+#include "grid_map_core/GridMap.hpp"
+
+// STL
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Reductions over the cells of a region. Invalid (non-finite) cells are ignored.
+ */
+enum class RegionReduction {
+  MIN,
+  MAX,
+  MEAN,
+  COUNT, // Number of valid cells.
+  SUM,
+  QUANTILE
+};
+
+/*!
+ * Statistics of the valid (finite) cells of a layer in a region.
+ * If the region contains no valid cells, `count` and `sum` are zero and the other values are NAN.
+ */
+struct RegionStatistics
+{
+  size_t count = 0;
+  double sum = 0.0;
+  double min = NAN;
+  double max = NAN;
+  double mean = NAN;
+  //! Only computed if requested.
+  double quantile = NAN;
+};
+
+/*!
+ * Computes the statistics of a layer over the cells of a region given as spans.
+ * The spans are reduced directly on the layer data, without iterating cell by cell.
+ * @param gridMap the grid map.
+ * @param layer the layer to reduce.
+ * @param spans the region as spans of cells (see `getCellSpans()`).
+ * @param quantile the quantile in [0, 1] to compute (linearly interpolated), NAN to skip.
+ * @return the statistics.
+ * @throw std::out_of_range if no map layer with name `layer` is present.
+ */
+RegionStatistics computeStatistics(const GridMap& gridMap, const std::string& layer, const CellSpans& spans, double quantile = NAN);
+
+/*!
+ * Computes the statistics of several layers over the cells of a region in one traversal.
+ * @param gridMap the grid map.
+ * @param layers the layers to reduce.
+ * @param spans the region as spans of cells (see `getCellSpans()`).
+ * @param quantile the quantile in [0, 1] to compute (linearly interpolated), NAN to skip.
+ * @return the statistics for each layer.
+ * @throw std::out_of_range if a map layer in `layers` is not present.
+ */
+std::vector<RegionStatistics> computeStatistics(const GridMap& gridMap, const std::vector<std::string>& layers, const CellSpans& spans,
+                                                double quantile = NAN);
+
+/*!
+ * Reduces a layer over the cells of a region given as spans.
+ * @param gridMap the grid map.
+ * @param layer the layer to reduce.
+ * @param spans the region as spans of cells (see `getCellSpans()`).
+ * @param reduction the reduction to compute.
+ * @param quantile the quantile in [0, 1] for `RegionReduction::QUANTILE` (0.5 is the median).
+ * @return the reduced value (NAN if there are no valid cells, except for COUNT and SUM).
+ * @throw std::out_of_range if no map layer with name `layer` is present.
+ */
+double reduce(const GridMap& gridMap, const std::string& layer, const CellSpans& spans, RegionReduction reduction, double quantile = 0.5);
+
+/*!
+ * Reduces several layers over the cells of a region in one traversal.
+ * @param gridMap the grid map.
+ * @param layers the layers to reduce.
+ * @param spans the region as spans of cells (see `getCellSpans()`).
+ * @param reduction the reduction to compute.
+ * @param quantile the quantile in [0, 1] for `RegionReduction::QUANTILE` (0.5 is the median).
+ * @return the reduced value for each layer.
+ * @throw std::out_of_range if a map layer in `layers` is not present.
+ */
+std::vector<double> reduce(const GridMap& gridMap, const std::vector<std::string>& layers, const CellSpans& spans,
+                           RegionReduction reduction, double quantile = 0.5);
+
+/*!
+ * Computes the statistics of a layer over the cells of a region, e.g.
+ *   computeStatistics(map, "elevation", CircleRegion{center, 0.5}).max
+ * @param region the region (`Polygon`, `CircleRegion`, `EllipseRegion` or `RectangleRegion`).
+ */
+template <typename Region>
+RegionStatistics computeStatistics(const GridMap& gridMap, const std::string& layer, const Region& region, double quantile = NAN)
+{
+  return computeStatistics(gridMap, layer, getCellSpans(gridMap, region), quantile);
+}
+
+template <typename Region>
+std::vector<RegionStatistics> computeStatistics(const GridMap& gridMap, const std::vector<std::string>& layers, const Region& region,
+                                                double quantile = NAN)
+{
+  return computeStatistics(gridMap, layers, getCellSpans(gridMap, region), quantile);
+}
+
+/*!
+ * Reduces a layer over the cells of a region, e.g.
+ *   reduce(map, "elevation", footprintPolygon, RegionReduction::MAX)
+ * @param region the region (`Polygon`, `CircleRegion`, `EllipseRegion` or `RectangleRegion`).
+ */
+template <typename Region>
+double reduce(const GridMap& gridMap, const std::string& layer, const Region& region, RegionReduction reduction, double quantile = 0.5)
+{
+  return reduce(gridMap, layer, getCellSpans(gridMap, region), reduction, quantile);
+}
+
+template <typename Region>
+std::vector<double> reduce(const GridMap& gridMap, const std::vector<std::string>& layers, const Region& region, RegionReduction reduction,
+                           double quantile = 0.5)
+{
+  return reduce(gridMap, layers, getCellSpans(gridMap, region), reduction, quantile);
+}
+
+}  // namespace grid_map
@@ -0,0 +1,130 @@
+/*
+ * SimdKernels.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace grid_map {
+namespace simd {
+
+/*!
+ * Instruction sets of the kernels, the best one supported by the CPU is selected at runtime.
+ * The library can therefore be built for a generic target (e.g. SSE2 for distribution packages)
+ * and still use AVX2/AVX-512 where available. On other architectures only `SCALAR` is available.
+ */
+enum class InstructionSet {
+  SCALAR,
+  AVX2,
+  AVX512
+};
+
+/*!
+ * Checks if an instruction set is supported by the CPU (and the build).
+ * @param instructionSet the instruction set.
+ * @return true if supported.
+ */
+bool isSupported(InstructionSet instructionSet);
+
+/*!
+ * Gets the instruction set used by the kernels (by default the best supported one).
+ * @return the instruction set.
+ */
+InstructionSet getInstructionSet();
+
+/*!
+ * Sets the instruction set used by the kernels, e.g. to compare the implementations.
+ * @param instructionSet the instruction set.
+ * @return false if the instruction set is not supported (the current one is kept).
+ */
+bool setInstructionSet(InstructionSet instructionSet);
+
+/*!
+ * Statistics of the finite values of an array. If there are no finite values, `min` and `max`
+ * are infinity and -infinity, such that statistics can be accumulated over several arrays.
+ */
+struct FiniteStatistics
+{
+  size_t count = 0;
+  double sum = 0.0;
+  float min = std::numeric_limits<float>::infinity();
+  float max = -std::numeric_limits<float>::infinity();
+};
+
+/*!
+ * Accumulates the count, sum, minimum and maximum of the finite values of an array in one pass.
+ * The sum is accumulated in double precision (the order of the additions depends on the instruction set).
+ * @param[in] data the array.
+ * @param[in] size the number of values.
+ * @param[in/out] statistics the statistics to accumulate to.
+ */
+void accumulateFiniteStatistics(const float* data, size_t size, FiniteStatistics& statistics);
+
+/*!
+ * Computes the count, sum, minimum and maximum of the finite values of an array in one pass.
+ * @param data the array.
+ * @param size the number of values.
+ * @return the statistics.
+ */
+FiniteStatistics computeFiniteStatistics(const float* data, size_t size);
+
+/*!
+ * Scales, offsets and clamps the values of an array: `output = clamp(input * scale + offset, min, max)`.
+ * NAN values stay NAN. Input and output may be the same array.
+ * @param[in] input the input array.
+ * @param[out] output the output array.
+ * @param[in] size the number of values.
+ * @param[in] scale the scale.
+ * @param[in] offset the offset.
+ * @param[in] min the lower bound.
+ * @param[in] max the upper bound.
+ */
+void scaleAndClamp(const float* input, float* output, size_t size, float scale, float offset, float min, float max);
+
+/*!
+ * Packs the channels of RGB colors in [0, 1] into float color values, with the same result as
+ * `colorVectorToValue(const Eigen::Vector3f&, float&)` (channels outside of [0, 1] are clamped).
+ * @param[in] red the red channel.
+ * @param[in] green the green channel.
+ * @param[in] blue the blue channel.
+ * @param[out] output the color values.
+ * @param[in] size the number of values.
+ */
+void packColors(const float* red, const float* green, const float* blue, float* output, size_t size);
+
+/*!
+ * Interpolates a layer bilinearly at a batch of continuous (unwrapped) indices, where integer
+ * indices correspond to cell centers. The circular buffer is handled with `startIndex`.
+ * Indices outside of [0, size - 1] (and NAN) result in NAN.
+ * @param[in] data the layer data (column-major).
+ * @param[in] size the size of the layer.
+ * @param[in] startIndex the start index of the circular buffer.
+ * @param[in] rowIndices the continuous row indices (unwrapped).
+ * @param[in] columnIndices the continuous column indices (unwrapped).
+ * @param[out] output the interpolated values.
+ * @param[in] n the number of queries.
+ */
+void interpolateBilinear(const float* data, const Size& size, const Index& startIndex, const float* rowIndices,
+                         const float* columnIndices, float* output, size_t n);
+
+/*!
+ * Accumulates a 64 bit hash of the values of an array (bit-wise) and their indices: the hashes of the
+ * single values are added up, such that the result does not depend on how an array is split into
+ * parts, e.g. at the wrap of a circular buffer. The result is the same for all instruction sets.
+ * @param[in] data the array.
+ * @param[in] size the number of values.
+ * @param[in] firstIndex the index of the first value (e.g. the linear unwrapped index of the cell).
+ * @param[in/out] hash the hash to accumulate to.
+ */
+void accumulateHash(const float* data, size_t size, uint64_t firstIndex, uint64_t& hash);
+
+}  // namespace simd
+}  // namespace grid_map
@@ -0,0 +1,183 @@
+/*
+ * SparseLayer.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace grid_map {
+
+class SparseLayerIterator;
+
+/*!
+ * Sparse storage of a layer where only few cells are populated (e.g. labels or masks).
+ * The layer is divided into square tiles, only tiles with populated cells are allocated.
+ * Each tile holds the values of its cells and a bitmap of the populated cells. Cells are
+ * addressed by buffer index (as the dense layer data), unpopulated cells read as NAN.
+ * Memory is only saved for clustered data (e.g. objects, regions of interest): a tile is allocated
+ * as soon as one of its cells is populated, such that scattered cells (e.g. a few percent of the
+ * cells at random) populate nearly every tile and use more memory than a dense layer.
+ */
+class SparseLayer
+{
+ public:
+  //! Number of cells per side of a tile.
+  static constexpr int kTileSize = 16;
+
+  //! Number of cells of a tile.
+  static constexpr int kTileCells = kTileSize * kTileSize;
+
+  /*!
+   * Constructor for an empty layer of size zero.
+   */
+  SparseLayer();
+
+  /*!
+   * Constructor.
+   * @param size the size of the layer.
+   */
+  explicit SparseLayer(const Size& size);
+
+  /*!
+   * Resizes the layer and clears all cells.
+   * @param size the new size of the layer.
+   */
+  void resize(const Size& size);
+
+  /*!
+   * Gets the size of the layer.
+   * @return the size.
+   */
+  const Size& getSize() const { return size_; }
+
+  /*!
+   * Checks if a cell is populated.
+   * @param index the buffer index of the cell.
+   * @return true if the cell is populated.
+   */
+  bool isSet(const Index& index) const;
+
+  /*!
+   * Gets the value of a cell.
+   * @param index the buffer index of the cell.
+   * @return the value, NAN if the cell is not populated.
+   */
+  float at(const Index& index) const;
+
+  /*!
+   * Gets a reference to the value of a cell for writing. An unpopulated cell is populated with NAN
+   * (use the const version to read without populating cells). The reference stays valid until the
+   * cell is cleared.
+   * @param index the buffer index of the cell.
+   * @return the reference to the value.
+   */
+  float& at(const Index& index);
+
+  /*!
+   * Sets the value of a cell (and populates the cell).
+   * @param index the buffer index of the cell.
+   * @param value the value.
+   */
+  void set(const Index& index, float value);
+
+  /*!
+   * Clears a cell (the cell is not populated anymore).
+   * @param index the buffer index of the cell.
+   */
+  void clear(const Index& index);
+
+  /*!
+   * Clears all cells of a block of the layer.
+   * @param index the buffer index of the top left cell of the block.
+   * @param size the size of the block.
+   */
+  void clearBlock(const Index& index, const Size& size);
+
+  /*!
+   * Clears all cells.
+   */
+  void clearAll();
+
+  /*!
+   * Gets the number of populated cells.
+   * @return the number of populated cells.
+   */
+  size_t getNumberOfCells() const { return nCells_; }
+
+  /*!
+   * Gets the number of allocated tiles.
+   * @return the number of allocated tiles.
+   */
+  size_t getNumberOfTiles() const { return tiles_.size() - freeTiles_.size(); }
+
+  /*!
+   * Gets the memory used by the layer (tiles and tile table, without the free tiles).
+   * @return the memory size [bytes].
+   */
+  size_t getMemorySize() const;
+
+  /*!
+   * Converts the layer to dense layer data, unpopulated cells are NAN.
+   * @param[out] data the layer data.
+   */
+  void toDense(Matrix& data) const;
+
+  /*!
+   * Sets the layer from dense layer data, the finite cells are populated.
+   * @param[in] data the layer data.
+   */
+  void fromDense(const Matrix& data);
+
+ private:
+  friend class SparseLayerIterator;
+
+  //! Tile of cells, stored column-major as the layer data.
+  struct Tile
+  {
+    std::array<float, kTileCells> values;
+    std::array<uint64_t, kTileCells / 64> occupancy;
+    int nCells;
+  };
+
+  //! Gets the table index of the tile containing a cell and the index of the cell in the tile.
+  size_t getTileIndex(const Index& index, int& cellIndex) const;
+
+  //! Gets the tile of a cell, nullptr if not allocated.
+  const Tile* getTile(const Index& index, int& cellIndex) const;
+
+  //! Gets the tile of a cell, allocates it if necessary.
+  Tile& getOrCreateTile(const Index& index, int& cellIndex);
+
+  //! Releases an allocated tile.
+  void releaseTile(size_t tileIndex);
+
+  //! Size of the layer.
+  Size size_;
+
+  //! Number of tiles per dimension.
+  Size nTiles_;
+
+  //! Offsets of the tiles in `tiles_` (column-major), -1 if not allocated.
+  std::vector<int> tileOffsets_;
+
+  //! Tiles (a deque, such that references to the values stay valid when tiles are added).
+  std::deque<Tile> tiles_;
+
+  //! Offsets of the released tiles, reused for new tiles.
+  std::vector<int> freeTiles_;
+
+  //! Number of populated cells.
+  size_t nCells_;
+};
+
+}  // namespace grid_map
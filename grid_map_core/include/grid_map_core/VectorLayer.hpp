@@ -0,0 +1,244 @@
+/*
+ * VectorLayer.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Eigen
+#include <Eigen/Core>
+
+namespace grid_map {
+
+/*!
+ * Gets the names of the channel layers of a vector layer. For up to three channels the
+ * suffixes are "x", "y" and "z" (e.g. "normal_x", "normal_y", "normal_z" for the prefix "normal_"),
+ * otherwise the channels are numbered ("prefix0", "prefix1", ...).
+ * @param prefix the prefix of the vector layer.
+ * @param nChannels the number of channels.
+ * @return the names of the channel layers.
+ */
+inline std::vector<std::string> getVectorLayerNames(const std::string& prefix, const int nChannels)
+{
+  static const char* const kSuffixes[] = {"x", "y", "z"};
+  std::vector<std::string> names;
+  for (int i = 0; i < nChannels; ++i) {
+    names.push_back(prefix + (nChannels <= 3 ? std::string(kSuffixes[i]) : std::to_string(i)));
+  }
+  return names;
+}
+
+/*!
+ * Access to a vector layer, i.e. N layers of a grid map holding the channels of a vector per cell.
+ * The channels are stored planar (one layer per channel), such that moving the map, submaps and
+ * the conversions work unchanged. The layers are looked up once on construction, after that the
+ * vectors are accessed directly by index, either per cell or as batch in interleaved layout
+ * (one vector per column).
+ * Note: The view is invalidated if the channel layers are erased or the map is resized.
+ */
+template <int N, typename MatrixType>
+class VectorLayerBase
+{
+ public:
+  using Vector = Eigen::Matrix<float, N, 1>;
+  using Vectors = Eigen::Matrix<float, N, Eigen::Dynamic>;
+
+  /*!
+   * Gets the vector of a cell.
+   * @param linearIndex the linear (storage order) index of the cell.
+   * @return the vector.
+   */
+  Vector operator()(const Eigen::Index linearIndex) const
+  {
+    Vector vector;
+    for (int i = 0; i < N; ++i) {
+      vector(i) = (*channels_[i])(linearIndex);
+    }
+    return vector;
+  }
+
+  /*!
+   * Gets the vector of a cell.
+   * @param index the buffer index of the cell.
+   * @return the vector.
+   */
+  Vector operator()(const Index& index) const { return (*this)(getLinearIndex(index)); }
+
+  /*!
+   * Gets the vector of a cell if all its channels are valid.
+   * @param[in] index the buffer index of the cell.
+   * @param[out] vector the vector.
+   * @return true if all channels are valid, false otherwise.
+   */
+  bool getVector(const Index& index, Vector& vector) const
+  {
+    const Vector temp = (*this)(index);
+    if (!temp.allFinite()) {
+      return false;
+    }
+    vector = temp;
+    return true;
+  }
+
+  /*!
+   * Checks if all channels of a cell are valid.
+   * @param linearIndex the linear (storage order) index of the cell.
+   * @return true if valid.
+   */
+  bool isValid(const Eigen::Index linearIndex) const { return (*this)(linearIndex).allFinite(); }
+
+  /*!
+   * Gets the vectors of all cells in interleaved layout, column `i` holds the vector of the cell with linear index `i`.
+   * @param[out] vectors the vectors.
+   */
+  void getInterleaved(Vectors& vectors) const
+  {
+    vectors.resize(N, size());
+    for (int i = 0; i < N; ++i) {
+      vectors.row(i) = Eigen::Map<const Eigen::RowVectorXf>(channels_[i]->data(), size());
+    }
+  }
+
+  /*!
+   * Gathers the vectors of a batch of cells in interleaved layout.
+   * @param[in] linearIndices the linear (storage order) indices of the cells.
+   * @param[out] vectors the vectors, one column per cell.
+   */
+  void getVectors(const std::vector<Eigen::Index>& linearIndices, Vectors& vectors) const
+  {
+    vectors.resize(N, linearIndices.size());
+    for (size_t j = 0; j < linearIndices.size(); ++j) {
+      for (int i = 0; i < N; ++i) {
+        vectors(i, j) = (*channels_[i])(linearIndices[j]);
+      }
+    }
+  }
+
+  /*!
+   * Gets the layer data of a channel.
+   * @param channel the channel.
+   * @return the layer data.
+   */
+  MatrixType& getChannel(const int channel) const { return *channels_[channel]; }
+
+  /*!
+   * Gets the number of cells.
+   * @return the number of cells.
+   */
+  Eigen::Index size() const { return channels_[0]->size(); }
+
+ protected:
+  Eigen::Index getLinearIndex(const Index& index) const { return static_cast<Eigen::Index>(index(1)) * channels_[0]->rows() + index(0); }
+
+  //! Layer data of the channels.
+  std::array<MatrixType*, N> channels_;
+};
+
+/*!
+ * Read-only access to a vector layer (see `VectorLayerBase`).
+ */
+template <int N>
+class ConstVectorLayer : public VectorLayerBase<N, const Matrix>
+{
+ public:
+  /*!
+   * Constructor.
+   * @param gridMap the grid map.
+   * @param prefix the prefix of the channel layers (see `getVectorLayerNames()`).
+   * @throw std::out_of_range if a channel layer is not present.
+   */
+  ConstVectorLayer(const GridMap& gridMap, const std::string& prefix)
+  {
+    const auto names = getVectorLayerNames(prefix, N);
+    for (int i = 0; i < N; ++i) {
+      this->channels_[i] = &gridMap[names[i]];
+    }
+  }
+};
+
+/*!
+ * Read and write access to a vector layer (see `VectorLayerBase`).
+ */
+template <int N>
+class VectorLayer : public VectorLayerBase<N, Matrix>
+{
+ public:
+  /*!
+   * Constructor.
+   * @param gridMap the grid map.
+   * @param prefix the prefix of the channel layers (see `getVectorLayerNames()`).
+   * @throw std::out_of_range if a channel layer is not present.
+   */
+  VectorLayer(GridMap& gridMap, const std::string& prefix)
+  {
+    const auto names = getVectorLayerNames(prefix, N);
+    for (int i = 0; i < N; ++i) {
+      this->channels_[i] = &gridMap[names[i]];
+    }
+  }
+
+  /*!
+   * Sets the vector of a cell.
+   * @param linearIndex the linear (storage order) index of the cell.
+   * @param vector the vector.
+   */
+  template <typename Derived>
+  void set(const Eigen::Index linearIndex, const Eigen::MatrixBase<Derived>& vector)
+  {
+    for (int i = 0; i < N; ++i) {
+      (*this->channels_[i])(linearIndex) = static_cast<float>(vector(i));
+    }
+  }
+
+  /*!
+   * Sets the vector of a cell.
+   * @param index the buffer index of the cell.
+   * @param vector the vector.
+   */
+  template <typename Derived>
+  void set(const Index& index, const Eigen::MatrixBase<Derived>& vector)
+  {
+    set(this->getLinearIndex(index), vector);
+  }
+
+  /*!
+   * Sets the vectors of all cells from interleaved layout, column `i` holds the vector of the cell with linear index `i`.
+   * @param vectors the vectors.
+   */
+  void setInterleaved(const typename VectorLayerBase<N, Matrix>::Vectors& vectors)
+  {
+    assert(vectors.cols() == this->size());
+    for (int i = 0; i < N; ++i) {
+      Eigen::Map<Eigen::RowVectorXf>(this->channels_[i]->data(), this->size()) = vectors.row(i);
+    }
+  }
+};
+
+/*!
+ * Adds (or overwrites) the channel layers of a vector layer.
+ * @param gridMap the grid map.
+ * @param prefix the prefix of the channel layers (see `getVectorLayerNames()`).
+ * @param value the value to initialize the channels with.
+ * @return access to the vector layer.
+ */
+template <int N>
+VectorLayer<N> addVectorLayer(GridMap& gridMap, const std::string& prefix, const double value = NAN)
+{
+  for (const auto& name : getVectorLayerNames(prefix, N)) {
+    gridMap.add(name, value);
+  }
+  return VectorLayer<N>(gridMap, prefix);
+}
+
+}  // namespace grid_map
@@ -0,0 +1,47 @@
+/*
+ * Viewshed.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <limits>
+#include <string>
+
+namespace grid_map {
+
+/*!
+ * Computes the viewshed (cells visible from an observer) of an elevation layer.
+ *
+ * The map is swept ring by ring outwards from the observer cell (XDraw algorithm), separately
+ * for the eight octants around the observer, which are processed in parallel. For each cell,
+ * the horizon (the maximum elevation slope seen from the observer along the line of sight) is
+ * interpolated from the two cells of the previous ring next to the line of sight. This makes
+ * the computation O(N) for N cells instead of O(N * L) with one `LineIterator` per cell, at
+ * the cost of an approximation of the line of sight close to the horizon.
+ *
+ * The result is written to `visibilityLayer` (added if not present): 1.0 for visible cells,
+ * 0.0 for occluded cells and cells beyond `maxRange`, NAN for cells without valid elevation.
+ * Invalid elevation cells do not occlude other cells.
+ *
+ * @param gridMap the grid map.
+ * @param elevationLayer the layer with the elevation of the terrain.
+ * @param visibilityLayer the layer to write the visibility to.
+ * @param observerPosition the position of the observer (snapped to the center of its cell).
+ * @param observerHeight the height of the observer above the terrain.
+ * @param targetHeight the height above the terrain of the target points whose visibility is checked.
+ * @param maxRange the maximum range of the observer.
+ * @param numberOfThreads the maximum number of threads, 0 for the number of hardware threads.
+ * @return true if successful, false if the observer is outside of the map or its elevation is invalid.
+ * @throw std::out_of_range if no map layer with name `elevationLayer` is present.
+ */
+bool computeViewshed(GridMap& gridMap, const std::string& elevationLayer, const std::string& visibilityLayer,
+                     const Position& observerPosition, double observerHeight, double targetHeight = 0.0,
+                     double maxRange = std::numeric_limits<double>::infinity(), unsigned int numberOfThreads = 0);
+
+}  // namespace grid_map
@@ -8,25 +8,39 @@ Scalar numberOfFinites() const
   return Scalar((derived().array() == derived().array()).count());
 }
 
+// The reductions of finite values of contiguous float data (e.g. layers) use the SIMD kernels of
+// grid_map_core. Without finite values, they fall back to the reductions below (NAN or infinity).
 Scalar sumOfFinites() const
 {
   if (SizeAtCompileTime==0 || (SizeAtCompileTime==Dynamic && size()==0)) {
     return Scalar(0);
   }
+  Eigen::internal::finite_statistics_of_floats statistics;
+  if (Eigen::internal::finite_statistics_fast_path<Derived>::run(derived(), statistics) && statistics.count > 0) {
+    return Scalar(statistics.sum);
+  }
   return Scalar(this->redux(Eigen::internal::scalar_sum_of_finites_op<Scalar>()));
 }
 
 Scalar meanOfFinites() const
 {
-  return Scalar(this->redux(Eigen::internal::scalar_sum_of_finites_op<Scalar>())) / this->numberOfFinites();
+  return this->sumOfFinites() / this->numberOfFinites();
 }
 
 Scalar minCoeffOfFinites() const
 {
+  Eigen::internal::finite_statistics_of_floats statistics;
+  if (Eigen::internal::finite_statistics_fast_path<Derived>::run(derived(), statistics) && statistics.count > 0) {
+    return Scalar(statistics.min);
+  }
   return Scalar(this->redux(Eigen::internal::scalar_min_of_finites_op<Scalar>()));
 }
 
 Scalar maxCoeffOfFinites() const
 {
+  Eigen::internal::finite_statistics_of_floats statistics;
+  if (Eigen::internal::finite_statistics_fast_path<Derived>::run(derived(), statistics) && statistics.count > 0) {
+    return Scalar(statistics.max);
+  }
   return Scalar(this->redux(Eigen::internal::scalar_max_of_finites_op<Scalar>()));
 }
@@ -57,3 +57,29 @@ struct functor_traits<scalar_max_of_finites_op<Scalar> > {
     PacketAccess = false
   };
 };
+
+// Count, sum, minimum and maximum of the finite values of a contiguous float array, computed with
+// the runtime dispatched kernels of grid_map_core (see `grid_map::simd::accumulateFiniteStatistics`).
+struct finite_statistics_of_floats {
+  Index count;
+  double sum;
+  float min;
+  float max;
+};
+finite_statistics_of_floats compute_finite_statistics_of_floats(const float* data, Index size);
+
+// Fast path of the reductions of finite values, only taken for float data stored contiguously.
+template<typename Derived,
+         bool IsFloatWithDirectAccess = (traits<Derived>::Flags & DirectAccessBit) != 0 &&
+                                        is_same<typename traits<Derived>::Scalar, float>::value>
+struct finite_statistics_fast_path {
+  static bool run(const Derived& /*data*/, finite_statistics_of_floats& /*statistics*/) { return false; }
+};
+template<typename Derived>
+struct finite_statistics_fast_path<Derived, true> {
+  static bool run(const Derived& data, finite_statistics_of_floats& statistics) {
+    if (data.innerStride() != 1 || (data.outerSize() > 1 && data.outerStride() != data.innerSize())) return false;
+    statistics = compute_finite_statistics_of_floats(data.data(), data.size());
+    return true;
+  }
+};
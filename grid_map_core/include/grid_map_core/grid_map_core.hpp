@@ -10,9 +10,22 @@
 
 #include "grid_map_core/TypeDefs.hpp"
 #include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/ForEachCell.hpp"
+#include "grid_map_core/Fingerprint.hpp"
+#include "grid_map_core/LayerAllocation.hpp"
 #include "grid_map_core/SubmapGeometry.hpp"
 #include "grid_map_core/GridMapMath.hpp"
+#include "grid_map_core/GridMapMosaic.hpp"
+#include "grid_map_core/GridMapPoints.hpp"
 #include "grid_map_core/BufferRegion.hpp"
 #include "grid_map_core/Polygon.hpp"
+#include "grid_map_core/PreparedPolygon.hpp"
+#include "grid_map_core/CellSpans.hpp"
+#include "grid_map_core/ConcurrentGridMapUpdater.hpp"
+#include "grid_map_core/RegionStatistics.hpp"
+#include "grid_map_core/SimdKernels.hpp"
+#include "grid_map_core/SparseLayer.hpp"
+#include "grid_map_core/VectorLayer.hpp"
+#include "grid_map_core/Viewshed.hpp"
 #include "grid_map_core/iterators/iterators.hpp"
 #include "grid_map_core/eigen_plugins/Functors.hpp"
@@ -45,7 +45,7 @@ public:
    * to which the iterator is pointing at.
    * @return the regular index (2-dim.) of the cell on which the iterator is pointing.
    */
-  Index operator *() const;
+  const Index& operator *() const;
 
   /*!
    * Returns the the linear (1-dim.) index of the cell the iterator is pointing at.
@@ -93,6 +93,9 @@ public:
   //! Linear index.
   size_t linearIndex_;
 
+  //! Current (2-dim.) index, kept in sync with the linear index.
+  Index index_;
+
   //! Is iterator out of scope.
   bool isPastEnd_;
   // NOLINTEND(misc-non-private-member-variables-in-classes)
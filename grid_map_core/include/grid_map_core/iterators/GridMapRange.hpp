@@ -0,0 +1,346 @@
+/*
+ * GridMapRange.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/BufferRegion.hpp"
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/SubmapGeometry.hpp"
+#include "grid_map_core/TypeDefs.hpp"
+
+// STL
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+// Eigen
+#include <Eigen/Core>
+
+namespace grid_map {
+
+/*!
+ * Iterator over the cells of a rectangular region of the circular buffer.
+ * The iterator keeps incremental row/column counters, such that stepping to the next cell
+ * does not require any division or wrapping computation. Cells are visited in storage
+ * order, i.e. the first index (row) changes fastest.
+ * Dereferencing the iterator returns the buffer index of the cell, same as `GridMapIterator`.
+ * The index is returned by value, since it is not stored in a container but in the iterator itself.
+ * The iterator is therefore declared as input iterator (forward and stronger categories require
+ * references), even though it can also be decremented and moved by arbitrary offsets.
+ */
+class GridMapRangeIterator
+{
+public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = Index;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Index*;
+  using reference = Index;
+
+  /*!
+   * Default constructor (singular iterator).
+   */
+  GridMapRangeIterator();
+
+  /*!
+   * Constructor.
+   * @param bufferSize the size of the buffer of the grid map.
+   * @param bufferStartIndex the start index of the circular buffer of the grid map.
+   * @param submapStartIndex the (buffer) start index of the region, typically top-left index.
+   * @param submapSize the size of the region.
+   * @param position the linear position of the iterator inside the region.
+   */
+  GridMapRangeIterator(const Size& bufferSize, const Index& bufferStartIndex, const Index& submapStartIndex,
+                       const Size& submapSize, difference_type position);
+
+  /*!
+   * Dereference the iterator.
+   * @return the buffer index of the cell the iterator is pointing at.
+   */
+  reference operator*() const { return index_; }
+  /*!
+   * Access to the buffer index of the cell, valid as long as the iterator is not changed.
+   */
+  pointer operator->() const { return &index_; }
+
+  /*!
+   * Random access to the buffer index of the cell at an offset from the iterator.
+   * @param offset the offset in number of cells.
+   * @return the buffer index of the cell.
+   */
+  reference operator[](difference_type offset) const { return *(*this + offset); }
+
+  /*!
+   * Increase the iterator to the next cell.
+   * @return a reference to the updated iterator.
+   */
+  GridMapRangeIterator& operator++()
+  {
+    ++position_;
+    if (++submapIndex_(0) < submapSize_(0)) {
+      if (++index_(0) >= bufferSize_(0)) {
+        index_(0) = 0;
+      }
+    } else {
+      submapIndex_(0) = 0;
+      index_(0) = submapStartIndex_(0);
+      ++submapIndex_(1);
+      if (++index_(1) >= bufferSize_(1)) {
+        index_(1) = 0;
+      }
+    }
+    return *this;
+  }
+
+  /*!
+   * Decrease the iterator to the previous cell.
+   * @return a reference to the updated iterator.
+   */
+  GridMapRangeIterator& operator--()
+  {
+    --position_;
+    if (submapIndex_(0) > 0) {
+      --submapIndex_(0);
+      if (--index_(0) < 0) {
+        index_(0) = bufferSize_(0) - 1;
+      }
+    } else {
+      submapIndex_(0) = submapSize_(0) - 1;
+      index_(0) = submapStartIndex_(0) + submapIndex_(0);
+      if (index_(0) >= bufferSize_(0)) {
+        index_(0) -= bufferSize_(0);
+      }
+      --submapIndex_(1);
+      if (--index_(1) < 0) {
+        index_(1) = bufferSize_(1) - 1;
+      }
+    }
+    return *this;
+  }
+
+  GridMapRangeIterator operator++(int)
+  {
+    GridMapRangeIterator previous(*this);
+    ++(*this);
+    return previous;
+  }
+
+  GridMapRangeIterator operator--(int)
+  {
+    GridMapRangeIterator previous(*this);
+    --(*this);
+    return previous;
+  }
+
+  /*!
+   * Move the iterator by an arbitrary number of cells. Costs one division.
+   * @param offset the number of cells to advance (can be negative).
+   * @return a reference to the updated iterator.
+   */
+  GridMapRangeIterator& operator+=(difference_type offset);
+  GridMapRangeIterator& operator-=(difference_type offset) { return *this += -offset; }
+
+  GridMapRangeIterator operator+(difference_type offset) const
+  {
+    GridMapRangeIterator result(*this);
+    return result += offset;
+  }
+
+  GridMapRangeIterator operator-(difference_type offset) const
+  {
+    GridMapRangeIterator result(*this);
+    return result -= offset;
+  }
+
+  friend GridMapRangeIterator operator+(difference_type offset, const GridMapRangeIterator& iterator) { return iterator + offset; }
+
+  difference_type operator-(const GridMapRangeIterator& other) const { return position_ - other.position_; }
+
+  bool operator==(const GridMapRangeIterator& other) const { return position_ == other.position_; }
+  bool operator!=(const GridMapRangeIterator& other) const { return position_ != other.position_; }
+  bool operator<(const GridMapRangeIterator& other) const { return position_ < other.position_; }
+  bool operator>(const GridMapRangeIterator& other) const { return position_ > other.position_; }
+  bool operator<=(const GridMapRangeIterator& other) const { return position_ <= other.position_; }
+  bool operator>=(const GridMapRangeIterator& other) const { return position_ >= other.position_; }
+
+  /*!
+   * Returns the linear (1-dim.) index of the cell in the data matrices of the grid map.
+   * @return the 1d linear index.
+   */
+  size_t getLinearIndex() const { return static_cast<size_t>(index_(1)) * bufferSize_(0) + index_(0); }
+
+  /*!
+   * Get the current index in the region.
+   * @return the current index in the region.
+   */
+  const Index& getSubmapIndex() const { return submapIndex_; }
+
+  /*!
+   * Retrieve the index as unwrapped index, i.e., as the corresponding index of a
+   * grid map with no circular buffer offset.
+   */
+  Index getUnwrappedIndex() const;
+
+  /*!
+   * Returns the linear position of the iterator inside the region.
+   * @return the number of cells from the start of the region.
+   */
+  difference_type getPosition() const { return position_; }
+
+private:
+  //! Size of the buffer.
+  Size bufferSize_;
+
+  //! Start index of the circular buffer.
+  Index bufferStartIndex_;
+
+  //! Top left (buffer) index of the region.
+  Index submapStartIndex_;
+
+  //! Size of the region.
+  Size submapSize_;
+
+  //! Current buffer index.
+  Index index_;
+
+  //! Current index in the region.
+  Index submapIndex_;
+
+  //! Linear position inside the region.
+  difference_type position_;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/*!
+ * Range of cells of a grid map (or of a rectangular part of it) providing STL input iterators
+ * with `begin()` and `end()`. This allows to use the cells of a map with range-based for loops
+ * and the single-pass algorithms of the `<algorithm>` header, e.g.
+ *
+ *   GridMapRange range(map);
+ *   const auto nValid = std::count_if(range.begin(), range.end(), [&](const Index& index) { ... });
+ *
+ * The range can be split into contiguous sub-ranges for distributing the work over several threads.
+ * It also models the TBB range concept, i.e. it can directly be passed to `tbb::parallel_for`.
+ * Before using a submap range, make sure that the requested submap is actually contained in the grid map.
+ */
+class GridMapRange
+{
+public:
+  using iterator = GridMapRangeIterator;
+  using const_iterator = GridMapRangeIterator;
+  using value_type = GridMapRangeIterator::value_type;
+  using difference_type = GridMapRangeIterator::difference_type;
+  using size_type = size_t;
+
+  /*!
+   * Constructor.
+   * @param gridMap the grid map to iterate on (all cells, in storage order).
+   */
+  explicit GridMapRange(const GridMap& gridMap);
+
+  /*!
+   * Constructor.
+   * @param submap the submap geometry to iterate over.
+   */
+  explicit GridMapRange(const SubmapGeometry& submap);
+
+  /*!
+   * Constructor.
+   * @param gridMap the grid map to iterate on.
+   * @param bufferRegion the buffer region of a grid map to iterate over.
+   */
+  GridMapRange(const GridMap& gridMap, const BufferRegion& bufferRegion);
+
+  /*!
+   * Constructor.
+   * @param gridMap the grid map to iterate on.
+   * @param submapStartIndex the start index of the submap, typically top-left index.
+   * @param submapSize the size of the submap to iterate on.
+   */
+  GridMapRange(const GridMap& gridMap, const Index& submapStartIndex, const Size& submapSize);
+
+  /*!
+   * Splitting constructor following the TBB range concept (`tbb::split`). Assigns the
+   * second half of `other` to this range and shrinks `other` to its first half.
+   * @param other the range to split.
+   */
+  template <typename Split>
+  GridMapRange(GridMapRange& other, Split /*split*/)
+      : GridMapRange(other)
+  {
+    const difference_type middle = other.first_ + (other.last_ - other.first_) / 2;
+    first_ = middle;
+    other.last_ = middle;
+  }
+
+  iterator begin() const;
+  iterator end() const;
+
+  /*!
+   * Returns the number of cells in the range.
+   * @return the number of cells.
+   */
+  size_type size() const { return static_cast<size_type>(last_ - first_); }
+
+  /*!
+   * Checks if the range is empty.
+   * @return true if the range contains no cells.
+   */
+  bool empty() const { return last_ <= first_; }
+
+  /*!
+   * Checks if the range can be split further (TBB range concept).
+   * @return true if the range contains more than one cell.
+   */
+  bool is_divisible() const { return last_ - first_ > 1; }  // NOLINT(readability-identifier-naming)
+
+  /*!
+   * Returns a contiguous part of this range.
+   * @param first the position of the first cell, relative to the beginning of this range.
+   * @param last the position after the last cell, relative to the beginning of this range.
+   * @return the sub-range.
+   */
+  GridMapRange subrange(difference_type first, difference_type last) const;
+
+  /*!
+   * Splits the range into contiguous sub-ranges of (almost) equal size.
+   * @param numberOfParts the requested number of sub-ranges.
+   * @return the non-empty sub-ranges covering this range.
+   */
+  std::vector<GridMapRange> split(size_t numberOfParts) const;
+
+  /*!
+   * Returns the size of the region covered by the range.
+   * @return the size of the region.
+   */
+  const Size& getSubmapSize() const { return submapSize_; }
+
+private:
+  //! Size of the buffer.
+  Size bufferSize_;
+
+  //! Start index of the circular buffer.
+  Index bufferStartIndex_;
+
+  //! Top left (buffer) index of the region.
+  Index submapStartIndex_;
+
+  //! Size of the region.
+  Size submapSize_;
+
+  //! Linear position of the first cell in the region.
+  difference_type first_;
+
+  //! Linear position after the last cell in the region.
+  difference_type last_;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+}  // namespace grid_map
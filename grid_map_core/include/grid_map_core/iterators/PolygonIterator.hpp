@@ -10,6 +10,7 @@
 
 #include "grid_map_core/GridMap.hpp"
 #include "grid_map_core/Polygon.hpp"
+#include "grid_map_core/PreparedPolygon.hpp"
 #include "grid_map_core/iterators/SubmapIterator.hpp"
 
 #include <memory>
@@ -70,9 +71,15 @@ private:
    */
   void findSubmapParameters(const grid_map::Polygon& polygon, Index& startIndex,Size& bufferSize) const;
 
+  //! Polygons with more vertices are prepared with an edge index.
+  static constexpr size_t kMinVerticesForEdgeIndex = 16;
+
   //! Polygon to iterate on.
   grid_map::Polygon polygon_;
 
+  //! Polygon prepared for the point-in-polygon test of the cells.
+  grid_map::PreparedPolygon preparedPolygon_;
+
   //! Grid submap iterator.
   std::shared_ptr<SubmapIterator> internalIterator_;
 
@@ -0,0 +1,99 @@
+/*
+ * SparseLayerIterator.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/SparseLayer.hpp"
+
+// STL
+#include <cstdint>
+#include <string>
+
+// Eigen
+#include <Eigen/Core>
+
+namespace grid_map {
+
+/*!
+ * Iterator class to iterate over the populated cells of a sparse layer only, tile by tile.
+ * Empty tiles are skipped entirely and the populated cells of a tile are found with the
+ * occupancy bitmap, such that the cost is proportional to the number of populated cells.
+ * Note: The layer must not be modified (cells populated or cleared) while iterating.
+ */
+class SparseLayerIterator
+{
+ public:
+  /*!
+   * Constructor.
+   * @param layer the sparse layer to iterate on.
+   */
+  explicit SparseLayerIterator(const SparseLayer& layer);
+
+  /*!
+   * Constructor.
+   * @param gridMap the grid map with the sparse layer.
+   * @param layer the name of the sparse layer.
+   * @throw std::out_of_range if no sparse layer with this name exists.
+   */
+  SparseLayerIterator(const GridMap& gridMap, const std::string& layer);
+
+  /*!
+   * Dereference the iterator to return the (buffer) index of the cell it is pointing at.
+   * @return the index of the cell.
+   */
+  const Index& operator*() const;
+
+  /*!
+   * Gets the value of the cell the iterator is pointing at.
+   * @return the value of the cell.
+   */
+  float getValue() const;
+
+  /*!
+   * Increase the iterator to the next populated cell.
+   * @return a reference to the updated iterator.
+   */
+  SparseLayerIterator& operator++();
+
+  /*!
+   * Indicates if iterator is past end.
+   * @return true if iterator is out of scope, false if end has not been reached.
+   */
+  bool isPastEnd() const;
+
+ private:
+  /*!
+   * Finds the next populated cell, starting with the remaining bits of the current word.
+   */
+  void findNextCell();
+
+  //! Layer to iterate on.
+  const SparseLayer& layer_;
+
+  //! Index of the current tile in the tile table.
+  size_t tileIndex_;
+
+  //! Index of the current word of the occupancy bitmap.
+  size_t wordIndex_;
+
+  //! Remaining bits of the current word.
+  uint64_t bits_;
+
+  //! Index of the current cell in the tile.
+  int cellIndex_;
+
+  //! Current index.
+  Index index_;
+
+  //! Is iterator out of scope.
+  bool isPastEnd_;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+}  // namespace grid_map
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "grid_map_core/iterators/GridMapIterator.hpp"
+#include "grid_map_core/iterators/GridMapRange.hpp"
 #include "grid_map_core/iterators/SubmapIterator.hpp"
 #include "grid_map_core/iterators/CircleIterator.hpp"
 #include "grid_map_core/iterators/EllipseIterator.hpp"
@@ -16,3 +17,4 @@
 #include "grid_map_core/iterators/LineIterator.hpp"
 #include "grid_map_core/iterators/PolygonIterator.hpp"
 #include "grid_map_core/iterators/SlidingWindowIterator.hpp"
+#include "grid_map_core/iterators/SparseLayerIterator.hpp"
@@ -0,0 +1,65 @@
+/*
+ * parallel.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+// STL
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Returns the number of threads to use for a parallel computation.
+ * @param numberOfThreads the requested number of threads, 0 for the number of hardware threads.
+ * @return the number of threads (at least 1).
+ */
+inline unsigned int getNumberOfThreads(unsigned int numberOfThreads = 0) {
+  if (numberOfThreads == 0) {
+    numberOfThreads = std::thread::hardware_concurrency();
+  }
+  return std::max(numberOfThreads, 1u);
+}
+
+/*!
+ * Splits the range [begin, end) into contiguous chunks and processes them on several threads.
+ * The calling thread processes the first chunk itself. If the range is too small to be split
+ * into chunks of at least `minChunkSize` elements, the function is called serially.
+ * @param begin the first element of the range.
+ * @param end the element after the last one of the range.
+ * @param function the function to call for each chunk with the signature `void(size_t chunkBegin, size_t chunkEnd)`.
+ * @param numberOfThreads the maximum number of threads, 0 for the number of hardware threads.
+ * @param minChunkSize the minimum number of elements processed by one thread.
+ */
+template <typename Function>
+void parallelFor(size_t begin, size_t end, const Function& function, unsigned int numberOfThreads = 0, size_t minChunkSize = 1) {
+  if (end <= begin) {
+    return;
+  }
+  const size_t n = end - begin;
+  const size_t maxChunks = std::max<size_t>(n / std::max<size_t>(minChunkSize, 1), 1);
+  const size_t nChunks = std::min<size_t>(getNumberOfThreads(numberOfThreads), maxChunks);
+  if (nChunks <= 1) {
+    function(begin, end);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(nChunks - 1);
+  for (size_t i = 1; i < nChunks; ++i) {
+    const size_t chunkBegin = begin + i * n / nChunks;
+    const size_t chunkEnd = begin + (i + 1) * n / nChunks;
+    threads.emplace_back([&function, chunkBegin, chunkEnd]() { function(chunkBegin, chunkEnd); });
+  }
+  function(begin, begin + n / nChunks);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace grid_map
@@ -0,0 +1,235 @@
+/*
+ * CellSpans.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/CellSpans.hpp"
+#include "grid_map_core/PreparedPolygon.hpp"
+
+// STL
+#include <algorithm>
+#include <cmath>
+
+// Eigen
+#include <Eigen/Core>
+
+namespace grid_map {
+
+namespace {
+
+/*!
+ * Helper to rasterize a region column by column. The region provides a (conservative)
+ * interval of x-coordinates per column, which is refined with the exact inside test of
+ * the cell centers at both ends and then split into spans at the buffer boundary.
+ */
+class ColumnRasterizer
+{
+ public:
+  explicit ColumnRasterizer(const GridMap& gridMap)
+      : resolution_(gridMap.getResolution()),
+        size_(gridMap.getSize()),
+        startIndex_(gridMap.getStartIndex())
+  {
+    // Same arithmetic as `getPositionFromIndex()`, such that the cell centers are bit-identical.
+    firstCell_ = gridMap.getPosition() + (0.5 * gridMap.getLength() - 0.5 * resolution_).matrix();
+  }
+
+  //! Center of the cell with unwrapped row index `i` (x-coordinate) and column index `j` (y-coordinate).
+  double getX(int i) const { return firstCell_.x() + resolution_ * static_cast<double>(-i); }
+  double getY(int j) const { return firstCell_.y() + resolution_ * static_cast<double>(-j); }
+
+  /*!
+   * Gets the (unwrapped) range of indices whose cell centers might lie within [min, max].
+   * @return false if the range is empty.
+   */
+  bool getRange(double min, double max, double first, int size, int& indexMin, int& indexMax) const
+  {
+    if (!(min <= max)) {
+      return false;
+    }
+    // Add a margin of one cell, the range is refined with the exact test afterwards.
+    const double lower = std::floor((first - max) / resolution_) - 1.0;
+    const double upper = std::ceil((first - min) / resolution_) + 1.0;
+    if (upper < 0.0 || lower > size - 1) {
+      return false;
+    }
+    indexMin = static_cast<int>(std::max(lower, 0.0));
+    indexMax = static_cast<int>(std::min(upper, static_cast<double>(size - 1)));
+    return true;
+  }
+
+  bool getColumnRange(double yMin, double yMax, int& jMin, int& jMax) const
+  {
+    return getRange(yMin, yMax, firstCell_.y(), size_(1), jMin, jMax);
+  }
+
+  /*!
+   * Adds the cells of column `j` with centers in [xMin, xMax] for which `isInside(x)` holds.
+   * `isInside` has to be true on a contiguous interval of the column.
+   */
+  template <typename IsInside>
+  void addSpan(int j, double xMin, double xMax, const IsInside& isInside, CellSpans& spans) const
+  {
+    int iMin, iMax;
+    if (!getRange(xMin, xMax, firstCell_.x(), size_(0), iMin, iMax)) {
+      return;
+    }
+    while (iMin <= iMax && !isInside(getX(iMin))) {
+      ++iMin;
+    }
+    while (iMax >= iMin && !isInside(getX(iMax))) {
+      --iMax;
+    }
+    if (iMin > iMax) {
+      return;
+    }
+
+    // Convert to buffer indices and split at the end of the buffer.
+    int column = j + startIndex_(1);
+    if (column >= size_(1)) {
+      column -= size_(1);
+    }
+    int row = iMin + startIndex_(0);
+    if (row >= size_(0)) {
+      row -= size_(0);
+    }
+    const int length = iMax - iMin + 1;
+    const int firstLength = std::min(length, size_(0) - row);
+    spans.push_back(CellSpan{Index(row, column), firstLength});
+    if (firstLength < length) {
+      spans.push_back(CellSpan{Index(0, column), length - firstLength});
+    }
+  }
+
+ private:
+  double resolution_;
+  Size size_;
+  Index startIndex_;
+  Position firstCell_;
+};
+
+}  // namespace
+
+CellSpans getCellSpans(const GridMap& gridMap, const Polygon& region)
+{
+  CellSpans spans;
+  const PreparedPolygon polygon(region, region.nVertices() > 16);
+  double yMin, yMax;
+  if (!polygon.getBoundsY(yMin, yMax)) {
+    return spans;
+  }
+  const ColumnRasterizer rasterizer(gridMap);
+  int jMin, jMax;
+  if (!rasterizer.getColumnRange(yMin, yMax, jMin, jMax)) {
+    return spans;
+  }
+
+  std::vector<double> crossings;
+  for (int j = jMin; j <= jMax; ++j) {
+    polygon.getCrossings(rasterizer.getY(j), crossings);
+    for (size_t k = 0; k + 1 < crossings.size(); k += 2) {
+      const double xMin = crossings[k];
+      const double xMax = crossings[k + 1];
+      rasterizer.addSpan(j, xMin, xMax, [&](double x) { return xMin <= x && x < xMax; }, spans);
+    }
+  }
+  return spans;
+}
+
+CellSpans getCellSpans(const GridMap& gridMap, const CircleRegion& region)
+{
+  CellSpans spans;
+  const ColumnRasterizer rasterizer(gridMap);
+  int jMin, jMax;
+  if (!rasterizer.getColumnRange(region.center.y() - region.radius, region.center.y() + region.radius, jMin, jMax)) {
+    return spans;
+  }
+
+  const double radiusSquare = region.radius * region.radius;
+  for (int j = jMin; j <= jMax; ++j) {
+    const double dy = rasterizer.getY(j) - region.center.y();
+    const double dySquare = dy * dy;
+    const double halfWidth = std::sqrt(std::max(radiusSquare - dySquare, 0.0));
+    // Same test as the `CircleIterator`.
+    const auto isInside = [&](double x) {
+      const double dx = x - region.center.x();
+      return dx * dx + dySquare <= radiusSquare;
+    };
+    rasterizer.addSpan(j, region.center.x() - halfWidth, region.center.x() + halfWidth, isInside, spans);
+  }
+  return spans;
+}
+
+CellSpans getCellSpans(const GridMap& gridMap, const EllipseRegion& region)
+{
+  CellSpans spans;
+  const Eigen::Array2d semiAxisSquare = (0.5 * region.length).square();
+  const double sinRotation = std::sin(region.rotation);
+  const double cosRotation = std::cos(region.rotation);
+  Eigen::Matrix2d transformMatrix;
+  transformMatrix << cosRotation, sinRotation, sinRotation, -cosRotation;
+
+  const ColumnRasterizer rasterizer(gridMap);
+  const double halfHeight = std::sqrt(semiAxisSquare(0) * sinRotation * sinRotation + semiAxisSquare(1) * cosRotation * cosRotation);
+  int jMin, jMax;
+  if (!rasterizer.getColumnRange(region.center.y() - halfHeight, region.center.y() + halfHeight, jMin, jMax)) {
+    return spans;
+  }
+
+  // Coefficients of the quadratic equation a * dx^2 + b * dx + c <= 0 of the ellipse in the map frame.
+  const double a = cosRotation * cosRotation / semiAxisSquare(0) + sinRotation * sinRotation / semiAxisSquare(1);
+  const double bPerDy = 2.0 * cosRotation * sinRotation * (1.0 / semiAxisSquare(0) - 1.0 / semiAxisSquare(1));
+  const double cPerDySquare = sinRotation * sinRotation / semiAxisSquare(0) + cosRotation * cosRotation / semiAxisSquare(1);
+
+  for (int j = jMin; j <= jMax; ++j) {
+    const double y = rasterizer.getY(j);
+    const double dy = y - region.center.y();
+    const double b = bPerDy * dy;
+    const double c = cPerDySquare * dy * dy - 1.0;
+    const double discriminant = std::max(b * b - 4.0 * a * c, 0.0);
+    const double dxMin = (-b - std::sqrt(discriminant)) / (2.0 * a);
+    const double dxMax = (-b + std::sqrt(discriminant)) / (2.0 * a);
+    // Same test as the `EllipseIterator`.
+    const auto isInside = [&](double x) {
+      const Position position(x, y);
+      const double value = ((transformMatrix * (position - region.center)).array().square() / semiAxisSquare).sum();
+      return value <= 1;
+    };
+    rasterizer.addSpan(j, region.center.x() + dxMin, region.center.x() + dxMax, isInside, spans);
+  }
+  return spans;
+}
+
+CellSpans getCellSpans(const GridMap& gridMap, const RectangleRegion& region)
+{
+  CellSpans spans;
+  const Position min = region.center - (0.5 * region.length).matrix();
+  const Position max = region.center + (0.5 * region.length).matrix();
+  const ColumnRasterizer rasterizer(gridMap);
+  int jMin, jMax;
+  if (!rasterizer.getColumnRange(min.y(), max.y(), jMin, jMax)) {
+    return spans;
+  }
+
+  const auto isInside = [&](double x) { return min.x() <= x && x <= max.x(); };
+  for (int j = jMin; j <= jMax; ++j) {
+    const double y = rasterizer.getY(j);
+    if (y < min.y() || y > max.y()) {
+      continue;
+    }
+    rasterizer.addSpan(j, min.x(), max.x(), isInside, spans);
+  }
+  return spans;
+}
+
+size_t getNumberOfCells(const CellSpans& spans)
+{
+  size_t nCells = 0;
+  for (const auto& span : spans) {
+    nCells += span.length;
+  }
+  return nCells;
+}
+
+}  // namespace grid_map
@@ -0,0 +1,85 @@
+/*
+ * ConcurrentGridMapUpdater.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/ConcurrentGridMapUpdater.hpp"
+
+// STL
+#include <cstdint>
+#include <cstring>
+
+namespace grid_map {
+
+namespace {
+
+/*!
+ * Atomically replaces the cell value by `value` as long as `isBetter(value, current)` holds.
+ * The float is accessed through its bit pattern with the atomic builtins of GCC/Clang.
+ */
+template <typename IsBetter>
+void atomicReplace(float& cell, const float value, const IsBetter& isBetter)
+{
+  static_assert(sizeof(float) == sizeof(uint32_t), "Unexpected size of float.");
+  auto* bits = reinterpret_cast<uint32_t*>(&cell);
+  uint32_t expectedBits = __atomic_load_n(bits, __ATOMIC_RELAXED);
+  uint32_t desiredBits;
+  std::memcpy(&desiredBits, &value, sizeof(float));
+  float current;
+  std::memcpy(&current, &expectedBits, sizeof(float));
+  while (isBetter(value, current)) {
+    if (__atomic_compare_exchange_n(bits, &expectedBits, desiredBits, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+      return;
+    }
+    // Another thread changed the value in the meantime.
+    std::memcpy(&current, &expectedBits, sizeof(float));
+  }
+}
+
+}  // namespace
+
+void atomicMax(float& cell, const float value)
+{
+  atomicReplace(cell, value, [](float newValue, float current) { return !(current >= newValue); });
+}
+
+void atomicMin(float& cell, const float value)
+{
+  atomicReplace(cell, value, [](float newValue, float current) { return !(current <= newValue); });
+}
+
+ConcurrentGridMapUpdater::ConcurrentGridMapUpdater(GridMap& gridMap, const Size& tileSize)
+    : gridMap_(gridMap),
+      tileSize_(tileSize.cwiseMax(1)),
+      nTiles_((gridMap.getSize() + tileSize_ - Size::Ones()).cwiseQuotient(tileSize_).cwiseMax(1)),
+      mutexes_(nTiles_.prod())
+{
+}
+
+std::unique_lock<std::mutex> ConcurrentGridMapUpdater::lockTile(const Index& tileIndex)
+{
+  return std::unique_lock<std::mutex>(mutexes_[tileIndex(1) * nTiles_(0) + tileIndex(0)]);
+}
+
+std::vector<std::unique_lock<std::mutex>> ConcurrentGridMapUpdater::lockAllTiles()
+{
+  std::vector<std::unique_lock<std::mutex>> locks;
+  locks.reserve(mutexes_.size());
+  for (auto& mutex : mutexes_) {
+    locks.emplace_back(mutex);
+  }
+  return locks;
+}
+
+Index ConcurrentGridMapUpdater::getTileIndex(const Index& bufferIndex) const
+{
+  return bufferIndex.cwiseQuotient(tileSize_);
+}
+
+const Size& ConcurrentGridMapUpdater::getNumberOfTiles() const
+{
+  return nTiles_;
+}
+
+}  // namespace grid_map
@@ -0,0 +1,142 @@
+/*
+ * Fingerprint.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/Fingerprint.hpp"
+#include "grid_map_core/SimdKernels.hpp"
+#include "grid_map_core/utils/parallel.hpp"
+
+// STL
+#include <algorithm>
+#include <vector>
+
+namespace grid_map {
+
+namespace {
+
+//! Minimum number of cells processed by one thread.
+constexpr size_t kMinCellsPerThread = 1 << 18;
+
+/*!
+ * Mixes the bits of a 64 bit value (finalizer of MurmurHash3).
+ */
+inline uint64_t mixBits(uint64_t value)
+{
+  value ^= value >> 33;
+  value *= 0xff51afd7ed558ccdULL;
+  value ^= value >> 33;
+  value *= 0xc4ceb9fe1a85ec53ULL;
+  value ^= value >> 33;
+  return value;
+}
+
+/*!
+ * Accumulates the hash of the cells of a column in the unwrapped row range [rowBegin, rowEnd).
+ * The range is split at the wrap of the circular buffer.
+ */
+void accumulateColumnHash(const Matrix& data, const Index& bufferStartIndex, const int column, const int rowBegin, const int rowEnd,
+                          uint64_t& hash)
+{
+  const int rows = static_cast<int>(data.rows());
+  const int bufferColumn = (column + bufferStartIndex(1)) % static_cast<int>(data.cols());
+  const float* columnData = data.data() + static_cast<size_t>(bufferColumn) * rows;
+  const uint64_t columnIndex = static_cast<uint64_t>(column) * rows;
+  const int wrapRow = rows - bufferStartIndex(0);  // First unwrapped row at the start of the buffer.
+  if (rowBegin < wrapRow) {
+    const int end = std::min(rowEnd, wrapRow);
+    simd::accumulateHash(columnData + bufferStartIndex(0) + rowBegin, end - rowBegin, columnIndex + rowBegin, hash);
+  }
+  if (rowEnd > wrapRow) {
+    const int begin = std::max(rowBegin, wrapRow);
+    simd::accumulateHash(columnData + begin - wrapRow, rowEnd - begin, columnIndex + begin, hash);
+  }
+}
+
+/*!
+ * Finalizes an accumulated hash of a number of cells.
+ */
+inline Fingerprint finalize(const uint64_t hash, const size_t numberOfCells)
+{
+  return mixBits(hash ^ mixBits(numberOfCells));
+}
+
+}  // namespace
+
+Fingerprint computeFingerprint(const Matrix& data, const Index& bufferStartIndex)
+{
+  const int rows = static_cast<int>(data.rows());
+  const size_t nColumns = static_cast<size_t>(data.cols());
+  if (bufferStartIndex.isZero()) {
+    uint64_t hash = 0;
+    simd::accumulateHash(data.data(), data.size(), 0, hash);
+    return finalize(hash, data.size());
+  }
+
+  // The hashes of the cells are added up, the columns can therefore be processed in any order.
+  std::vector<uint64_t> columnHashes(nColumns, 0);
+  parallelFor(0, nColumns,
+              [&](size_t columnBegin, size_t columnEnd) {
+                for (size_t column = columnBegin; column < columnEnd; ++column) {
+                  accumulateColumnHash(data, bufferStartIndex, static_cast<int>(column), 0, rows, columnHashes[column]);
+                }
+              },
+              0, std::max<size_t>(kMinCellsPerThread / std::max(rows, 1), 1));
+  uint64_t hash = 0;
+  for (const auto columnHash : columnHashes) {
+    hash += columnHash;
+  }
+  return finalize(hash, data.size());
+}
+
+Fingerprint computeFingerprint(const GridMap& gridMap, const std::string& layer)
+{
+  return computeFingerprint(gridMap.get(layer), gridMap.getStartIndex());
+}
+
+TileFingerprints computeTileFingerprints(const Matrix& data, const Index& bufferStartIndex, int tileSize)
+{
+  tileSize = std::max(tileSize, 1);
+  const int rows = static_cast<int>(data.rows());
+  const int columns = static_cast<int>(data.cols());
+  const int tileRows = (rows + tileSize - 1) / tileSize;
+  const int tileColumns = (columns + tileSize - 1) / tileSize;
+  TileFingerprints fingerprints(tileRows, tileColumns);
+
+  // Each column of tiles is processed by one thread.
+  parallelFor(0, static_cast<size_t>(tileColumns),
+              [&](size_t tileColumnBegin, size_t tileColumnEnd) {
+                std::vector<uint64_t> hashes(tileRows);
+                for (int tileColumn = static_cast<int>(tileColumnBegin); tileColumn < static_cast<int>(tileColumnEnd); ++tileColumn) {
+                  const int columnBegin = tileColumn * tileSize;
+                  const int columnEnd = std::min(columnBegin + tileSize, columns);
+                  std::fill(hashes.begin(), hashes.end(), 0);
+                  for (int column = columnBegin; column < columnEnd; ++column) {
+                    for (int tileRow = 0; tileRow < tileRows; ++tileRow) {
+                      accumulateColumnHash(data, bufferStartIndex, column, tileRow * tileSize, std::min((tileRow + 1) * tileSize, rows),
+                                           hashes[tileRow]);
+                    }
+                  }
+                  for (int tileRow = 0; tileRow < tileRows; ++tileRow) {
+                    const size_t numberOfCells =
+                        static_cast<size_t>(std::min((tileRow + 1) * tileSize, rows) - tileRow * tileSize) * (columnEnd - columnBegin);
+                    fingerprints(tileRow, tileColumn) = finalize(hashes[tileRow], numberOfCells);
+                  }
+                }
+              },
+              0, std::max<size_t>(kMinCellsPerThread / std::max<size_t>(static_cast<size_t>(tileSize) * rows, 1), 1));
+  return fingerprints;
+}
+
+TileFingerprints computeTileFingerprints(const GridMap& gridMap, const std::string& layer, const int tileSize)
+{
+  return computeTileFingerprints(gridMap.get(layer), gridMap.getStartIndex(), tileSize);
+}
+
+Fingerprint combineFingerprints(const Fingerprint first, const Fingerprint second)
+{
+  return mixBits(mixBits(first) + second);
+}
+
+}  // namespace grid_map
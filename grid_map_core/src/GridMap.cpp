@@ -10,14 +10,17 @@
 
 #include "grid_map_core/CubicInterpolation.hpp"
 #include "grid_map_core/GridMapMath.hpp"
+#include "grid_map_core/SimdKernels.hpp"
 #include "grid_map_core/SubmapGeometry.hpp"
 #include "grid_map_core/iterators/GridMapIterator.hpp"
+#include "grid_map_core/iterators/SparseLayerIterator.hpp"
 
 #include <cmath>
 #include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 
 using std::cout;
 using std::endl;
@@ -79,32 +82,72 @@ bool GridMap::hasSameLayers(const GridMap& other) const {
                      [&](const std::string& layer){return other.exists(layer);});
 }
 
+void GridMap::setAllocationOptions(const LayerAllocationOptions& options) {
+  allocationOptions_ = options;
+}
+
+const LayerAllocationOptions& GridMap::getAllocationOptions() const {
+  return allocationOptions_;
+}
+
 void GridMap::add(const std::string& layer, const double value) {
-  add(layer, Matrix::Constant(size_(0), size_(1), value));
+  eraseSparse(layer);
+  auto layerData = data_.find(layer);
+  if (layerData == data_.end()) {
+    layerData = data_.insert(std::pair<std::string, Matrix>(layer, Matrix())).first;
+    layers_.push_back(layer);
+  }
+  // Allocate and initialize in place, without a temporary layer.
+  allocateLayer(layerData->second, size_, allocationOptions_);
+  fillLayer(layerData->second, value, allocationOptions_);
 }
 
 void GridMap::add(const std::string& layer, const Matrix& data) {
   assert(size_(0) == data.rows());
   assert(size_(1) == data.cols());
 
-  if (exists(layer)) {
-    // Type exists already, overwrite its data.
-    data_.at(layer) = data;
-  } else {
+  eraseSparse(layer);
+  auto layerData = data_.find(layer);
+  if (layerData == data_.end()) {
     // Type does not exist yet, add type and data.
-    data_.insert(std::pair<std::string, Matrix>(layer, data));
+    layerData = data_.insert(std::pair<std::string, Matrix>(layer, Matrix())).first;
+    layers_.push_back(layer);
+  }
+  // Existing data of the same size is overwritten in place.
+  allocateLayer(layerData->second, size_, allocationOptions_);
+  copyLayer(layerData->second, data, allocationOptions_);
+}
+
+void GridMap::add(const std::string& layer, Matrix&& data) {
+  assert(size_(0) == data.rows());
+  assert(size_(1) == data.cols());
+
+  // The moved data was not allocated with the allocation options, copy it if they apply.
+  if (allocationOptions_.appliesTo(static_cast<size_t>(data.size()))) {
+    add(layer, static_cast<const Matrix&>(data));
+    return;
+  }
+  eraseSparse(layer);
+  const auto layerData = data_.find(layer);
+  if (layerData != data_.end()) {
+    layerData->second = std::move(data);
+  } else {
+    data_.insert(std::pair<std::string, Matrix>(layer, std::move(data)));
     layers_.push_back(layer);
   }
 }
 
 bool GridMap::exists(const std::string& layer) const {
-  return !(data_.find(layer) == data_.end());
+  return data_.find(layer) != data_.end() || sparseData_.find(layer) != sparseData_.end();
 }
 
 const Matrix& GridMap::get(const std::string& layer) const {
   try {
     return data_.at(layer);
   } catch (const std::out_of_range& exception) {
+    if (isSparse(layer)) {
+      throw std::out_of_range("GridMap::get(...) : Map layer '" + layer + "' is sparse, use getSparse(...) or convertToDense(...).");
+    }
     throw std::out_of_range("GridMap::get(...) : No map layer '" + layer + "' available.");
   }
 }
@@ -113,6 +156,9 @@ Matrix& GridMap::get(const std::string& layer) {
   try {
     return data_.at(layer);
   } catch (const std::out_of_range& exception) {
+    if (isSparse(layer)) {
+      throw std::out_of_range("GridMap::get(...) : Map layer '" + layer + "' is sparse, use getSparse(...) or convertToDense(...).");
+    }
     throw std::out_of_range("GridMap::get(...) : No map layer of type '" + layer + "' available.");
   }
 }
@@ -128,15 +174,18 @@ Matrix& GridMap::operator[](const std::string& layer) {
 bool GridMap::erase(const std::string& layer) {
   const auto dataIterator = data_.find(layer);
   if (dataIterator == data_.end()) {
-    return false;
-  }
-  data_.erase(dataIterator);
+    if (!eraseSparse(layer)) {
+      return false;
+    }
+  } else {
+    data_.erase(dataIterator);
 
-  const auto layerIterator = std::find(layers_.begin(), layers_.end(), layer);
-  if (layerIterator == layers_.end()) {
-    return false;
+    const auto layerIterator = std::find(layers_.begin(), layers_.end(), layer);
+    if (layerIterator == layers_.end()) {
+      return false;
+    }
+    layers_.erase(layerIterator);
   }
-  layers_.erase(layerIterator);
 
   const auto basicLayerIterator = std::find(basicLayers_.begin(), basicLayers_.end(), layer);
   if (basicLayerIterator != basicLayers_.end()) {
@@ -150,6 +199,78 @@ const std::vector<std::string>& GridMap::getLayers() const {
   return layers_;
 }
 
+void GridMap::addSparse(const std::string& layer) {
+  const auto dataIterator = data_.find(layer);
+  if (dataIterator != data_.end()) {
+    data_.erase(dataIterator);
+    layers_.erase(std::find(layers_.begin(), layers_.end(), layer));
+  }
+  auto sparseIterator = sparseData_.find(layer);
+  if (sparseIterator == sparseData_.end()) {
+    sparseIterator = sparseData_.insert(std::make_pair(layer, SparseLayer())).first;
+    sparseLayers_.push_back(layer);
+  }
+  sparseIterator->second.resize(size_);
+}
+
+bool GridMap::isSparse(const std::string& layer) const {
+  return sparseData_.find(layer) != sparseData_.end();
+}
+
+const SparseLayer& GridMap::getSparse(const std::string& layer) const {
+  try {
+    return sparseData_.at(layer);
+  } catch (const std::out_of_range& exception) {
+    throw std::out_of_range("GridMap::getSparse(...) : No sparse map layer '" + layer + "' available.");
+  }
+}
+
+SparseLayer& GridMap::getSparse(const std::string& layer) {
+  try {
+    return sparseData_.at(layer);
+  } catch (const std::out_of_range& exception) {
+    throw std::out_of_range("GridMap::getSparse(...) : No sparse map layer '" + layer + "' available.");
+  }
+}
+
+const std::vector<std::string>& GridMap::getSparseLayers() const {
+  return sparseLayers_;
+}
+
+void GridMap::convertToSparse(const std::string& layer) {
+  const auto dataIterator = data_.find(layer);
+  if (dataIterator == data_.end()) {
+    throw std::out_of_range("GridMap::convertToSparse(...) : No dense map layer '" + layer + "' available.");
+  }
+  SparseLayer sparseLayer;
+  sparseLayer.fromDense(dataIterator->second);
+  data_.erase(dataIterator);
+  layers_.erase(std::find(layers_.begin(), layers_.end(), layer));
+  sparseData_.insert(std::make_pair(layer, std::move(sparseLayer)));
+  sparseLayers_.push_back(layer);
+}
+
+void GridMap::convertToDense(const std::string& layer) {
+  const auto sparseIterator = sparseData_.find(layer);
+  if (sparseIterator == sparseData_.end()) {
+    throw std::out_of_range("GridMap::convertToDense(...) : No sparse map layer '" + layer + "' available.");
+  }
+  Matrix& data = data_[layer];
+  sparseIterator->second.toDense(data);
+  layers_.push_back(layer);
+  eraseSparse(layer);
+}
+
+bool GridMap::eraseSparse(const std::string& layer) {
+  const auto sparseIterator = sparseData_.find(layer);
+  if (sparseIterator == sparseData_.end()) {
+    return false;
+  }
+  sparseData_.erase(sparseIterator);
+  sparseLayers_.erase(std::find(sparseLayers_.begin(), sparseLayers_.end(), layer));
+  return true;
+}
+
 float& GridMap::atPosition(const std::string& layer, const Position& position) {
   Index index;
   if (getIndex(position, index)) {
@@ -210,19 +331,27 @@ float GridMap::atPosition(const std::string& layer, const Position& position, In
 }
 
 float& GridMap::at(const std::string& layer, const Index& index) {
-  try {
-    return data_.at(layer)(index(0), index(1));
-  } catch (const std::out_of_range& exception) {
-    throw std::out_of_range("GridMap::at(...) : No map layer '" + layer + "' available.");
+  const auto data = data_.find(layer);
+  if (data != data_.end()) {
+    return data->second(index(0), index(1));
   }
+  const auto sparseData = sparseData_.find(layer);
+  if (sparseData != sparseData_.end()) {
+    return sparseData->second.at(index);
+  }
+  throw std::out_of_range("GridMap::at(...) : No map layer '" + layer + "' available.");
 }
 
 float GridMap::at(const std::string& layer, const Index& index) const {
-  try {
-    return data_.at(layer)(index(0), index(1));
-  } catch (const std::out_of_range& exception) {
-    throw std::out_of_range("GridMap::at(...) : No map layer '" + layer + "' available.");
+  const auto data = data_.find(layer);
+  if (data != data_.end()) {
+    return data->second(index(0), index(1));
   }
+  const auto sparseData = sparseData_.find(layer);
+  if (sparseData != sparseData_.end()) {
+    return static_cast<const SparseLayer&>(sparseData->second).at(index);
+  }
+  throw std::out_of_range("GridMap::at(...) : No map layer '" + layer + "' available.");
 }
 
 bool GridMap::getIndex(const Position& position, Index& index) const {
@@ -325,6 +454,19 @@ GridMap GridMap::getSubmap(const Position& position, const Length& length, Index
     }
   }
 
+  // Copy the populated cells of the sparse layers.
+  const Index submapStartIndex = getIndexFromBufferIndex(submapInformation.getStartIndex(), size_, startIndex_);
+  for (const auto& layer : sparseLayers_) {
+    submap.addSparse(layer);
+    SparseLayer& submapLayer = submap.getSparse(layer);
+    for (SparseLayerIterator iterator(getSparse(layer)); !iterator.isPastEnd(); ++iterator) {
+      const Index index = getIndexFromBufferIndex(*iterator, size_, startIndex_) - submapStartIndex;
+      if ((index >= 0).all() && (index < submap.size_).all()) {
+        submapLayer.set(index, iterator.getValue());
+      }
+    }
+  }
+
   isSuccess = true;
   return submap;
 }
@@ -524,7 +666,7 @@ bool GridMap::addDataFrom(const GridMap& other, bool extendMap, bool overwriteDa
 
   // Check if all layers to copy exist and add missing layers.
   for (const auto& layer : layers) {
-    if (std::find(layers_.begin(), layers_.end(), layer) == layers_.end()) {
+    if (!exists(layer)) {
       add(layer);
     }
   }
@@ -622,6 +764,17 @@ bool GridMap::extendToInclude(const GridMap& other) {
         at(layer, *iterator) = mapCopy.at(layer, index);
       }
     }
+    for (const auto& layer : sparseLayers_) {
+      SparseLayer& sparseLayer = getSparse(layer);
+      for (SparseLayerIterator iterator(mapCopy.getSparse(layer)); !iterator.isPastEnd(); ++iterator) {
+        Position position;
+        mapCopy.getPosition(*iterator, position);
+        Index index;
+        if (getIndex(position, index)) {
+          sparseLayer.set(index, iterator.getValue());
+        }
+      }
+    }
   }
   return true;
 }
@@ -703,6 +856,14 @@ void GridMap::convertToDefaultStartIndex() {
     data.second = tempData;
   }
 
+  for (auto& data : sparseData_) {
+    SparseLayer tempData(size_);
+    for (SparseLayerIterator iterator(data.second); !iterator.isPastEnd(); ++iterator) {
+      tempData.set(getIndexFromBufferIndex(*iterator, size_, startIndex_), iterator.getValue());
+    }
+    data.second = std::move(tempData);
+  }
+
   startIndex_.setZero();
 }
 
@@ -743,8 +904,13 @@ Position GridMap::getClosestPositionInMap(const Position& position) const {
 }
 
 void GridMap::clear(const std::string& layer) {
+  const auto sparseData = sparseData_.find(layer);
+  if (sparseData != sparseData_.end()) {
+    sparseData->second.clearAll();
+    return;
+  }
   try {
-    data_.at(layer).setConstant(NAN);
+    fillLayer(data_.at(layer), NAN, allocationOptions_);
   } catch (const std::out_of_range& exception) {
     throw std::out_of_range("GridMap::clear(...) : No map layer '" + layer + "' available.");
   }
@@ -758,7 +924,10 @@ void GridMap::clearBasic() {
 
 void GridMap::clearAll() {
   for (auto& data : data_) {
-    data.second.setConstant(NAN);
+    fillLayer(data.second, NAN, allocationOptions_);
+  }
+  for (auto& data : sparseData_) {
+    data.second.clearAll();
   }
 }
 
@@ -766,89 +935,41 @@ void GridMap::clearRows(unsigned int index, unsigned int nRows) {
   for (auto& layer : layers_) {
     data_.at(layer).block(index, 0, nRows, getSize()(1)).setConstant(NAN);
   }
+  for (auto& data : sparseData_) {
+    data.second.clearBlock(Index(index, 0), Size(nRows, getSize()(1)));
+  }
 }
 
 void GridMap::clearCols(unsigned int index, unsigned int nCols) {
   for (auto& layer : layers_) {
     data_.at(layer).block(0, index, getSize()(0), nCols).setConstant(NAN);
   }
+  for (auto& data : sparseData_) {
+    data.second.clearBlock(Index(0, index), Size(getSize()(0), nCols));
+  }
 }
 
 bool GridMap::atPositionLinearInterpolated(const std::string& layer, const Position& position, float& value) const {
-  Position point;
-  Index indices[4];
-  bool idxTempDir;
-  size_t idxShift[4];
-
-  getIndex(position, indices[0]);
-  getPosition(indices[0], point);
-
-  if (position.x() >= point.x()) {
-    indices[1] = indices[0] + Index(-1, 0);  // Second point is above first point.
-    idxTempDir = true;
-  } else {
-    indices[1] = indices[0] + Index(+1, 0);
-    idxTempDir = false;
-  }
-  if (position.y() >= point.y()) {
-    indices[2] = indices[0] + Index(0, -1);  // Third point is right of first point.
-    if (idxTempDir) {
-      idxShift[0] = 0;
-      idxShift[1] = 1;
-      idxShift[2] = 2;
-      idxShift[3] = 3;
-    } else {
-      idxShift[0] = 1;
-      idxShift[1] = 0;
-      idxShift[2] = 3;
-      idxShift[3] = 2;
-    }
-
-  } else {
-    indices[2] = indices[0] + Index(0, +1);
-    if (idxTempDir) {
-      idxShift[0] = 2;
-      idxShift[1] = 3;
-      idxShift[2] = 0;
-      idxShift[3] = 1;
-    } else {
-      idxShift[0] = 3;
-      idxShift[1] = 2;
-      idxShift[2] = 1;
-      idxShift[3] = 0;
-    }
-  }
-  indices[3].x() = indices[1].x();
-  indices[3].y() = indices[2].y();
-
-  const Size& mapSize = getSize();
-  const size_t bufferSize = mapSize(0) * mapSize(1);
-  const size_t startIndexLin = getLinearIndexFromIndex(startIndex_, mapSize);
-  const size_t endIndexLin = startIndexLin + bufferSize;
-  const auto& layerMat = operator[](layer);
-  float f[4];
-
-  for (size_t i = 0; i < 4; ++i) {
-    const size_t indexLin = getLinearIndexFromIndex(indices[idxShift[i]], mapSize);
-    if ((indexLin < startIndexLin) || (indexLin > endIndexLin)) {
-      return false;
-    }
-    f[i] = layerMat(indexLin);
+  // Continuous unwrapped index, integer indices at the cell centers.
+  const Position firstCellPosition = position_ + 0.5 * (length_.matrix() - Position::Constant(resolution_));
+  const Position continuousIndex = (firstCellPosition - position) / resolution_;
+  if (!(continuousIndex.x() >= 0.0 && continuousIndex.x() <= size_(0) - 1 && continuousIndex.y() >= 0.0 &&
+        continuousIndex.y() <= size_(1) - 1)) {
+    return false;
   }
-
-  getPosition(indices[idxShift[0]], point);
-  const Position positionRed = (position - point) / resolution_;
-  const Position positionRedFlip = Position(1., 1.) - positionRed;
-
-  value = f[0] * positionRedFlip.x() * positionRedFlip.y() + f[1] * positionRed.x() * positionRedFlip.y() +
-          f[2] * positionRedFlip.x() * positionRed.y() + f[3] * positionRed.x() * positionRed.y();
+  const float row = static_cast<float>(continuousIndex.x());
+  const float column = static_cast<float>(continuousIndex.y());
+  simd::interpolateBilinear(operator[](layer).data(), size_, startIndex_, &row, &column, &value, 1);
   return true;
 }
 
 void GridMap::resize(const Index& size) {
   size_ = size;
   for (auto& data : data_) {
-    data.second.resize(size_(0), size_(1));
+    allocateLayer(data.second, size_, allocationOptions_);
+  }
+  for (auto& data : sparseData_) {
+    data.second.resize(size_);
   }
 }
 
@@ -0,0 +1,200 @@
+/*
+ * GridMapMosaic.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMapMosaic.hpp"
+#include "grid_map_core/utils/parallel.hpp"
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace grid_map {
+
+namespace {
+
+/*!
+ * Map merged into the mosaic.
+ */
+struct MosaicSource
+{
+  const GridMap* map;
+
+  //! Index in the mosaic of the first (unwrapped) cell of the map.
+  Index offset;
+
+  //! Layer data for each layer of the mosaic, nullptr if the map does not have the layer.
+  std::vector<const Matrix*> layers;
+
+  //! Weights for the weighted mean, nullptr for weight 1.
+  const Matrix* weight;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+//! Center of the first (unwrapped) cell of the map, same arithmetic as `getPositionFromIndex()`.
+Position getFirstCellPosition(const GridMap& map)
+{
+  return map.getPosition() + (0.5 * map.getLength() - 0.5 * map.getResolution()).matrix();
+}
+
+/*!
+ * Merges the part of a source map overlapping the columns [columnBegin, columnEnd) of the mosaic.
+ */
+void mergeSource(const MosaicSource& source, const std::vector<Matrix*>& layers, std::vector<Matrix>& weightSums, const int columnBegin,
+                 const int columnEnd, const MosaicPolicy policy)
+{
+  const Size& size = source.map->getSize();
+  const Index& startIndex = source.map->getStartIndex();
+  const int begin = std::max(columnBegin, source.offset(1));
+  const int end = std::min(columnEnd, source.offset(1) + size(1));
+
+  for (size_t layer = 0; layer < layers.size(); ++layer) {
+    const Matrix* sourceData = source.layers[layer];
+    if (sourceData == nullptr) {
+      continue;
+    }
+    Matrix& data = *layers[layer];
+    for (int column = begin; column < end; ++column) {
+      int sourceColumn = column - source.offset(1) + startIndex(1);
+      if (sourceColumn >= size(1)) {
+        sourceColumn -= size(1);
+      }
+      int sourceRow = startIndex(0);
+      for (int row = source.offset(0); row < source.offset(0) + size(0); ++row, ++sourceRow) {
+        if (sourceRow == size(0)) {
+          sourceRow = 0;
+        }
+        const float value = (*sourceData)(sourceRow, sourceColumn);
+        if (!std::isfinite(value)) {
+          continue;
+        }
+        float& cell = data(row, column);
+        switch (policy) {
+          case MosaicPolicy::OVERWRITE_BY_TIMESTAMP:
+            cell = value;
+            break;
+          case MosaicPolicy::MAX:
+            if (!(cell >= value)) {
+              cell = value;
+            }
+            break;
+          case MosaicPolicy::WEIGHTED_MEAN: {
+            const float weight = source.weight == nullptr ? 1.0f : (*source.weight)(sourceRow, sourceColumn);
+            if (!(weight > 0.0f)) {
+              continue;
+            }
+            // The cells hold the weighted sums until all sources are merged.
+            cell = std::isfinite(cell) ? cell + weight * value : weight * value;
+            weightSums[layer](row, column) += weight;
+            break;
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+bool mosaic(const std::vector<const GridMap*>& maps, GridMap& mosaic, const MosaicOptions& options)
+{
+  if (maps.empty()) {
+    return false;
+  }
+  const GridMap& firstMap = *maps.front();
+  const double resolution = firstMap.getResolution();
+  for (const auto* map : maps) {
+    if (std::abs(map->getResolution() - resolution) > 1e-6 * resolution || map->getFrameId() != firstMap.getFrameId()) {
+      return false;
+    }
+  }
+
+  // Geometry of the mosaic, aligned to the cells of the first map.
+  const Position origin = getFirstCellPosition(firstMap);
+  std::vector<MosaicSource> sources(maps.size());
+  Index minIndex = Index::Constant(std::numeric_limits<int>::max());
+  Index maxIndex = Index::Constant(std::numeric_limits<int>::min());
+  Time timestamp = 0;
+  for (size_t i = 0; i < maps.size(); ++i) {
+    const Position offset = (origin - getFirstCellPosition(*maps[i])) / resolution;
+    sources[i].map = maps[i];
+    sources[i].offset = Index(static_cast<int>(std::lround(offset.x())), static_cast<int>(std::lround(offset.y())));
+    minIndex = minIndex.cwiseMin(sources[i].offset);
+    maxIndex = maxIndex.cwiseMax(sources[i].offset + maps[i]->getSize() - Index::Ones());
+    timestamp = std::max(timestamp, maps[i]->getTimestamp());
+  }
+  const Size size = maxIndex - minIndex + Index::Ones();
+  const Length length = size.cast<double>() * resolution;
+  const Position firstCell = origin - resolution * minIndex.cast<double>().matrix();
+  const Position position = firstCell - (0.5 * length - 0.5 * resolution).matrix();
+
+  std::vector<std::string> layers = options.layers;
+  if (layers.empty()) {
+    for (const auto* map : maps) {
+      for (const auto& layer : map->getLayers()) {
+        if (std::find(layers.begin(), layers.end(), layer) == layers.end()) {
+          layers.push_back(layer);
+        }
+      }
+    }
+  }
+
+  mosaic = GridMap(layers);
+  mosaic.setFrameId(firstMap.getFrameId());
+  mosaic.setTimestamp(timestamp);
+  mosaic.setGeometry(length, resolution, position);
+
+  std::vector<Matrix*> layerData;
+  for (const auto& layer : layers) {
+    layerData.push_back(&mosaic[layer]);
+  }
+  for (auto& source : sources) {
+    source.offset -= minIndex;
+    for (const auto& layer : layers) {
+      source.layers.push_back(source.map->exists(layer) ? &source.map->get(layer) : nullptr);
+    }
+    const bool hasWeight = !options.weightLayer.empty() && source.map->exists(options.weightLayer);
+    source.weight = hasWeight ? &source.map->get(options.weightLayer) : nullptr;
+  }
+  if (options.policy == MosaicPolicy::OVERWRITE_BY_TIMESTAMP) {
+    // Later maps overwrite earlier ones.
+    std::stable_sort(sources.begin(), sources.end(), [](const MosaicSource& a, const MosaicSource& b) {
+      return a.map->getTimestamp() < b.map->getTimestamp();
+    });
+  }
+  std::vector<Matrix> weightSums;
+  if (options.policy == MosaicPolicy::WEIGHTED_MEAN) {
+    weightSums.assign(layers.size(), Matrix::Zero(size(0), size(1)));
+  }
+
+  // Each tile of columns is merged by one thread, such that no synchronization is needed.
+  const int tileColumns = std::max(options.tileColumns, 1);
+  const size_t nTiles = (size(1) + tileColumns - 1) / tileColumns;
+  parallelFor(0, nTiles,
+              [&](size_t tileBegin, size_t tileEnd) {
+                for (size_t tile = tileBegin; tile < tileEnd; ++tile) {
+                  const int columnBegin = static_cast<int>(tile) * tileColumns;
+                  const int columnEnd = std::min(columnBegin + tileColumns, size(1));
+                  for (const auto& source : sources) {
+                    if (source.offset(1) < columnEnd && source.offset(1) + source.map->getSize()(1) > columnBegin) {
+                      mergeSource(source, layerData, weightSums, columnBegin, columnEnd, options.policy);
+                    }
+                  }
+                  if (options.policy != MosaicPolicy::WEIGHTED_MEAN) {
+                    continue;
+                  }
+                  for (size_t layer = 0; layer < layerData.size(); ++layer) {
+                    auto block = layerData[layer]->middleCols(columnBegin, columnEnd - columnBegin);
+                    block.array() /= weightSums[layer].middleCols(columnBegin, columnEnd - columnBegin).array();
+                  }
+                }
+              },
+              options.numberOfThreads);
+  return true;
+}
+
+}  // namespace grid_map
@@ -0,0 +1,114 @@
+/*
+ * GridMapPoints.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMapPoints.hpp"
+#include "grid_map_core/utils/parallel.hpp"
+
+// STL
+#include <algorithm>
+#include <cmath>
+
+namespace grid_map {
+
+namespace {
+
+//! Minimum number of cells processed per thread.
+constexpr size_t kMinCellsPerThread = 1 << 15;
+
+/*!
+ * Computes the coordinate of the cell centers along one dimension for all buffer indices,
+ * with the same arithmetic as `getPositionFromIndex()`.
+ */
+std::vector<double> getCellCenters(const double firstCell, const double resolution, const int size, const int startIndex)
+{
+  std::vector<double> centers(size);
+  for (int bufferIndex = 0; bufferIndex < size; ++bufferIndex) {
+    const int index = bufferIndex >= startIndex ? bufferIndex - startIndex : bufferIndex - startIndex + size;
+    centers[bufferIndex] = firstCell + resolution * static_cast<double>(-index);
+  }
+  return centers;
+}
+
+}  // namespace
+
+size_t toPoints(const GridMap& gridMap, const std::string& heightLayer, const std::vector<std::string>& extraLayers,
+                Eigen::Matrix3Xf& points, PointChannels& channels, const std::string& maskLayer, const unsigned int numberOfThreads)
+{
+  const Matrix& height = gridMap[heightLayer];
+  const Matrix* mask = maskLayer.empty() ? nullptr : &gridMap[maskLayer];
+  std::vector<const Matrix*> extraData;
+  for (const auto& layer : extraLayers) {
+    extraData.push_back(&gridMap[layer]);
+  }
+
+  const Size& size = gridMap.getSize();
+  const double resolution = gridMap.getResolution();
+  const Position firstCell = gridMap.getPosition() + (0.5 * gridMap.getLength() - 0.5 * resolution).matrix();
+  const std::vector<double> x = getCellCenters(firstCell.x(), resolution, size(0), gridMap.getStartIndex()(0));
+  const std::vector<double> y = getCellCenters(firstCell.y(), resolution, size(1), gridMap.getStartIndex()(1));
+
+  const auto isValid = [&](Eigen::Index i) { return std::isfinite(height(i)) && (mask == nullptr || std::isfinite((*mask)(i))); };
+
+  // Split the columns into chunks, count the valid cells per chunk and compute the offsets of the chunks by a prefix sum.
+  const auto nColumns = static_cast<size_t>(size(1));
+  const size_t minColumnsPerThread = std::max<size_t>(kMinCellsPerThread / std::max(size(0), 1), 1);
+  const size_t nChunks = std::max<size_t>(std::min<size_t>(getNumberOfThreads(numberOfThreads), nColumns / minColumnsPerThread), 1);
+  std::vector<size_t> offsets(nChunks + 1, 0);
+  parallelFor(0, nChunks,
+              [&](size_t chunkBegin, size_t chunkEnd) {
+                for (size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+                  size_t count = 0;
+                  const Eigen::Index begin = static_cast<Eigen::Index>(chunk * nColumns / nChunks) * size(0);
+                  const Eigen::Index end = static_cast<Eigen::Index>((chunk + 1) * nColumns / nChunks) * size(0);
+                  for (Eigen::Index i = begin; i < end; ++i) {
+                    count += isValid(i);
+                  }
+                  offsets[chunk + 1] = count;
+                }
+              },
+              numberOfThreads);
+  for (size_t chunk = 0; chunk < nChunks; ++chunk) {
+    offsets[chunk + 1] += offsets[chunk];
+  }
+
+  const size_t nPoints = offsets.back();
+  points.resize(3, nPoints);
+  channels.resize(extraData.size(), nPoints);
+  parallelFor(0, nChunks,
+              [&](size_t chunkBegin, size_t chunkEnd) {
+                for (size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+                  Eigen::Index point = offsets[chunk];
+                  for (auto column = static_cast<Eigen::Index>(chunk * nColumns / nChunks);
+                       column < static_cast<Eigen::Index>((chunk + 1) * nColumns / nChunks); ++column) {
+                    const auto yColumn = static_cast<float>(y[column]);
+                    for (Eigen::Index row = 0; row < size(0); ++row) {
+                      const Eigen::Index i = column * size(0) + row;
+                      if (!isValid(i)) {
+                        continue;
+                      }
+                      points(0, point) = static_cast<float>(x[row]);
+                      points(1, point) = yColumn;
+                      points(2, point) = height(i);
+                      for (size_t channel = 0; channel < extraData.size(); ++channel) {
+                        channels(channel, point) = (*extraData[channel])(i);
+                      }
+                      ++point;
+                    }
+                  }
+                }
+              },
+              numberOfThreads);
+  return nPoints;
+}
+
+size_t toPoints(const GridMap& gridMap, const std::string& heightLayer, Eigen::Matrix3Xf& points, const std::string& maskLayer,
+                const unsigned int numberOfThreads)
+{
+  PointChannels channels;
+  return toPoints(gridMap, heightLayer, std::vector<std::string>(), points, channels, maskLayer, numberOfThreads);
+}
+
+}  // namespace grid_map
@@ -0,0 +1,87 @@
+/*
+ * LayerAllocation.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/LayerAllocation.hpp"
+#include "grid_map_core/utils/parallel.hpp"
+
+// STL
+#include <algorithm>
+#include <cstdint>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace grid_map {
+
+namespace {
+
+//! Minimum number of cells initialized per thread.
+constexpr size_t kMinCellsPerThread = 1 << 16;
+
+/*!
+ * Advises the kernel to use transparent huge pages for the pages fully covered by the data.
+ * Has to be called before the data is touched for the first time.
+ */
+void adviseHugePages(Matrix& data)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto begin = reinterpret_cast<uintptr_t>(data.data());
+  const uintptr_t end = begin + static_cast<uintptr_t>(data.size()) * sizeof(float);
+  const uintptr_t alignedBegin = (begin + pageSize - 1) / pageSize * pageSize;
+  const uintptr_t alignedEnd = end / pageSize * pageSize;
+  if (alignedEnd > alignedBegin) {
+    // Only a hint, failure (e.g. if huge pages are disabled) is not an error.
+    madvise(reinterpret_cast<void*>(alignedBegin), alignedEnd - alignedBegin, MADV_HUGEPAGE);
+  }
+#else
+  (void)data;
+#endif
+}
+
+}  // namespace
+
+void allocateLayer(Matrix& data, const Size& size, const LayerAllocationOptions& options)
+{
+  if (data.rows() == size(0) && data.cols() == size(1)) {
+    return;
+  }
+  // Resizing only allocates (large blocks are mapped lazily), the pages are placed when they are first touched.
+  data.resize(size(0), size(1));
+  if (options.transparentHugePages && static_cast<size_t>(data.size()) >= options.minLayerSize) {
+    adviseHugePages(data);
+  }
+}
+
+void fillLayer(Matrix& data, const float value, const LayerAllocationOptions& options)
+{
+  const auto nCells = static_cast<size_t>(data.size());
+  if (options.firstTouchThreads == 1 || nCells < options.minLayerSize) {
+    data.setConstant(value);
+    return;
+  }
+  float* cells = data.data();
+  parallelFor(0, nCells, [cells, value](size_t begin, size_t end) { std::fill(cells + begin, cells + end, value); },
+              options.firstTouchThreads, kMinCellsPerThread);
+}
+
+void copyLayer(Matrix& data, const Matrix& source, const LayerAllocationOptions& options)
+{
+  const auto nCells = static_cast<size_t>(data.size());
+  if (options.firstTouchThreads == 1 || nCells < options.minLayerSize || data.rows() != source.rows() ||
+      data.cols() != source.cols()) {
+    data = source;
+    return;
+  }
+  float* cells = data.data();
+  const float* sourceCells = source.data();
+  parallelFor(0, nCells, [cells, sourceCells](size_t begin, size_t end) { std::copy(sourceCells + begin, sourceCells + end, cells + begin); },
+              options.firstTouchThreads, kMinCellsPerThread);
+}
+
+}  // namespace grid_map
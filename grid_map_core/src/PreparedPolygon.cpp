@@ -0,0 +1,254 @@
+/*
+ * PreparedPolygon.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/PreparedPolygon.hpp"
+#include "grid_map_core/utils/parallel.hpp"
+
+// STL
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace grid_map {
+
+constexpr int PreparedPolygon::kBlockSize;
+constexpr size_t PreparedPolygon::kMinPointsPerThread;
+
+PreparedPolygon::PreparedPolygon()
+    : yMin_(std::numeric_limits<double>::infinity()),
+      yMax_(-std::numeric_limits<double>::infinity()),
+      slabInverseHeight_(0.0)
+{
+}
+
+PreparedPolygon::PreparedPolygon(const Polygon& polygon, const bool buildEdgeIndex)
+    : PreparedPolygon()
+{
+  const auto& vertices = polygon.getVertices();
+  struct Edge
+  {
+    double yMin, yMax, x, y, dx, dy;
+  };
+  std::vector<Edge> edges;
+  edges.reserve(vertices.size());
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    const Position& vertexI = vertices[i];
+    const Position& vertexJ = vertices[j];
+    // Horizontal edges are never crossed by the (horizontal) test ray.
+    if (vertexI.y() == vertexJ.y()) {
+      continue;
+    }
+    Edge edge;
+    edge.yMin = std::min(vertexI.y(), vertexJ.y());
+    edge.yMax = std::max(vertexI.y(), vertexJ.y());
+    edge.x = vertexI.x();
+    edge.y = vertexI.y();
+    edge.dx = vertexJ.x() - vertexI.x();
+    edge.dy = vertexJ.y() - vertexI.y();
+    edges.push_back(edge);
+    yMin_ = std::min(yMin_, edge.yMin);
+    yMax_ = std::max(yMax_, edge.yMax);
+  }
+  std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) { return a.yMin < b.yMin; });
+
+  edgeYMin_.reserve(edges.size());
+  edgeYMax_.reserve(edges.size());
+  edgeX_.reserve(edges.size());
+  edgeY_.reserve(edges.size());
+  edgeDx_.reserve(edges.size());
+  edgeDy_.reserve(edges.size());
+  for (const auto& edge : edges) {
+    edgeYMin_.push_back(edge.yMin);
+    edgeYMax_.push_back(edge.yMax);
+    edgeX_.push_back(edge.x);
+    edgeY_.push_back(edge.y);
+    edgeDx_.push_back(edge.dx);
+    edgeDy_.push_back(edge.dy);
+  }
+
+  if (buildEdgeIndex) {
+    this->buildEdgeIndex();
+  }
+}
+
+void PreparedPolygon::buildEdgeIndex()
+{
+  if (edgeYMin_.empty()) {
+    return;
+  }
+  const size_t nSlabs = edgeYMin_.size();
+  slabInverseHeight_ = static_cast<double>(nSlabs) / (yMax_ - yMin_);
+  const auto getSlab = [&](double y) {
+    const auto slab = static_cast<long>((y - yMin_) * slabInverseHeight_);
+    return static_cast<size_t>(std::min<long>(std::max<long>(slab, 0), static_cast<long>(nSlabs) - 1));
+  };
+
+  // Count the edges per slab, then fill them in (compressed row storage).
+  slabOffsets_.assign(nSlabs + 1, 0);
+  for (size_t e = 0; e < edgeYMin_.size(); ++e) {
+    for (size_t slab = getSlab(edgeYMin_[e]); slab <= getSlab(edgeYMax_[e]); ++slab) {
+      ++slabOffsets_[slab + 1];
+    }
+  }
+  std::partial_sum(slabOffsets_.begin(), slabOffsets_.end(), slabOffsets_.begin());
+  slabEdges_.resize(slabOffsets_.back());
+  std::vector<unsigned int> fill(slabOffsets_.begin(), slabOffsets_.end() - 1);
+  for (size_t e = 0; e < edgeYMin_.size(); ++e) {
+    for (size_t slab = getSlab(edgeYMin_[e]); slab <= getSlab(edgeYMax_[e]); ++slab) {
+      slabEdges_[fill[slab]++] = static_cast<unsigned int>(e);
+    }
+  }
+}
+
+bool PreparedPolygon::isInside(const Position& point) const
+{
+  if (hasEdgeIndex()) {
+    return isInsideIndexed(point.x(), point.y());
+  }
+  return isInsideScalar(point.x(), point.y());
+}
+
+void PreparedPolygon::isInside(const Eigen::Matrix2Xd& points, Mask& mask, const unsigned int numberOfThreads) const
+{
+  mask.resize(points.cols());
+  const double* data = points.data();
+  bool* result = mask.data();
+  parallelFor(0, static_cast<size_t>(points.cols()), [&](size_t begin, size_t end) {
+    if (hasEdgeIndex()) {
+      for (size_t i = begin; i < end; ++i) {
+        result[i] = isInsideIndexed(data[2 * i], data[2 * i + 1]);
+      }
+      return;
+    }
+    for (size_t i = begin; i < end; i += kBlockSize) {
+      isInsideBlock(data + 2 * i, static_cast<int>(std::min<size_t>(kBlockSize, end - i)), result + i);
+    }
+  }, numberOfThreads, kMinPointsPerThread);
+}
+
+void PreparedPolygon::getCrossings(const double y, std::vector<double>& crossings) const
+{
+  crossings.clear();
+  if (!(y >= yMin_ && y < yMax_)) {
+    return;
+  }
+  const auto addCrossing = [&](size_t e) {
+    if (y >= edgeYMin_[e] && y < edgeYMax_[e]) {
+      crossings.push_back(getEdgeX(e, y));
+    }
+  };
+  if (hasEdgeIndex()) {
+    const auto slab = std::min(static_cast<size_t>((y - yMin_) * slabInverseHeight_), slabOffsets_.size() - 2);
+    for (unsigned int i = slabOffsets_[slab]; i < slabOffsets_[slab + 1]; ++i) {
+      addCrossing(slabEdges_[i]);
+    }
+  } else {
+    for (size_t e = 0; e < edgeYMin_.size() && edgeYMin_[e] <= y; ++e) {
+      addCrossing(e);
+    }
+  }
+  std::sort(crossings.begin(), crossings.end());
+}
+
+bool PreparedPolygon::getBoundsY(double& yMin, double& yMax) const
+{
+  yMin = yMin_;
+  yMax = yMax_;
+  return !edgeYMin_.empty();
+}
+
+size_t PreparedPolygon::nEdges() const
+{
+  return edgeYMin_.size();
+}
+
+bool PreparedPolygon::hasEdgeIndex() const
+{
+  return !slabOffsets_.empty();
+}
+
+void PreparedPolygon::isInsideBlock(const double* points, const int nPoints, bool* mask) const
+{
+  // De-interleave the coordinates, such that the inner loop below runs over contiguous arrays.
+  alignas(64) double x[kBlockSize];
+  alignas(64) double y[kBlockSize];
+  alignas(64) double crossings[kBlockSize];
+  double blockYMin = std::numeric_limits<double>::infinity();
+  double blockYMax = -std::numeric_limits<double>::infinity();
+  for (int k = 0; k < kBlockSize; ++k) {
+    // Pad the block with a point far outside of the polygon to keep the trip count fixed.
+    x[k] = k < nPoints ? points[2 * k] : std::numeric_limits<double>::infinity();
+    y[k] = k < nPoints ? points[2 * k + 1] : yMin_;
+    crossings[k] = 0.0;
+  }
+  for (int k = 0; k < nPoints; ++k) {
+    blockYMin = std::min(blockYMin, y[k]);
+    blockYMax = std::max(blockYMax, y[k]);
+  }
+
+  // Edges are sorted by their lower bound, so we can stop at the first edge above the block.
+  const size_t nEdges = edgeYMin_.size();
+  for (size_t e = 0; e < nEdges && edgeYMin_[e] <= blockYMax; ++e) {
+    const double edgeYMin = edgeYMin_[e];
+    const double edgeYMax = edgeYMax_[e];
+    if (edgeYMax <= blockYMin) {
+      continue;
+    }
+    const double edgeX = edgeX_[e];
+    const double edgeY = edgeY_[e];
+    const double edgeDx = edgeDx_[e];
+    const double edgeDy = edgeDy_[e];
+    for (int k = 0; k < kBlockSize; ++k) {
+      // Branch-free and with a counter of the same width as the coordinates, such that the loop is vectorized.
+      const bool isCrossing = (y[k] >= edgeYMin) & (y[k] < edgeYMax) & (x[k] < edgeDx * (y[k] - edgeY) / edgeDy + edgeX);
+      crossings[k] += isCrossing ? 1.0 : 0.0;
+    }
+  }
+
+  for (int k = 0; k < nPoints; ++k) {
+    mask[k] = (static_cast<int64_t>(crossings[k]) & 1) != 0;
+  }
+}
+
+bool PreparedPolygon::isInsideIndexed(const double x, const double y) const
+{
+  if (!(y >= yMin_ && y < yMax_)) {
+    return false;
+  }
+  const auto slab = std::min(static_cast<size_t>((y - yMin_) * slabInverseHeight_), slabOffsets_.size() - 2);
+  bool isInside = false;
+  for (unsigned int i = slabOffsets_[slab]; i < slabOffsets_[slab + 1]; ++i) {
+    const unsigned int e = slabEdges_[i];
+    if (y >= edgeYMin_[e] && y < edgeYMax_[e] && x < getEdgeX(e, y)) {
+      isInside = !isInside;
+    }
+  }
+  return isInside;
+}
+
+bool PreparedPolygon::isInsideScalar(const double x, const double y) const
+{
+  if (!(y >= yMin_ && y < yMax_)) {
+    return false;
+  }
+  bool isInside = false;
+  for (size_t e = 0; e < edgeYMin_.size() && edgeYMin_[e] <= y; ++e) {
+    if (y < edgeYMax_[e] && x < getEdgeX(e, y)) {
+      isInside = !isInside;
+    }
+  }
+  return isInside;
+}
+
+double PreparedPolygon::getEdgeX(const size_t e, const double y) const
+{
+  // Same expression as in Polygon::isInside(...), such that the results are identical.
+  return edgeDx_[e] * (y - edgeY_[e]) / edgeDy_[e] + edgeX_[e];
+}
+
+}  // namespace grid_map
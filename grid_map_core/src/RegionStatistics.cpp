@@ -0,0 +1,143 @@
+/*
+ * RegionStatistics.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/RegionStatistics.hpp"
+#include "grid_map_core/SimdKernels.hpp"
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+namespace grid_map {
+
+namespace {
+
+/*!
+ * Converts the accumulated finite statistics of a layer (min/max and mean are NAN if empty).
+ */
+RegionStatistics getStatistics(const simd::FiniteStatistics& finiteStatistics)
+{
+  RegionStatistics statistics;
+  statistics.count = finiteStatistics.count;
+  statistics.sum = finiteStatistics.sum;
+  if (finiteStatistics.count > 0) {
+    statistics.min = finiteStatistics.min;
+    statistics.max = finiteStatistics.max;
+    statistics.mean = finiteStatistics.sum / static_cast<double>(finiteStatistics.count);
+  }
+  return statistics;
+}
+
+/*!
+ * Computes the (linearly interpolated) quantile of a list of values. Reorders the values.
+ */
+double computeQuantile(std::vector<float>& values, double quantile)
+{
+  if (values.empty()) {
+    return NAN;
+  }
+  quantile = std::min(std::max(quantile, 0.0), 1.0);
+  const double position = quantile * static_cast<double>(values.size() - 1);
+  const auto lower = static_cast<size_t>(position);
+  std::nth_element(values.begin(), values.begin() + lower, values.end());
+  const double lowerValue = values[lower];
+  if (lower + 1 >= values.size()) {
+    return lowerValue;
+  }
+  const double upperValue = *std::min_element(values.begin() + lower + 1, values.end());
+  return lowerValue + (position - static_cast<double>(lower)) * (upperValue - lowerValue);
+}
+
+double getReduction(const RegionStatistics& statistics, const RegionReduction reduction)
+{
+  switch (reduction) {
+    case RegionReduction::MIN:
+      return statistics.min;
+    case RegionReduction::MAX:
+      return statistics.max;
+    case RegionReduction::MEAN:
+      return statistics.mean;
+    case RegionReduction::COUNT:
+      return static_cast<double>(statistics.count);
+    case RegionReduction::SUM:
+      return statistics.sum;
+    case RegionReduction::QUANTILE:
+      return statistics.quantile;
+  }
+  throw std::invalid_argument("Unknown region reduction.");
+}
+
+}  // namespace
+
+RegionStatistics computeStatistics(const GridMap& gridMap, const std::string& layer, const CellSpans& spans, const double quantile)
+{
+  return computeStatistics(gridMap, std::vector<std::string>{layer}, spans, quantile).front();
+}
+
+std::vector<RegionStatistics> computeStatistics(const GridMap& gridMap, const std::vector<std::string>& layers, const CellSpans& spans,
+                                                const double quantile)
+{
+  std::vector<const Matrix*> data;
+  data.reserve(layers.size());
+  for (const auto& layer : layers) {
+    data.push_back(&gridMap[layer]);
+  }
+
+  const bool computeQuantiles = !std::isnan(quantile);
+  std::vector<simd::FiniteStatistics> finiteStatistics(layers.size());
+  std::vector<std::vector<float>> values(computeQuantiles ? layers.size() : 0);
+  if (computeQuantiles) {
+    const size_t nCells = getNumberOfCells(spans);
+    for (auto& layerValues : values) {
+      layerValues.reserve(nCells);
+    }
+  }
+
+  // Traverse the spans once and reduce all layers for each span while it is in cache.
+  for (const auto& span : spans) {
+    for (size_t i = 0; i < data.size(); ++i) {
+      const float* begin = data[i]->data() + static_cast<size_t>(span.startIndex(1)) * data[i]->rows() + span.startIndex(0);
+      simd::accumulateFiniteStatistics(begin, span.length, finiteStatistics[i]);
+      if (computeQuantiles) {
+        std::copy_if(begin, begin + span.length, std::back_inserter(values[i]), [](float value) { return std::isfinite(value); });
+      }
+    }
+  }
+
+  std::vector<RegionStatistics> statistics;
+  statistics.reserve(layers.size());
+  for (size_t i = 0; i < layers.size(); ++i) {
+    statistics.push_back(getStatistics(finiteStatistics[i]));
+    if (computeQuantiles) {
+      statistics.back().quantile = computeQuantile(values[i], quantile);
+    }
+  }
+  return statistics;
+}
+
+double reduce(const GridMap& gridMap, const std::string& layer, const CellSpans& spans, const RegionReduction reduction,
+              const double quantile)
+{
+  return reduce(gridMap, std::vector<std::string>{layer}, spans, reduction, quantile).front();
+}
+
+std::vector<double> reduce(const GridMap& gridMap, const std::vector<std::string>& layers, const CellSpans& spans,
+                           const RegionReduction reduction, const double quantile)
+{
+  const auto statistics =
+      computeStatistics(gridMap, layers, spans, reduction == RegionReduction::QUANTILE ? quantile : NAN);
+  std::vector<double> result;
+  result.reserve(statistics.size());
+  for (const auto& layerStatistics : statistics) {
+    result.push_back(getReduction(layerStatistics, reduction));
+  }
+  return result;
+}
+
+}  // namespace grid_map
@@ -0,0 +1,569 @@
+/*
+ * SimdKernels.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/SimdKernels.hpp"
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+// The AVX2/AVX-512 implementations are compiled with function target attributes, independent
+// of the compile flags, and are only called if the CPU supports them.
+#define GRID_MAP_SIMD_X86
+#include <immintrin.h>
+#define GRID_MAP_TARGET_AVX2 __attribute__((target("avx2")))
+#define GRID_MAP_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace grid_map {
+namespace simd {
+
+namespace {
+
+//! Instruction set used by the kernels, -1 if not yet detected.
+std::atomic<int> currentInstructionSet(-1);
+
+InstructionSet detectInstructionSet()
+{
+  if (isSupported(InstructionSet::AVX512)) {
+    return InstructionSet::AVX512;
+  }
+  if (isSupported(InstructionSet::AVX2)) {
+    return InstructionSet::AVX2;
+  }
+  return InstructionSet::SCALAR;
+}
+
+//! False for NAN and infinity.
+inline bool isFinite(const float value)
+{
+  return std::abs(value) <= std::numeric_limits<float>::max();
+}
+
+/*
+ * Scalar implementations. They are also used for the remainders of the vectorized implementations
+ * and define the exact semantics (e.g. the handling of NAN follows the SSE/AVX min/max instructions).
+ */
+
+void accumulateFiniteStatisticsScalar(const float* data, const size_t size, FiniteStatistics& statistics)
+{
+  size_t count = 0;
+  double sum = 0.0;
+  float min = statistics.min;
+  float max = statistics.max;
+  for (size_t i = 0; i < size; ++i) {
+    const float value = data[i];
+    if (!isFinite(value)) {
+      continue;
+    }
+    ++count;
+    sum += value;
+    min = value < min ? value : min;
+    max = value > max ? value : max;
+  }
+  statistics.count += count;
+  statistics.sum += sum;
+  statistics.min = min;
+  statistics.max = max;
+}
+
+inline float scaleAndClampValue(const float value, const float scale, const float offset, const float min, const float max)
+{
+  const float scaled = value * scale + offset;
+  const float lowerBounded = min > scaled ? min : scaled;
+  return max < lowerBounded ? max : lowerBounded;
+}
+
+void scaleAndClampScalar(const float* input, float* output, const size_t size, const float scale, const float offset, const float min,
+                         const float max)
+{
+  for (size_t i = 0; i < size; ++i) {
+    output[i] = scaleAndClampValue(input[i], scale, offset, min, max);
+  }
+}
+
+inline uint32_t toColorChannel(const float value)
+{
+  float scaled = value * 255.0f;
+  scaled = scaled > 0.0f ? (scaled < 255.0f ? scaled : 255.0f) : 0.0f;
+  return static_cast<uint32_t>(scaled);
+}
+
+void packColorsScalar(const float* red, const float* green, const float* blue, float* output, const size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    const uint32_t color = (toColorChannel(red[i]) << 16) + (toColorChannel(green[i]) << 8) + toColorChannel(blue[i]);
+    std::memcpy(&output[i], &color, sizeof(color));
+  }
+}
+
+inline float interpolateBilinearValue(const float* data, const Size& size, const Index& startIndex, const float row, const float column)
+{
+  if (!(row >= 0.0f && row <= static_cast<float>(size(0) - 1) && column >= 0.0f && column <= static_cast<float>(size(1) - 1))) {
+    return NAN;
+  }
+  const int row0 = std::min(static_cast<int>(row), std::max(size(0) - 2, 0));
+  const int column0 = std::min(static_cast<int>(column), std::max(size(1) - 2, 0));
+  const int row1 = std::min(row0 + 1, size(0) - 1);
+  const int column1 = std::min(column0 + 1, size(1) - 1);
+  const float rowFraction = row - static_cast<float>(row0);
+  const float columnFraction = column - static_cast<float>(column0);
+
+  const auto wrap = [](int index, const int start, const int size) {
+    index += start;
+    return index >= size ? index - size : index;
+  };
+  const size_t bufferRow0 = wrap(row0, startIndex(0), size(0));
+  const size_t bufferRow1 = wrap(row1, startIndex(0), size(0));
+  const size_t offset0 = static_cast<size_t>(wrap(column0, startIndex(1), size(1))) * size(0);
+  const size_t offset1 = static_cast<size_t>(wrap(column1, startIndex(1), size(1))) * size(0);
+  const float value00 = data[offset0 + bufferRow0];
+  const float value10 = data[offset0 + bufferRow1];
+  const float value01 = data[offset1 + bufferRow0];
+  const float value11 = data[offset1 + bufferRow1];
+  const float value0 = value00 + rowFraction * (value10 - value00);
+  const float value1 = value01 + rowFraction * (value11 - value01);
+  return value0 + columnFraction * (value1 - value0);
+}
+
+void interpolateBilinearScalar(const float* data, const Size& size, const Index& startIndex, const float* rowIndices,
+                               const float* columnIndices, float* output, const size_t n)
+{
+  for (size_t i = 0; i < n; ++i) {
+    output[i] = interpolateBilinearValue(data, size, startIndex, rowIndices[i], columnIndices[i]);
+  }
+}
+
+//! Constants of the finalizer of MurmurHash3, a bijection of 64 bit values.
+constexpr uint64_t kHashMultiplier1 = 0xff51afd7ed558ccdULL;
+constexpr uint64_t kHashMultiplier2 = 0xc4ceb9fe1a85ec53ULL;
+
+inline uint64_t hashValue(const float value, const uint64_t index)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  uint64_t key = (index << 32) | bits;
+  key ^= key >> 33;
+  key *= kHashMultiplier1;
+  key ^= key >> 33;
+  key *= kHashMultiplier2;
+  key ^= key >> 33;
+  return key;
+}
+
+void accumulateHashScalar(const float* data, const size_t size, const uint64_t firstIndex, uint64_t& hash)
+{
+  uint64_t sum = 0;
+  for (size_t i = 0; i < size; ++i) {
+    sum += hashValue(data[i], firstIndex + i);
+  }
+  hash += sum;
+}
+
+#ifdef GRID_MAP_SIMD_X86
+
+/*
+ * AVX2 implementations.
+ */
+
+GRID_MAP_TARGET_AVX2 void accumulateFiniteStatisticsAvx2(const float* data, const size_t size, FiniteStatistics& statistics)
+{
+  const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const __m256 maxFinite = _mm256_set1_ps(std::numeric_limits<float>::max());
+  const __m256 infinity = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+  const __m256 negativeInfinity = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+  __m256i count = _mm256_setzero_si256();
+  __m256d sumLow = _mm256_setzero_pd();
+  __m256d sumHigh = _mm256_setzero_pd();
+  __m256 min = infinity;
+  __m256 max = negativeInfinity;
+
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m256 value = _mm256_loadu_ps(data + i);
+    const __m256 isFinite = _mm256_cmp_ps(_mm256_and_ps(value, absMask), maxFinite, _CMP_LE_OQ);
+    // The mask is -1 for finite values.
+    count = _mm256_sub_epi32(count, _mm256_castps_si256(isFinite));
+    const __m256 finiteValue = _mm256_and_ps(value, isFinite);
+    sumLow = _mm256_add_pd(sumLow, _mm256_cvtps_pd(_mm256_castps256_ps128(finiteValue)));
+    sumHigh = _mm256_add_pd(sumHigh, _mm256_cvtps_pd(_mm256_extractf128_ps(finiteValue, 1)));
+    min = _mm256_min_ps(min, _mm256_blendv_ps(infinity, value, isFinite));
+    max = _mm256_max_ps(max, _mm256_blendv_ps(negativeInfinity, value, isFinite));
+  }
+
+  alignas(32) int32_t counts[8];
+  alignas(32) double sums[4];
+  alignas(32) float mins[8];
+  alignas(32) float maxs[8];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(counts), count);
+  _mm256_store_pd(sums, _mm256_add_pd(sumLow, sumHigh));
+  _mm256_store_ps(mins, min);
+  _mm256_store_ps(maxs, max);
+  for (int l = 0; l < 8; ++l) {
+    statistics.count += static_cast<uint32_t>(counts[l]);
+    statistics.min = std::min(statistics.min, mins[l]);
+    statistics.max = std::max(statistics.max, maxs[l]);
+  }
+  statistics.sum += (sums[0] + sums[1]) + (sums[2] + sums[3]);
+  accumulateFiniteStatisticsScalar(data + i, size - i, statistics);
+}
+
+GRID_MAP_TARGET_AVX2 void scaleAndClampAvx2(const float* input, float* output, const size_t size, const float scale, const float offset,
+                                            const float min, const float max)
+{
+  const __m256 scaleVector = _mm256_set1_ps(scale);
+  const __m256 offsetVector = _mm256_set1_ps(offset);
+  const __m256 minVector = _mm256_set1_ps(min);
+  const __m256 maxVector = _mm256_set1_ps(max);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m256 scaled = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(input + i), scaleVector), offsetVector);
+    // NAN is passed through as second operand.
+    _mm256_storeu_ps(output + i, _mm256_min_ps(maxVector, _mm256_max_ps(minVector, scaled)));
+  }
+  scaleAndClampScalar(input + i, output + i, size - i, scale, offset, min, max);
+}
+
+GRID_MAP_TARGET_AVX2 __m256i toColorChannelAvx2(const __m256 value)
+{
+  const __m256 scaled = _mm256_mul_ps(value, _mm256_set1_ps(255.0f));
+  // NAN results in zero (second operand of max).
+  return _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(scaled, _mm256_setzero_ps()), _mm256_set1_ps(255.0f)));
+}
+
+GRID_MAP_TARGET_AVX2 void packColorsAvx2(const float* red, const float* green, const float* blue, float* output, const size_t size)
+{
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m256i r = _mm256_slli_epi32(toColorChannelAvx2(_mm256_loadu_ps(red + i)), 16);
+    const __m256i g = _mm256_slli_epi32(toColorChannelAvx2(_mm256_loadu_ps(green + i)), 8);
+    const __m256i b = toColorChannelAvx2(_mm256_loadu_ps(blue + i));
+    _mm256_storeu_ps(output + i, _mm256_castsi256_ps(_mm256_or_si256(_mm256_or_si256(r, g), b)));
+  }
+  packColorsScalar(red + i, green + i, blue + i, output + i, size - i);
+}
+
+//! Wraps unwrapped indices in [0, size) to buffer indices.
+GRID_MAP_TARGET_AVX2 __m256i wrapAvx2(const __m256i index, const __m256i start, const __m256i size, const __m256i last)
+{
+  const __m256i shifted = _mm256_add_epi32(index, start);
+  return _mm256_sub_epi32(shifted, _mm256_and_si256(_mm256_cmpgt_epi32(shifted, last), size));
+}
+
+GRID_MAP_TARGET_AVX2 void interpolateBilinearAvx2(const float* data, const Size& size, const Index& startIndex, const float* rowIndices,
+                                                  const float* columnIndices, float* output, const size_t n)
+{
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256 maxRow = _mm256_set1_ps(static_cast<float>(size(0) - 1));
+  const __m256 maxColumn = _mm256_set1_ps(static_cast<float>(size(1) - 1));
+  const __m256i lastRow = _mm256_set1_epi32(size(0) - 1);
+  const __m256i lastColumn = _mm256_set1_epi32(size(1) - 1);
+  const __m256i rowLimit = _mm256_set1_epi32(std::max(size(0) - 2, 0));
+  const __m256i columnLimit = _mm256_set1_epi32(std::max(size(1) - 2, 0));
+  const __m256i rows = _mm256_set1_epi32(size(0));
+  const __m256i columns = _mm256_set1_epi32(size(1));
+  const __m256i startRow = _mm256_set1_epi32(startIndex(0));
+  const __m256i startColumn = _mm256_set1_epi32(startIndex(1));
+  const __m256 invalid = _mm256_set1_ps(NAN);
+
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const __m256 row = _mm256_loadu_ps(rowIndices + i);
+    const __m256 column = _mm256_loadu_ps(columnIndices + i);
+    // False for NAN.
+    const __m256 isValid = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(row, zero, _CMP_GE_OQ), _mm256_cmp_ps(row, maxRow, _CMP_LE_OQ)),
+                                         _mm256_and_ps(_mm256_cmp_ps(column, zero, _CMP_GE_OQ), _mm256_cmp_ps(column, maxColumn, _CMP_LE_OQ)));
+    // Invalid queries are evaluated at index zero to keep the gathers in bounds.
+    const __m256 safeRow = _mm256_and_ps(row, isValid);
+    const __m256 safeColumn = _mm256_and_ps(column, isValid);
+    const __m256i row0 = _mm256_min_epi32(_mm256_cvttps_epi32(safeRow), rowLimit);
+    const __m256i column0 = _mm256_min_epi32(_mm256_cvttps_epi32(safeColumn), columnLimit);
+    const __m256i row1 = _mm256_min_epi32(_mm256_add_epi32(row0, one), lastRow);
+    const __m256i column1 = _mm256_min_epi32(_mm256_add_epi32(column0, one), lastColumn);
+    const __m256 rowFraction = _mm256_sub_ps(safeRow, _mm256_cvtepi32_ps(row0));
+    const __m256 columnFraction = _mm256_sub_ps(safeColumn, _mm256_cvtepi32_ps(column0));
+
+    const __m256i bufferRow0 = wrapAvx2(row0, startRow, rows, lastRow);
+    const __m256i bufferRow1 = wrapAvx2(row1, startRow, rows, lastRow);
+    const __m256i offset0 = _mm256_mullo_epi32(wrapAvx2(column0, startColumn, columns, lastColumn), rows);
+    const __m256i offset1 = _mm256_mullo_epi32(wrapAvx2(column1, startColumn, columns, lastColumn), rows);
+    const __m256 value00 = _mm256_i32gather_ps(data, _mm256_add_epi32(offset0, bufferRow0), 4);
+    const __m256 value10 = _mm256_i32gather_ps(data, _mm256_add_epi32(offset0, bufferRow1), 4);
+    const __m256 value01 = _mm256_i32gather_ps(data, _mm256_add_epi32(offset1, bufferRow0), 4);
+    const __m256 value11 = _mm256_i32gather_ps(data, _mm256_add_epi32(offset1, bufferRow1), 4);
+    const __m256 value0 = _mm256_add_ps(value00, _mm256_mul_ps(rowFraction, _mm256_sub_ps(value10, value00)));
+    const __m256 value1 = _mm256_add_ps(value01, _mm256_mul_ps(rowFraction, _mm256_sub_ps(value11, value01)));
+    const __m256 value = _mm256_add_ps(value0, _mm256_mul_ps(columnFraction, _mm256_sub_ps(value1, value0)));
+    _mm256_storeu_ps(output + i, _mm256_blendv_ps(invalid, value, isValid));
+  }
+  interpolateBilinearScalar(data, size, startIndex, rowIndices + i, columnIndices + i, output + i, n - i);
+}
+
+/*
+ * AVX-512 implementations (only for the kernels that profit from the wider registers,
+ * the others use the AVX2 implementations).
+ */
+
+//! Lower 64 bits of the products of 64 bit integers (AVX2 has no 64 bit multiplication).
+GRID_MAP_TARGET_AVX2 inline __m256i multiplyAvx2(const __m256i a, const __m256i bLow, const __m256i bHigh)
+{
+  const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), bLow), _mm256_mul_epu32(a, bHigh));
+  return _mm256_add_epi64(_mm256_mul_epu32(a, bLow), _mm256_slli_epi64(cross, 32));
+}
+
+GRID_MAP_TARGET_AVX2 void accumulateHashAvx2(const float* data, const size_t size, const uint64_t firstIndex, uint64_t& hash)
+{
+  const __m256i multiplier1Low = _mm256_set1_epi64x(static_cast<int64_t>(kHashMultiplier1 & 0xffffffff));
+  const __m256i multiplier1High = _mm256_set1_epi64x(static_cast<int64_t>(kHashMultiplier1 >> 32));
+  const __m256i multiplier2Low = _mm256_set1_epi64x(static_cast<int64_t>(kHashMultiplier2 & 0xffffffff));
+  const __m256i multiplier2High = _mm256_set1_epi64x(static_cast<int64_t>(kHashMultiplier2 >> 32));
+  const __m256i four = _mm256_set1_epi64x(4);
+  __m256i index = _mm256_add_epi64(_mm256_set1_epi64x(static_cast<int64_t>(firstIndex)), _mm256_set_epi64x(3, 2, 1, 0));
+  __m256i sum = _mm256_setzero_si256();
+
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    const __m256i bits = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+    __m256i key = _mm256_or_si256(_mm256_slli_epi64(index, 32), bits);
+    key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 33));
+    key = multiplyAvx2(key, multiplier1Low, multiplier1High);
+    key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 33));
+    key = multiplyAvx2(key, multiplier2Low, multiplier2High);
+    key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 33));
+    sum = _mm256_add_epi64(sum, key);
+    index = _mm256_add_epi64(index, four);
+  }
+
+  alignas(32) uint64_t sums[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(sums), sum);
+  hash += (sums[0] + sums[1]) + (sums[2] + sums[3]);
+  accumulateHashScalar(data + i, size - i, firstIndex + i, hash);
+}
+
+// GCC reports false positives for the undefined registers in the reduction intrinsics.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+GRID_MAP_TARGET_AVX512 void accumulateFiniteStatisticsAvx512(const float* data, const size_t size, FiniteStatistics& statistics)
+{
+  const __m512 maxFinite = _mm512_set1_ps(std::numeric_limits<float>::max());
+  __m512d sumLow = _mm512_setzero_pd();
+  __m512d sumHigh = _mm512_setzero_pd();
+  __m512 min = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+  __m512 max = _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+  size_t count = 0;
+
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m512 value = _mm512_loadu_ps(data + i);
+    const __mmask16 isFinite = _mm512_cmp_ps_mask(_mm512_abs_ps(value), maxFinite, _CMP_LE_OQ);
+    count += __builtin_popcount(isFinite);
+    const __m512 finiteValue = _mm512_maskz_mov_ps(isFinite, value);
+    sumLow = _mm512_add_pd(sumLow, _mm512_cvtps_pd(_mm512_castps512_ps256(finiteValue)));
+    sumHigh = _mm512_add_pd(sumHigh, _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(finiteValue), 1))));
+    min = _mm512_mask_min_ps(min, isFinite, min, value);
+    max = _mm512_mask_max_ps(max, isFinite, max, value);
+  }
+
+  statistics.count += count;
+  statistics.sum += _mm512_reduce_add_pd(_mm512_add_pd(sumLow, sumHigh));
+  statistics.min = std::min(statistics.min, _mm512_reduce_min_ps(min));
+  statistics.max = std::max(statistics.max, _mm512_reduce_max_ps(max));
+  accumulateFiniteStatisticsScalar(data + i, size - i, statistics);
+}
+
+GRID_MAP_TARGET_AVX512 void scaleAndClampAvx512(const float* input, float* output, const size_t size, const float scale,
+                                                const float offset, const float min, const float max)
+{
+  const __m512 scaleVector = _mm512_set1_ps(scale);
+  const __m512 offsetVector = _mm512_set1_ps(offset);
+  const __m512 minVector = _mm512_set1_ps(min);
+  const __m512 maxVector = _mm512_set1_ps(max);
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m512 scaled = _mm512_add_ps(_mm512_mul_ps(_mm512_loadu_ps(input + i), scaleVector), offsetVector);
+    // NAN is passed through as second operand.
+    _mm512_storeu_ps(output + i, _mm512_min_ps(maxVector, _mm512_max_ps(minVector, scaled)));
+  }
+  scaleAndClampScalar(input + i, output + i, size - i, scale, offset, min, max);
+}
+
+//! Lower 64 bits of the products of 64 bit integers (without AVX-512DQ).
+GRID_MAP_TARGET_AVX512 inline __m512i multiplyAvx512(const __m512i a, const __m512i bLow, const __m512i bHigh)
+{
+  const __m512i cross = _mm512_add_epi64(_mm512_mul_epu32(_mm512_srli_epi64(a, 32), bLow), _mm512_mul_epu32(a, bHigh));
+  return _mm512_add_epi64(_mm512_mul_epu32(a, bLow), _mm512_slli_epi64(cross, 32));
+}
+
+GRID_MAP_TARGET_AVX512 void accumulateHashAvx512(const float* data, const size_t size, const uint64_t firstIndex, uint64_t& hash)
+{
+  const __m512i multiplier1Low = _mm512_set1_epi64(static_cast<int64_t>(kHashMultiplier1 & 0xffffffff));
+  const __m512i multiplier1High = _mm512_set1_epi64(static_cast<int64_t>(kHashMultiplier1 >> 32));
+  const __m512i multiplier2Low = _mm512_set1_epi64(static_cast<int64_t>(kHashMultiplier2 & 0xffffffff));
+  const __m512i multiplier2High = _mm512_set1_epi64(static_cast<int64_t>(kHashMultiplier2 >> 32));
+  const __m512i eight = _mm512_set1_epi64(8);
+  __m512i index = _mm512_add_epi64(_mm512_set1_epi64(static_cast<int64_t>(firstIndex)), _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0));
+  __m512i sum = _mm512_setzero_si512();
+
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m512i bits = _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    __m512i key = _mm512_or_si512(_mm512_slli_epi64(index, 32), bits);
+    key = _mm512_xor_si512(key, _mm512_srli_epi64(key, 33));
+    key = multiplyAvx512(key, multiplier1Low, multiplier1High);
+    key = _mm512_xor_si512(key, _mm512_srli_epi64(key, 33));
+    key = multiplyAvx512(key, multiplier2Low, multiplier2High);
+    key = _mm512_xor_si512(key, _mm512_srli_epi64(key, 33));
+    sum = _mm512_add_epi64(sum, key);
+    index = _mm512_add_epi64(index, eight);
+  }
+
+  hash += static_cast<uint64_t>(_mm512_reduce_add_epi64(sum));
+  accumulateHashScalar(data + i, size - i, firstIndex + i, hash);
+}
+
+#pragma GCC diagnostic pop
+
+#endif
+
+}  // namespace
+
+bool isSupported(const InstructionSet instructionSet)
+{
+  switch (instructionSet) {
+    case InstructionSet::SCALAR:
+      return true;
+#ifdef GRID_MAP_SIMD_X86
+    case InstructionSet::AVX2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+    case InstructionSet::AVX512:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2");
+#endif
+    default:
+      return false;
+  }
+}
+
+InstructionSet getInstructionSet()
+{
+  int instructionSet = currentInstructionSet.load(std::memory_order_relaxed);
+  if (instructionSet < 0) {
+    instructionSet = static_cast<int>(detectInstructionSet());
+    currentInstructionSet.store(instructionSet, std::memory_order_relaxed);
+  }
+  return static_cast<InstructionSet>(instructionSet);
+}
+
+bool setInstructionSet(const InstructionSet instructionSet)
+{
+  if (!isSupported(instructionSet)) {
+    return false;
+  }
+  currentInstructionSet.store(static_cast<int>(instructionSet), std::memory_order_relaxed);
+  return true;
+}
+
+void accumulateFiniteStatistics(const float* data, const size_t size, FiniteStatistics& statistics)
+{
+  switch (getInstructionSet()) {
+#ifdef GRID_MAP_SIMD_X86
+    case InstructionSet::AVX512:
+      return accumulateFiniteStatisticsAvx512(data, size, statistics);
+    case InstructionSet::AVX2:
+      return accumulateFiniteStatisticsAvx2(data, size, statistics);
+#endif
+    default:
+      return accumulateFiniteStatisticsScalar(data, size, statistics);
+  }
+}
+
+FiniteStatistics computeFiniteStatistics(const float* data, const size_t size)
+{
+  FiniteStatistics statistics;
+  accumulateFiniteStatistics(data, size, statistics);
+  return statistics;
+}
+
+void scaleAndClamp(const float* input, float* output, const size_t size, const float scale, const float offset, const float min,
+                   const float max)
+{
+  switch (getInstructionSet()) {
+#ifdef GRID_MAP_SIMD_X86
+    case InstructionSet::AVX512:
+      return scaleAndClampAvx512(input, output, size, scale, offset, min, max);
+    case InstructionSet::AVX2:
+      return scaleAndClampAvx2(input, output, size, scale, offset, min, max);
+#endif
+    default:
+      return scaleAndClampScalar(input, output, size, scale, offset, min, max);
+  }
+}
+
+void packColors(const float* red, const float* green, const float* blue, float* output, const size_t size)
+{
+  switch (getInstructionSet()) {
+#ifdef GRID_MAP_SIMD_X86
+    case InstructionSet::AVX512:
+    case InstructionSet::AVX2:
+      return packColorsAvx2(red, green, blue, output, size);
+#endif
+    default:
+      return packColorsScalar(red, green, blue, output, size);
+  }
+}
+
+void interpolateBilinear(const float* data, const Size& size, const Index& startIndex, const float* rowIndices, const float* columnIndices,
+                         float* output, const size_t n)
+{
+  // The gathers use 32 bit indices.
+  const bool hasSmallIndices = static_cast<size_t>(size(0)) * static_cast<size_t>(size(1)) <= std::numeric_limits<int32_t>::max();
+  switch (hasSmallIndices ? getInstructionSet() : InstructionSet::SCALAR) {
+#ifdef GRID_MAP_SIMD_X86
+    case InstructionSet::AVX512:
+    case InstructionSet::AVX2:
+      return interpolateBilinearAvx2(data, size, startIndex, rowIndices, columnIndices, output, n);
+#endif
+    default:
+      return interpolateBilinearScalar(data, size, startIndex, rowIndices, columnIndices, output, n);
+  }
+}
+
+void accumulateHash(const float* data, const size_t size, const uint64_t firstIndex, uint64_t& hash)
+{
+  switch (getInstructionSet()) {
+#ifdef GRID_MAP_SIMD_X86
+    case InstructionSet::AVX512:
+      return accumulateHashAvx512(data, size, firstIndex, hash);
+    case InstructionSet::AVX2:
+      return accumulateHashAvx2(data, size, firstIndex, hash);
+#endif
+    default:
+      return accumulateHashScalar(data, size, firstIndex, hash);
+  }
+}
+
+}  // namespace simd
+}  // namespace grid_map
+
+namespace Eigen {
+namespace internal {
+
+// Used by the reductions of finite values of the Eigen plugins (see eigen_plugins/FunctorsPlugin.hpp).
+finite_statistics_of_floats compute_finite_statistics_of_floats(const float* data, const Index size)
+{
+  const grid_map::simd::FiniteStatistics statistics = grid_map::simd::computeFiniteStatistics(data, static_cast<size_t>(size));
+  return finite_statistics_of_floats{static_cast<Index>(statistics.count), statistics.sum, statistics.min, statistics.max};
+}
+
+}  // namespace internal
+}  // namespace Eigen
@@ -0,0 +1,220 @@
+/*
+ * SparseLayer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/SparseLayer.hpp"
+
+// STL
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace grid_map {
+
+constexpr int SparseLayer::kTileSize;
+constexpr int SparseLayer::kTileCells;
+
+SparseLayer::SparseLayer() : SparseLayer(Size::Zero()) {}
+
+SparseLayer::SparseLayer(const Size& size) : size_(Size::Zero()), nTiles_(Size::Zero()), nCells_(0)
+{
+  resize(size);
+}
+
+void SparseLayer::resize(const Size& size)
+{
+  size_ = size;
+  nTiles_ = (size + kTileSize - 1) / kTileSize;
+  tileOffsets_.assign(static_cast<size_t>(nTiles_.prod()), -1);
+  tiles_.clear();
+  freeTiles_.clear();
+  nCells_ = 0;
+}
+
+bool SparseLayer::isSet(const Index& index) const
+{
+  int cellIndex;
+  const Tile* tile = getTile(index, cellIndex);
+  return tile != nullptr && ((tile->occupancy[cellIndex / 64] >> (cellIndex % 64)) & 1u);
+}
+
+float SparseLayer::at(const Index& index) const
+{
+  int cellIndex;
+  const Tile* tile = getTile(index, cellIndex);
+  if (tile == nullptr || !((tile->occupancy[cellIndex / 64] >> (cellIndex % 64)) & 1u)) {
+    return NAN;
+  }
+  return tile->values[cellIndex];
+}
+
+float& SparseLayer::at(const Index& index)
+{
+  int cellIndex;
+  Tile& tile = getOrCreateTile(index, cellIndex);
+  uint64_t& word = tile.occupancy[cellIndex / 64];
+  const uint64_t bit = uint64_t(1) << (cellIndex % 64);
+  if (!(word & bit)) {
+    word |= bit;
+    tile.values[cellIndex] = NAN;
+    ++tile.nCells;
+    ++nCells_;
+  }
+  return tile.values[cellIndex];
+}
+
+void SparseLayer::set(const Index& index, const float value)
+{
+  at(index) = value;
+}
+
+void SparseLayer::clear(const Index& index)
+{
+  int cellIndex;
+  const size_t tileIndex = getTileIndex(index, cellIndex);
+  const int offset = tileOffsets_[tileIndex];
+  if (offset < 0) {
+    return;
+  }
+  Tile& tile = tiles_[offset];
+  uint64_t& word = tile.occupancy[cellIndex / 64];
+  const uint64_t bit = uint64_t(1) << (cellIndex % 64);
+  if (word & bit) {
+    word &= ~bit;
+    --nCells_;
+    if (--tile.nCells == 0) {
+      releaseTile(tileIndex);
+    }
+  }
+}
+
+void SparseLayer::clearBlock(const Index& index, const Size& size)
+{
+  if ((size <= 0).any()) {
+    return;
+  }
+  const Index end = index + size;
+  const Index firstTile = index / kTileSize;
+  const Index lastTile = (end - 1) / kTileSize;
+  for (int tileColumn = firstTile(1); tileColumn <= lastTile(1); ++tileColumn) {
+    for (int tileRow = firstTile(0); tileRow <= lastTile(0); ++tileRow) {
+      const size_t tileIndex = static_cast<size_t>(tileColumn) * nTiles_(0) + tileRow;
+      const int offset = tileOffsets_[tileIndex];
+      if (offset < 0) {
+        continue;
+      }
+      // Part of the block in the tile.
+      const Index tileStart(tileRow * kTileSize, tileColumn * kTileSize);
+      const Index blockStart = index.max(tileStart) - tileStart;
+      const Index blockEnd = end.min(tileStart + kTileSize) - tileStart;
+      Tile& tile = tiles_[offset];
+      if ((blockStart == 0).all() && (blockEnd == kTileSize).all()) {
+        nCells_ -= tile.nCells;
+        releaseTile(tileIndex);
+        continue;
+      }
+      for (int column = blockStart(1); column < blockEnd(1); ++column) {
+        for (int row = blockStart(0); row < blockEnd(0); ++row) {
+          const int cellIndex = column * kTileSize + row;
+          uint64_t& word = tile.occupancy[cellIndex / 64];
+          const uint64_t bit = uint64_t(1) << (cellIndex % 64);
+          if (word & bit) {
+            word &= ~bit;
+            --tile.nCells;
+            --nCells_;
+          }
+        }
+      }
+      if (tile.nCells == 0) {
+        releaseTile(tileIndex);
+      }
+    }
+  }
+}
+
+void SparseLayer::clearAll()
+{
+  resize(size_);
+}
+
+size_t SparseLayer::getMemorySize() const
+{
+  return getNumberOfTiles() * sizeof(Tile) + tileOffsets_.size() * sizeof(int);
+}
+
+void SparseLayer::toDense(Matrix& data) const
+{
+  data.setConstant(size_(0), size_(1), NAN);
+  for (size_t tileIndex = 0; tileIndex < tileOffsets_.size(); ++tileIndex) {
+    const int offset = tileOffsets_[tileIndex];
+    if (offset < 0) {
+      continue;
+    }
+    const Tile& tile = tiles_[offset];
+    const Index tileStart(static_cast<int>(tileIndex % nTiles_(0)) * kTileSize, static_cast<int>(tileIndex / nTiles_(0)) * kTileSize);
+    for (size_t word = 0; word < tile.occupancy.size(); ++word) {
+      uint64_t bits = tile.occupancy[word];
+      while (bits != 0) {
+        const int cellIndex = static_cast<int>(word * 64) + __builtin_ctzll(bits);
+        bits &= bits - 1;
+        data(tileStart(0) + cellIndex % kTileSize, tileStart(1) + cellIndex / kTileSize) = tile.values[cellIndex];
+      }
+    }
+  }
+}
+
+void SparseLayer::fromDense(const Matrix& data)
+{
+  resize(Size(data.rows(), data.cols()));
+  for (Eigen::Index column = 0; column < data.cols(); ++column) {
+    for (Eigen::Index row = 0; row < data.rows(); ++row) {
+      if (std::isfinite(data(row, column))) {
+        set(Index(row, column), data(row, column));
+      }
+    }
+  }
+}
+
+size_t SparseLayer::getTileIndex(const Index& index, int& cellIndex) const
+{
+  assert((index >= 0).all() && (index < size_).all());
+  const Index tile = index / kTileSize;
+  const Index cell = index - tile * kTileSize;
+  cellIndex = cell(1) * kTileSize + cell(0);
+  return static_cast<size_t>(tile(1)) * nTiles_(0) + tile(0);
+}
+
+const SparseLayer::Tile* SparseLayer::getTile(const Index& index, int& cellIndex) const
+{
+  const int offset = tileOffsets_[getTileIndex(index, cellIndex)];
+  return offset < 0 ? nullptr : &tiles_[offset];
+}
+
+SparseLayer::Tile& SparseLayer::getOrCreateTile(const Index& index, int& cellIndex)
+{
+  int& offset = tileOffsets_[getTileIndex(index, cellIndex)];
+  if (offset >= 0) {
+    return tiles_[offset];
+  }
+  if (freeTiles_.empty()) {
+    offset = static_cast<int>(tiles_.size());
+    tiles_.emplace_back();
+  } else {
+    offset = freeTiles_.back();
+    freeTiles_.pop_back();
+  }
+  Tile& tile = tiles_[offset];
+  tile.occupancy.fill(0);
+  tile.nCells = 0;
+  return tile;
+}
+
+void SparseLayer::releaseTile(const size_t tileIndex)
+{
+  freeTiles_.push_back(tileOffsets_[tileIndex]);
+  tileOffsets_[tileIndex] = -1;
+}
+
+}  // namespace grid_map
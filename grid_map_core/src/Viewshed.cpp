@@ -0,0 +1,153 @@
+/*
+ * Viewshed.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/Viewshed.hpp"
+#include "grid_map_core/GridMapMath.hpp"
+#include "grid_map_core/utils/parallel.hpp"
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace grid_map {
+
+namespace {
+
+/*!
+ * Sweep of one octant around the observer. An octant is parametrized by the primary index
+ * dimension `p` (along which the rings are traversed), the sign of the primary direction and
+ * the sign of the secondary direction. Cell (k, m) of the octant, with 0 <= m <= k, is the cell
+ * with unwrapped index idx(p) = observer(p) + primarySign * k, idx(1 - p) = observer(1 - p) + secondarySign * m.
+ */
+class OctantSweep
+{
+ public:
+  OctantSweep(const Matrix& elevation, Matrix& visibility, const Size& size, const Index& startIndex, const Index& observerIndex,
+              double observerElevation, double resolution, double targetHeight, double maxRange)
+      : elevation_(elevation),
+        visibility_(visibility),
+        size_(size),
+        startIndex_(startIndex),
+        observerIndex_(observerIndex),
+        observerElevation_(observerElevation),
+        resolution_(resolution),
+        targetHeight_(targetHeight),
+        maxRange_(maxRange)
+  {
+  }
+
+  void sweep(const int octant) const
+  {
+    const int p = octant / 4;
+    const int s = 1 - p;
+    const int primarySign = (octant & 1) ? -1 : 1;
+    const int secondarySign = (octant & 2) ? -1 : 1;
+
+    // Cells on the boundaries between octants are shared. Every cell is written by one octant only:
+    // The diagonal (m = k) belongs to the octants with p = 0, the axis (m = 0) to the positive secondary direction.
+    const bool writeAxis = secondarySign > 0;
+    const bool writeDiagonal = p == 0;
+
+    const int kMap = primarySign > 0 ? size_(p) - 1 - observerIndex_(p) : observerIndex_(p);
+    const int mMap = secondarySign > 0 ? size_(s) - 1 - observerIndex_(s) : observerIndex_(s);
+    const double maxRangeInCells = std::ceil(maxRange_ / resolution_);
+    const int kEnd = maxRangeInCells < kMap ? static_cast<int>(maxRangeInCells) : kMap;
+    if (kEnd < 1) {
+      return;
+    }
+
+    // Horizon (maximum slope along the line of sight) of the previous and current ring.
+    // The lowest value is used instead of -infinity such that it can be interpolated.
+    const double noHorizon = std::numeric_limits<double>::lowest();
+    std::vector<double> previous(std::min(kEnd, mMap) + 1, noHorizon);
+    std::vector<double> current(previous.size(), noHorizon);
+
+    Index index;
+    for (int k = 1; k <= kEnd; ++k) {
+      const int mEnd = std::min(k, mMap);
+      index(p) = wrap(observerIndex_(p) + primarySign * k + startIndex_(p), size_(p));
+      for (int m = 0; m <= mEnd; ++m) {
+        // Interpolate the horizon where the line of sight crosses the previous ring.
+        double horizon = noHorizon;
+        if (k > 1) {
+          const double t = static_cast<double>(m) * static_cast<double>(k - 1) / static_cast<double>(k);
+          const int m0 = static_cast<int>(t);
+          const double f = t - m0;
+          horizon = f > 0.0 ? (1.0 - f) * previous[m0] + f * previous[m0 + 1] : previous[m0];
+        }
+
+        index(s) = wrap(observerIndex_(s) + secondarySign * m + startIndex_(s), size_(s));
+        const double elevation = elevation_(index(0), index(1));
+        if (!std::isfinite(elevation)) {
+          current[m] = horizon;
+          continue;
+        }
+        const double distance = resolution_ * std::sqrt(static_cast<double>(k * k + m * m));
+        const double slope = (elevation - observerElevation_) / distance;
+        current[m] = std::max(horizon, slope);
+
+        if ((m > 0 || writeAxis) && (m < k || writeDiagonal) && distance <= maxRange_ &&
+            slope + targetHeight_ / distance >= horizon) {
+          visibility_(index(0), index(1)) = 1.0;
+        }
+      }
+      previous.swap(current);
+    }
+  }
+
+ private:
+  static int wrap(const int index, const int size) { return index >= size ? index - size : index; }
+
+  const Matrix& elevation_;
+  Matrix& visibility_;
+  const Size size_;
+  const Index startIndex_;
+  const Index observerIndex_;
+  const double observerElevation_;
+  const double resolution_;
+  const double targetHeight_;
+  const double maxRange_;
+};
+
+}  // namespace
+
+bool computeViewshed(GridMap& gridMap, const std::string& elevationLayer, const std::string& visibilityLayer,
+                     const Position& observerPosition, const double observerHeight, const double targetHeight, const double maxRange,
+                     const unsigned int numberOfThreads)
+{
+  Index observerBufferIndex;
+  if (!gridMap.getIndex(observerPosition, observerBufferIndex)) {
+    return false;
+  }
+  const Matrix& elevation = gridMap[elevationLayer];
+  const double observerTerrain = elevation(observerBufferIndex(0), observerBufferIndex(1));
+  if (!std::isfinite(observerTerrain)) {
+    return false;
+  }
+
+  if (!gridMap.exists(visibilityLayer)) {
+    gridMap.add(visibilityLayer);
+  }
+  Matrix& visibility = gridMap[visibilityLayer];
+  visibility = elevation.unaryExpr([](float value) { return std::isfinite(value) ? 0.0f : NAN; });
+  visibility(observerBufferIndex(0), observerBufferIndex(1)) = 1.0;
+
+  const Index observerIndex = getIndexFromBufferIndex(observerBufferIndex, gridMap.getSize(), gridMap.getStartIndex());
+  const OctantSweep octantSweep(elevation, visibility, gridMap.getSize(), gridMap.getStartIndex(), observerIndex,
+                                observerTerrain + observerHeight, gridMap.getResolution(), targetHeight, maxRange);
+  parallelFor(0, 8,
+              [&octantSweep](size_t begin, size_t end) {
+                for (size_t octant = begin; octant < end; ++octant) {
+                  octantSweep.sweep(static_cast<int>(octant));
+                }
+              },
+              numberOfThreads);
+  return true;
+}
+
+}  // namespace grid_map
@@ -17,6 +17,7 @@ GridMapIterator::GridMapIterator(const grid_map::GridMap& gridMap)
   startIndex_ = gridMap.getStartIndex();
   linearSize_ = size_.prod();
   linearIndex_ = 0;
+  index_.setZero();
   isPastEnd_ = false;
 }
 
@@ -26,6 +27,7 @@ GridMapIterator::GridMapIterator(const GridMapIterator* other)
   startIndex_ = other->startIndex_;
   linearSize_ = other->linearSize_;
   linearIndex_ = other->linearIndex_;
+  index_ = other->index_;
   isPastEnd_ = other->isPastEnd_;
 }
 
@@ -34,9 +36,9 @@ bool GridMapIterator::operator !=(const GridMapIterator& other) const
   return linearIndex_ != other.linearIndex_;
 }
 
-Index GridMapIterator::operator *() const
+const Index& GridMapIterator::operator *() const
 {
-  return getIndexFromLinearIndex(linearIndex_, size_);
+  return index_;
 }
 
 const size_t& GridMapIterator::getLinearIndex() const
@@ -54,6 +56,11 @@ GridMapIterator& GridMapIterator::operator ++()
   size_t newIndex = linearIndex_ + 1;
   if (newIndex < linearSize_) {
     linearIndex_ = newIndex;
+    // Step down the column, the data is stored in column-major order.
+    if (++index_(0) >= size_(0)) {
+      index_(0) = 0;
+      ++index_(1);
+    }
   } else {
     isPastEnd_ = true;
   }
@@ -64,6 +71,7 @@ GridMapIterator GridMapIterator::end() const
 {
   GridMapIterator res(this);
   res.linearIndex_ = linearSize_ - 1;
+  res.index_ = size_ - Index::Ones();
   return res;
 }
 
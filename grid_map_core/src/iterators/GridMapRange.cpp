@@ -0,0 +1,119 @@
+/*
+ * GridMapRange.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/iterators/GridMapRange.hpp"
+#include "grid_map_core/GridMapMath.hpp"
+
+#include <algorithm>
+
+namespace grid_map {
+
+GridMapRangeIterator::GridMapRangeIterator()
+    : bufferSize_(Size::Zero()),
+      bufferStartIndex_(Index::Zero()),
+      submapStartIndex_(Index::Zero()),
+      submapSize_(Size::Zero()),
+      index_(Index::Zero()),
+      submapIndex_(Index::Zero()),
+      position_(0)
+{
+}
+
+GridMapRangeIterator::GridMapRangeIterator(const Size& bufferSize, const Index& bufferStartIndex, const Index& submapStartIndex,
+                                           const Size& submapSize, difference_type position)
+    : bufferSize_(bufferSize),
+      bufferStartIndex_(bufferStartIndex),
+      submapStartIndex_(submapStartIndex),
+      submapSize_(submapSize),
+      index_(submapStartIndex),
+      submapIndex_(Index::Zero()),
+      position_(0)
+{
+  *this += position;
+}
+
+GridMapRangeIterator& GridMapRangeIterator::operator+=(difference_type offset)
+{
+  position_ += offset;
+  if (submapSize_(0) <= 0) {
+    return *this;
+  }
+  const difference_type rows = submapSize_(0);
+  submapIndex_(0) = static_cast<int>(position_ % rows);
+  submapIndex_(1) = static_cast<int>(position_ / rows);
+  if (submapIndex_(0) < 0) {
+    submapIndex_(0) += static_cast<int>(rows);
+    --submapIndex_(1);
+  }
+  index_ = submapStartIndex_ + submapIndex_;
+  wrapIndexToRange(index_, bufferSize_);
+  return *this;
+}
+
+Index GridMapRangeIterator::getUnwrappedIndex() const
+{
+  return getIndexFromBufferIndex(index_, bufferSize_, bufferStartIndex_);
+}
+
+GridMapRange::GridMapRange(const GridMap& gridMap)
+    : GridMapRange(gridMap, Index::Zero(), gridMap.getSize())
+{
+}
+
+GridMapRange::GridMapRange(const SubmapGeometry& submap)
+    : GridMapRange(submap.getGridMap(), submap.getStartIndex(), submap.getSize())
+{
+}
+
+GridMapRange::GridMapRange(const GridMap& gridMap, const BufferRegion& bufferRegion)
+    : GridMapRange(gridMap, bufferRegion.getStartIndex(), bufferRegion.getSize())
+{
+}
+
+GridMapRange::GridMapRange(const GridMap& gridMap, const Index& submapStartIndex, const Size& submapSize)
+    : bufferSize_(gridMap.getSize()),
+      bufferStartIndex_(gridMap.getStartIndex()),
+      submapStartIndex_(submapStartIndex),
+      submapSize_(submapSize),
+      first_(0),
+      last_(static_cast<difference_type>(submapSize.prod()))
+{
+}
+
+GridMapRange::iterator GridMapRange::begin() const
+{
+  return iterator(bufferSize_, bufferStartIndex_, submapStartIndex_, submapSize_, first_);
+}
+
+GridMapRange::iterator GridMapRange::end() const
+{
+  return iterator(bufferSize_, bufferStartIndex_, submapStartIndex_, submapSize_, last_);
+}
+
+GridMapRange GridMapRange::subrange(difference_type first, difference_type last) const
+{
+  GridMapRange range(*this);
+  range.first_ = std::min(first_ + std::max<difference_type>(first, 0), last_);
+  range.last_ = std::max(range.first_, std::min(first_ + last, last_));
+  return range;
+}
+
+std::vector<GridMapRange> GridMapRange::split(size_t numberOfParts) const
+{
+  std::vector<GridMapRange> parts;
+  const auto numberOfCells = static_cast<difference_type>(size());
+  const auto n = static_cast<difference_type>(std::max<size_t>(std::min<size_t>(numberOfParts, size()), 1));
+  parts.reserve(n);
+  for (difference_type i = 0; i < n; ++i) {
+    GridMapRange part = subrange(i * numberOfCells / n, (i + 1) * numberOfCells / n);
+    if (!part.empty()) {
+      parts.push_back(part);
+    }
+  }
+  return parts;
+}
+
+}  // namespace grid_map
@@ -14,7 +14,8 @@
 namespace grid_map {
 
 PolygonIterator::PolygonIterator(const grid_map::GridMap& gridMap, const grid_map::Polygon& polygon)
-    : polygon_(polygon)
+    : polygon_(polygon),
+      preparedPolygon_(polygon, polygon.nVertices() > kMinVerticesForEdgeIndex)
 {
   mapLength_ = gridMap.getLength();
   mapPosition_ = gridMap.getPosition();
@@ -65,7 +66,7 @@ bool PolygonIterator::isInside() const
 {
   Position position;
   getPositionFromIndex(position, *(*internalIterator_), mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
-  return polygon_.isInside(position);
+  return preparedPolygon_.isInside(position);
 }
 
 void PolygonIterator::findSubmapParameters(const grid_map::Polygon& /*polygon*/, Index& startIndex, Size& bufferSize) const
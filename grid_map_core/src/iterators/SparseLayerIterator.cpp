@@ -0,0 +1,78 @@
+/*
+ * SparseLayerIterator.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/iterators/SparseLayerIterator.hpp"
+
+namespace grid_map {
+
+SparseLayerIterator::SparseLayerIterator(const SparseLayer& layer)
+    : layer_(layer), tileIndex_(0), wordIndex_(0), bits_(0), cellIndex_(0), index_(Index::Zero()), isPastEnd_(false)
+{
+  if (layer_.tileOffsets_.empty()) {
+    isPastEnd_ = true;
+    return;
+  }
+  if (layer_.tileOffsets_[0] >= 0) {
+    bits_ = layer_.tiles_[layer_.tileOffsets_[0]].occupancy[0];
+  }
+  findNextCell();
+}
+
+SparseLayerIterator::SparseLayerIterator(const GridMap& gridMap, const std::string& layer)
+    : SparseLayerIterator(gridMap.getSparse(layer))
+{
+}
+
+const Index& SparseLayerIterator::operator*() const
+{
+  return index_;
+}
+
+float SparseLayerIterator::getValue() const
+{
+  return layer_.tiles_[layer_.tileOffsets_[tileIndex_]].values[cellIndex_];
+}
+
+SparseLayerIterator& SparseLayerIterator::operator++()
+{
+  findNextCell();
+  return *this;
+}
+
+bool SparseLayerIterator::isPastEnd() const
+{
+  return isPastEnd_;
+}
+
+void SparseLayerIterator::findNextCell()
+{
+  constexpr size_t nWords = SparseLayer::kTileCells / 64;
+  const auto& offsets = layer_.tileOffsets_;
+  while (bits_ == 0) {
+    // Next word of the tile, or the first word of the next allocated tile.
+    if (offsets[tileIndex_] >= 0 && ++wordIndex_ < nWords) {
+      bits_ = layer_.tiles_[offsets[tileIndex_]].occupancy[wordIndex_];
+      continue;
+    }
+    do {
+      ++tileIndex_;
+    } while (tileIndex_ < offsets.size() && offsets[tileIndex_] < 0);
+    if (tileIndex_ >= offsets.size()) {
+      isPastEnd_ = true;
+      return;
+    }
+    wordIndex_ = 0;
+    bits_ = layer_.tiles_[offsets[tileIndex_]].occupancy[0];
+  }
+
+  cellIndex_ = static_cast<int>(wordIndex_ * 64) + __builtin_ctzll(bits_);
+  bits_ &= bits_ - 1;
+  const int nTileRows = layer_.nTiles_(0);
+  index_(0) = static_cast<int>(tileIndex_ % nTileRows) * SparseLayer::kTileSize + cellIndex_ % SparseLayer::kTileSize;
+  index_(1) = static_cast<int>(tileIndex_ / nTileRows) * SparseLayer::kTileSize + cellIndex_ / SparseLayer::kTileSize;
+}
+
+}  // namespace grid_map
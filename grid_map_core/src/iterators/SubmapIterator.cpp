@@ -65,8 +65,22 @@ const Index& SubmapIterator::getSubmapIndex() const
 
 SubmapIterator& SubmapIterator::operator ++()
 {
-  isPastEnd_ = !incrementIndexForSubmap(submapIndex_, index_, submapStartIndex_,
-                                        submapSize_, size_, startIndex_);
+  // Step along the row of the submap and wrap the buffer index when it leaves the buffer.
+  if (submapIndex_(1) + 1 < submapSize_(1)) {
+    ++submapIndex_(1);
+    if (++index_(1) >= size_(1)) {
+      index_(1) = 0;
+    }
+  } else if (submapIndex_(0) + 1 < submapSize_(0)) {
+    ++submapIndex_(0);
+    submapIndex_(1) = 0;
+    index_(1) = submapStartIndex_(1);
+    if (++index_(0) >= size_(0)) {
+      index_(0) = 0;
+    }
+  } else {
+    isPastEnd_ = true;
+  }
   return *this;
 }
 
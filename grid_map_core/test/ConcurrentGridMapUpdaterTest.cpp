@@ -0,0 +1,134 @@
+/*
+ * ConcurrentGridMapUpdaterTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/ConcurrentGridMapUpdater.hpp"
+#include "grid_map_core/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+GridMap createMap()
+{
+  GridMap map({"elevation"});
+  map.setGeometry(Length(4.0, 3.0), 0.05, Position(0.3, -0.2));
+  map.move(Position(0.87, 0.41)); // Non-default start index.
+  return map;
+}
+
+//! Random points, partly outside of the map.
+std::vector<Eigen::Matrix3Xf> createBatches(int nBatches, int nPoints)
+{
+  std::vector<Eigen::Matrix3Xf> batches;
+  for (int i = 0; i < nBatches; ++i) {
+    Eigen::Matrix3Xf points = Eigen::Matrix3Xf::Random(3, nPoints);
+    points.row(0) = points.row(0).array() * 3.0f + 0.87f;
+    points.row(1) = points.row(1).array() * 2.0f + 0.41f;
+    batches.push_back(points);
+  }
+  return batches;
+}
+
+template <typename Reducer>
+void updateSerial(GridMap& map, const std::vector<Eigen::Matrix3Xf>& batches, const Reducer& reducer)
+{
+  for (const auto& points : batches) {
+    for (Eigen::Index i = 0; i < points.cols(); ++i) {
+      Index index;
+      if (map.getIndex(Position(points(0, i), points(1, i)), index)) {
+        reducer(map.at("elevation", index), points(2, i));
+      }
+    }
+  }
+}
+
+void expectEqual(const Matrix& expected, const Matrix& actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (Eigen::Index i = 0; i < expected.size(); ++i) {
+    if (std::isnan(expected(i))) {
+      EXPECT_TRUE(std::isnan(actual(i)));
+    } else {
+      EXPECT_EQ(expected(i), actual(i));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ConcurrentGridMapUpdater, Tiles)
+{
+  GridMap map = createMap(); // 80 x 60 cells.
+  ConcurrentGridMapUpdater updater(map, Size(32, 32));
+  EXPECT_EQ(3, updater.getNumberOfTiles()(0));
+  EXPECT_EQ(2, updater.getNumberOfTiles()(1));
+  EXPECT_EQ(1, updater.getTileIndex(Index(32, 31))(0));
+  EXPECT_EQ(0, updater.getTileIndex(Index(32, 31))(1));
+  EXPECT_EQ(2, updater.getTileIndex(Index(79, 59))(0));
+  EXPECT_EQ(1, updater.getTileIndex(Index(79, 59))(1));
+  auto lock = updater.lockTile(Index(2, 1));
+  EXPECT_TRUE(lock.owns_lock());
+}
+
+TEST(ConcurrentGridMapUpdater, SameAsSerial)
+{
+  const auto batches = createBatches(16, 2000);
+  GridMap expectedMap = createMap();
+  updateSerial(expectedMap, batches, MaxReducer());
+
+  GridMap map = createMap();
+  ConcurrentGridMapUpdater updater(map, Size(16, 16));
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = t; i < batches.size(); i += 4) {
+        updater.update("elevation", batches[i], MaxReducer());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  expectEqual(expectedMap["elevation"], map["elevation"]);
+}
+
+TEST(ConcurrentGridMapUpdater, Atomic)
+{
+  const auto batches = createBatches(8, 2000);
+  GridMap expectedMap = createMap();
+  updateSerial(expectedMap, batches, MinReducer());
+
+  GridMap map = createMap();
+  ConcurrentGridMapUpdater updater(map);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = t; i < batches.size(); i += 4) {
+        updater.updateAtomic("elevation", batches[i], false);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  expectEqual(expectedMap["elevation"], map["elevation"]);
+
+  float value = NAN;
+  atomicMax(value, 1.0f);
+  EXPECT_EQ(1.0f, value);
+  atomicMax(value, 0.5f);
+  EXPECT_EQ(1.0f, value);
+  atomicMin(value, 0.5f);
+  EXPECT_EQ(0.5f, value);
+}
@@ -14,6 +14,11 @@
 // Eigen
 #include <Eigen/Core>
 
+// STL
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 using Eigen::Matrix;
 
 TEST(EigenMatrixBaseAddons, numberOfFinites)
@@ -100,6 +105,44 @@ TEST(EigenMatrixBaseAddons, maxCoeffOfFinites)
   EXPECT_NEAR(-1.0, matrix.maxCoeffOfFinites(), 1e-10);
 }
 
+TEST(EigenMatrixBaseAddons, reductionsOfFloatLayers)
+{
+  Eigen::MatrixXf matrix(Eigen::MatrixXf::Random(37, 23));
+  matrix(3, 4) = NAN;
+  matrix(20, 0) = INFINITY;
+  matrix(36, 22) = -INFINITY;
+
+  // Contiguous float data (matrix, column) uses the SIMD kernels, a block with a stride the plain reductions.
+  const std::vector<Eigen::MatrixXf> parts{matrix, matrix.col(4), matrix.block(1, 0, 20, 23)};
+  EXPECT_EQ(matrix.block(1, 0, 20, 23).minCoeffOfFinites(), parts[2].minCoeffOfFinites());
+  EXPECT_EQ(matrix.block(1, 0, 20, 23).maxCoeffOfFinites(), parts[2].maxCoeffOfFinites());
+  EXPECT_NEAR(matrix.block(1, 0, 20, 23).sumOfFinites(), parts[2].sumOfFinites(), 1e-4);
+  for (const auto& part : parts) {
+    double sum = 0.0;
+    float min = INFINITY;
+    float max = -INFINITY;
+    for (Eigen::Index i = 0; i < part.size(); ++i) {
+      if (!std::isfinite(part(i))) {
+        continue;
+      }
+      sum += part(i);
+      min = std::min(min, part(i));
+      max = std::max(max, part(i));
+    }
+    EXPECT_NEAR(sum, part.sumOfFinites(), 1e-4);
+    EXPECT_EQ(min, part.minCoeffOfFinites());
+    EXPECT_EQ(max, part.maxCoeffOfFinites());
+  }
+
+  // Without finite values, same results as the plain reductions.
+  matrix.setConstant(NAN);
+  EXPECT_TRUE(std::isnan(matrix.sumOfFinites()));
+  EXPECT_TRUE(std::isnan(matrix.minCoeffOfFinites()));
+  EXPECT_TRUE(std::isnan(matrix.maxCoeffOfFinites()));
+  matrix.setConstant(INFINITY);
+  EXPECT_EQ(INFINITY, matrix.maxCoeffOfFinites());
+}
+
 TEST(EigenMatrixBaseAddons, clamp)
 {
   Eigen::VectorXf vector(Eigen::VectorXf::LinSpaced(9, 1.0, 9.0));
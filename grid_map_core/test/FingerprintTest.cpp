@@ -0,0 +1,125 @@
+/*
+ * FingerprintTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/Fingerprint.hpp"
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/GridMapMath.hpp"
+#include "grid_map_core/SimdKernels.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+GridMap createMap()
+{
+  GridMap map({"elevation", "variance"});
+  map.setGeometry(Length(5.03, 4.01), 0.1, Position(0.2, -0.1));
+  map.move(Position(1.33, 0.71)); // Non-default start index.
+  map["elevation"].setRandom();
+  map["variance"].setRandom();
+  for (int i = 0; i < map.getSize().prod(); i += 7) {
+    map["elevation"](i) = NAN;
+  }
+  return map;
+}
+
+}  // namespace
+
+TEST(Fingerprint, IndependentOfStartIndex)
+{
+  const GridMap map = createMap();
+  ASSERT_FALSE(map.getStartIndex().isZero());
+  GridMap normalizedMap = map;
+  normalizedMap.convertToDefaultStartIndex();
+
+  EXPECT_EQ(computeFingerprint(map, "elevation"), computeFingerprint(normalizedMap, "elevation"));
+  EXPECT_NE(computeFingerprint(map, "elevation"), computeFingerprint(map, "variance"));
+  const TileFingerprints tiles = computeTileFingerprints(map, "elevation", 16);
+  EXPECT_EQ(4, tiles.rows());  // 50 x 40 cells.
+  EXPECT_EQ(3, tiles.cols());
+  EXPECT_TRUE(tiles == computeTileFingerprints(normalizedMap, "elevation", 16));
+
+  // The same for all instruction sets.
+  const simd::InstructionSet instructionSet = simd::getInstructionSet();
+  ASSERT_TRUE(simd::setInstructionSet(simd::InstructionSet::SCALAR));
+  const Fingerprint scalarFingerprint = computeFingerprint(map, "elevation");
+  simd::setInstructionSet(instructionSet);
+  EXPECT_EQ(scalarFingerprint, computeFingerprint(map, "elevation"));
+}
+
+TEST(Fingerprint, DetectsChangedTiles)
+{
+  GridMap map = createMap();
+  const Fingerprint fingerprint = computeFingerprint(map, "elevation");
+  const TileFingerprints tiles = computeTileFingerprints(map, "elevation", 16);
+
+  // Change one cell (buffer index).
+  const Index index(20, 37);
+  const float value = map.at("elevation", index);
+  map.at("elevation", index) = value + 1.0;
+  EXPECT_NE(fingerprint, computeFingerprint(map, "elevation"));
+  const Index unwrappedIndex = getIndexFromBufferIndex(index, map.getSize(), map.getStartIndex());
+  const TileFingerprints changedTiles = computeTileFingerprints(map, "elevation", 16);
+  for (int i = 0; i < tiles.rows(); ++i) {
+    for (int j = 0; j < tiles.cols(); ++j) {
+      const bool isChangedTile = i == unwrappedIndex(0) / 16 && j == unwrappedIndex(1) / 16;
+      EXPECT_EQ(isChangedTile, tiles(i, j) != changedTiles(i, j)) << "Tile: " << i << ", " << j;
+    }
+  }
+
+  // Swap two cells, the fingerprint depends on the positions of the values.
+  map.at("elevation", index) = value;
+  ASSERT_EQ(fingerprint, computeFingerprint(map, "elevation"));
+  const Fingerprint variance = computeFingerprint(map, "variance");
+  std::swap(map.at("variance", Index(0, 0)), map.at("variance", Index(1, 0)));
+  EXPECT_NE(variance, computeFingerprint(map, "variance"));
+}
+
+TEST(Fingerprint, BufferTilesAfterMove)
+{
+  GridMap map = createMap();
+  const int tileSize = 16;
+  const TileFingerprints tiles = computeTileFingerprints(map["elevation"], Index::Zero(), tileSize);
+  std::vector<BufferRegion> newRegions;
+  map.move(map.getPosition() + Position(0.3, 0.0), newRegions);
+  ASSERT_FALSE(newRegions.empty());
+  for (const auto& newRegion : newRegions) {
+    map["elevation"]
+        .block(newRegion.getStartIndex()(0), newRegion.getStartIndex()(1), newRegion.getSize()(0), newRegion.getSize()(1))
+        .setRandom();
+  }
+
+  const TileFingerprints movedTiles = computeTileFingerprints(map["elevation"], Index::Zero(), tileSize);
+  for (int i = 0; i < tiles.rows(); ++i) {
+    for (int j = 0; j < tiles.cols(); ++j) {
+      const Index tileIndex = Index(i, j) * tileSize;
+      const Index tileEnd = (tileIndex + tileSize).min(map.getSize());
+      bool isNewRegion = false;
+      for (const auto& newRegion : newRegions) {
+        const Index& index = newRegion.getStartIndex();
+        isNewRegion |= (tileIndex < index + newRegion.getSize()).all() && (index < tileEnd).all();
+      }
+      EXPECT_EQ(isNewRegion, tiles(i, j) != movedTiles(i, j)) << "Tile: " << i << ", " << j;
+    }
+  }
+}
+
+TEST(Fingerprint, Combine)
+{
+  const GridMap map = createMap();
+  const Fingerprint elevation = computeFingerprint(map, "elevation");
+  const Fingerprint variance = computeFingerprint(map, "variance");
+  EXPECT_EQ(combineFingerprints(elevation, variance), combineFingerprints(elevation, variance));
+  EXPECT_NE(combineFingerprints(elevation, variance), combineFingerprints(variance, elevation));
+}
@@ -0,0 +1,91 @@
+/*
+ * ForEachCellTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/ForEachCell.hpp"
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/iterators/GridMapIterator.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <stdexcept>
+
+using namespace grid_map;
+
+namespace {
+
+GridMap createMap()
+{
+  GridMap map({"elevation", "variance", "result"});
+  map.setGeometry(Length(4.0, 3.0), 0.01);
+  map.move(Position(0.52, -0.27));  // Non-default start index.
+  map["elevation"].setRandom();
+  map["variance"].setRandom();
+  map["variance"] = map["variance"].cwiseAbs();
+  map["result"].setZero();
+  return map;
+}
+
+void addVariance(float& elevation, float variance)
+{
+  elevation += variance;
+}
+
+}  // namespace
+
+TEST(ForEachCell, ReadWrite)
+{
+  GridMap map = createMap();
+  const GridMap original(map);
+  forEachCell(map, [](float& result, const float& elevation, float variance) { result = elevation - 2.0f * variance; }, "result",
+              "elevation", "variance");
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    EXPECT_FLOAT_EQ(original.at("elevation", *iterator) - 2.0f * original.at("variance", *iterator), map.at("result", *iterator));
+    EXPECT_EQ(original.at("elevation", *iterator), map.at("elevation", *iterator));
+  }
+
+  // Function pointer and several writable layers.
+  forEachCell(map, &addVariance, "elevation", "variance");
+  forEachCell(map, [](float& elevation, float& variance) { std::swap(elevation, variance); }, "elevation", "variance");
+  EXPECT_TRUE(map["variance"].isApprox(original["elevation"] + original["variance"]));
+  EXPECT_TRUE(map["elevation"].isApprox(original["variance"]));
+}
+
+TEST(ForEachCell, ReadOnly)
+{
+  const GridMap map = createMap();
+  double sum = 0.0;
+  size_t count = 0;
+  // Mutable lambda on a const map.
+  forEachCell(map, [&sum, count](const float& elevation, float variance) mutable {
+    sum += elevation * variance;
+    ++count;
+  }, "elevation", "variance");
+  EXPECT_NEAR((map["elevation"].cast<double>().cwiseProduct(map["variance"].cast<double>())).sum(), sum, 1e-6 * map.getSize().prod());
+  EXPECT_THROW(forEachCell(map, [](float) {}, "invalid"), std::out_of_range);
+}
+
+TEST(ForEachCell, Policies)
+{
+  const GridMap original = createMap();
+  const auto function = [](float& result, float elevation, float variance) { result = elevation > 0.0f ? elevation * variance : variance; };
+
+  GridMap serial(original);
+  forEachCell(SerialExecution(), serial, function, "result", "elevation", "variance");
+  GridMap block(original);
+  forEachCell(BlockExecution<64>(), block, function, "result", "elevation", "variance");
+  GridMap parallel(original);
+  forEachCell(ParallelExecution(4, 1000), parallel, function, "result", "elevation", "variance");
+
+  GridMap expected(original);
+  for (GridMapIterator iterator(expected); !iterator.isPastEnd(); ++iterator) {
+    function(expected.at("result", *iterator), expected.at("elevation", *iterator), expected.at("variance", *iterator));
+  }
+  EXPECT_TRUE((expected["result"].array() == serial["result"].array()).all());
+  EXPECT_TRUE((expected["result"].array() == block["result"].array()).all());
+  EXPECT_TRUE((expected["result"].array() == parallel["result"].array()).all());
+}
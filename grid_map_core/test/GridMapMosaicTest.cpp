@@ -0,0 +1,201 @@
+/*
+ * GridMapMosaicTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/GridMapMosaic.hpp"
+#include "grid_map_core/iterators/GridMapIterator.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+GridMap createMap(const Length& length, const Position& position, const Time timestamp)
+{
+  GridMap map({"elevation", "weight"});
+  map.setFrameId("map");
+  map.setGeometry(length, 0.1, position);
+  map.setTimestamp(timestamp);
+  map["elevation"].setRandom();
+  map["weight"].setRandom();
+  map["weight"] = map["weight"].array().abs();
+  for (Eigen::Index i = 0; i < map["elevation"].size(); i += 7) {
+    map["elevation"](i) = NAN;
+  }
+  return map;
+}
+
+std::vector<GridMap> createMaps()
+{
+  std::vector<GridMap> maps;
+  maps.push_back(createMap(Length(4.0, 3.0), Position(0.0, 0.0), 30));
+  maps.push_back(createMap(Length(3.0, 3.0), Position(2.5, 1.0), 10));
+  maps.push_back(createMap(Length(2.0, 5.0), Position(-1.0, -0.5), 20));
+  // Non-default start index.
+  maps.back().move(Position(-0.7, -0.3));
+  maps.back()["elevation"].setRandom();
+  return maps;
+}
+
+std::vector<const GridMap*> getPointers(const std::vector<GridMap>& maps)
+{
+  std::vector<const GridMap*> pointers;
+  for (const auto& map : maps) {
+    pointers.push_back(&map);
+  }
+  return pointers;
+}
+
+}  // namespace
+
+TEST(GridMapMosaic, Geometry)
+{
+  const std::vector<GridMap> maps = createMaps();
+  GridMap result;
+  ASSERT_TRUE(mosaic(getPointers(maps), result));
+  EXPECT_EQ("map", result.getFrameId());
+  EXPECT_EQ(30u, result.getTimestamp());
+  EXPECT_TRUE(result.exists("elevation"));
+  EXPECT_TRUE(result.exists("weight"));
+  EXPECT_DOUBLE_EQ(0.1, result.getResolution());
+
+  // All cells of the maps are covered, and the mosaic is not larger than needed.
+  for (const auto& map : maps) {
+    for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+      Position position;
+      map.getPosition(*iterator, position);
+      EXPECT_TRUE(result.isInside(position));
+    }
+  }
+  EXPECT_NEAR(6.0, result.getLength().x(), 1e-6);
+  EXPECT_NEAR(5.3, result.getLength().y(), 1e-6);
+}
+
+TEST(GridMapMosaic, OverwriteByTimestamp)
+{
+  const std::vector<GridMap> maps = createMaps();
+  GridMap result;
+  MosaicOptions options;
+  options.layers = {"elevation"};
+  options.tileColumns = 7;
+  ASSERT_TRUE(mosaic(getPointers(maps), result, options));
+  EXPECT_FALSE(result.exists("weight"));
+
+  // Sequential reference, in order of the timestamps.
+  GridMap expected = result;
+  expected["elevation"].setConstant(NAN);
+  for (const size_t i : {1, 2, 0}) {
+    for (GridMapIterator iterator(maps[i]); !iterator.isPastEnd(); ++iterator) {
+      const float value = maps[i].at("elevation", *iterator);
+      Position position;
+      maps[i].getPosition(*iterator, position);
+      if (std::isfinite(value)) {
+        expected.atPosition("elevation", position) = value;
+      }
+    }
+  }
+  for (Eigen::Index i = 0; i < expected["elevation"].size(); ++i) {
+    const float value = expected["elevation"](i);
+    if (std::isnan(value)) {
+      EXPECT_TRUE(std::isnan(result["elevation"](i)));
+    } else {
+      EXPECT_EQ(value, result["elevation"](i));
+    }
+  }
+}
+
+TEST(GridMapMosaic, MaxAndWeightedMean)
+{
+  const std::vector<GridMap> maps = createMaps();
+  GridMap maxResult, meanResult;
+  MosaicOptions options;
+  options.layers = {"elevation"};
+  options.policy = MosaicPolicy::MAX;
+  ASSERT_TRUE(mosaic(getPointers(maps), maxResult, options));
+  options.policy = MosaicPolicy::WEIGHTED_MEAN;
+  options.weightLayer = "weight";
+  ASSERT_TRUE(mosaic(getPointers(maps), meanResult, options));
+
+  for (GridMapIterator iterator(maxResult); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    maxResult.getPosition(*iterator, position);
+    float maximum = NAN;
+    double sum = 0.0;
+    double weightSum = 0.0;
+    for (const auto& map : maps) {
+      if (!map.isInside(position)) {
+        continue;
+      }
+      const float value = map.atPosition("elevation", position);
+      const float weight = map.atPosition("weight", position);
+      if (!std::isfinite(value)) {
+        continue;
+      }
+      if (!(maximum >= value)) {
+        maximum = value;
+      }
+      if (weight > 0.0f) {
+        sum += weight * value;
+        weightSum += weight;
+      }
+    }
+    if (std::isnan(maximum)) {
+      EXPECT_TRUE(std::isnan(maxResult.at("elevation", *iterator)));
+    } else {
+      EXPECT_EQ(maximum, maxResult.at("elevation", *iterator));
+    }
+    if (weightSum > 0.0) {
+      EXPECT_NEAR(sum / weightSum, meanResult.at("elevation", *iterator), 1e-4);
+    } else {
+      EXPECT_TRUE(std::isnan(meanResult.at("elevation", *iterator)));
+    }
+  }
+}
+
+TEST(GridMapMosaic, SameResultForAnyNumberOfThreads)
+{
+  const std::vector<GridMap> maps = createMaps();
+  for (const auto policy : {MosaicPolicy::OVERWRITE_BY_TIMESTAMP, MosaicPolicy::MAX, MosaicPolicy::WEIGHTED_MEAN}) {
+    MosaicOptions options;
+    options.policy = policy;
+    options.weightLayer = "weight";
+    options.numberOfThreads = 1;
+    GridMap serial, parallel;
+    ASSERT_TRUE(mosaic(getPointers(maps), serial, options));
+    options.numberOfThreads = 4;
+    options.tileColumns = 3;
+    ASSERT_TRUE(mosaic(getPointers(maps), parallel, options));
+    for (const auto& layer : serial.getLayers()) {
+      for (Eigen::Index i = 0; i < serial[layer].size(); ++i) {
+        if (std::isnan(serial[layer](i))) {
+          EXPECT_TRUE(std::isnan(parallel[layer](i)));
+        } else {
+          EXPECT_EQ(serial[layer](i), parallel[layer](i));
+        }
+      }
+    }
+  }
+}
+
+TEST(GridMapMosaic, InvalidInput)
+{
+  GridMap result;
+  EXPECT_FALSE(mosaic({}, result));
+
+  std::vector<GridMap> maps = createMaps();
+  maps[1].setFrameId("odom");
+  EXPECT_FALSE(mosaic(getPointers(maps), result));
+
+  maps = createMaps();
+  maps[2].setGeometry(Length(2.0, 2.0), 0.2);
+  EXPECT_FALSE(mosaic(getPointers(maps), result));
+}
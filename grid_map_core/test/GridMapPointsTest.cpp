@@ -0,0 +1,76 @@
+/*
+ * GridMapPointsTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/GridMapPoints.hpp"
+#include "grid_map_core/iterators/GridMapIterator.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+
+using namespace grid_map;
+
+namespace {
+
+GridMap createMap()
+{
+  GridMap map({"elevation", "mask", "color"});
+  map.setGeometry(Length(30.0, 20.0), 0.05, Position(1.2, -3.4));
+  map.move(Position(3.37, -1.91)); // Non-default start index.
+  map["elevation"].setRandom();
+  map["mask"].setZero();
+  map["color"].setRandom();
+  for (Eigen::Index i = 0; i < map["elevation"].size(); i += 3) {
+    map["elevation"](i) = NAN;
+  }
+  for (Eigen::Index i = 0; i < map["mask"].size(); i += 5) {
+    map["mask"](i) = NAN;
+  }
+  return map;
+}
+
+}  // namespace
+
+TEST(GridMapPoints, SameAsGetPosition3)
+{
+  const GridMap map = createMap();
+  for (const unsigned int nThreads : {1u, 4u}) {
+    Eigen::Matrix3Xf points;
+    PointChannels channels;
+    const size_t nPoints = toPoints(map, "elevation", {"color", "mask"}, points, channels, "", nThreads);
+    ASSERT_EQ(nPoints, static_cast<size_t>(points.cols()));
+    ASSERT_EQ(2, channels.rows());
+
+    size_t point = 0;
+    for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+      Position3 position;
+      if (!map.getPosition3("elevation", *iterator, position)) {
+        continue;
+      }
+      ASSERT_LT(point, nPoints);
+      ASSERT_EQ(position.cast<float>(), points.col(point));
+      ASSERT_EQ(map.at("color", *iterator), channels(0, point));
+      ++point;
+    }
+    EXPECT_EQ(point, nPoints);
+  }
+}
+
+TEST(GridMapPoints, Mask)
+{
+  const GridMap map = createMap();
+  Eigen::Matrix3Xf points;
+  const size_t nPoints = toPoints(map, "elevation", points, "mask");
+  size_t nExpected = 0;
+  for (Eigen::Index i = 0; i < map["elevation"].size(); ++i) {
+    nExpected += std::isfinite(map["elevation"](i)) && std::isfinite(map["mask"](i));
+  }
+  EXPECT_EQ(nExpected, nPoints);
+  EXPECT_THROW(toPoints(map, "nonexisting", points), std::out_of_range);
+}
@@ -0,0 +1,187 @@
+/*
+ * GridMapRangeTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/iterators/GridMapRange.hpp"
+#include "grid_map_core/iterators/GridMapIterator.hpp"
+#include "grid_map_core/iterators/SubmapIterator.hpp"
+#include "grid_map_core/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using grid_map::GridMap;
+using grid_map::GridMapIterator;
+using grid_map::GridMapRange;
+using grid_map::Index;
+using grid_map::Length;
+using grid_map::Position;
+using grid_map::Size;
+using grid_map::SubmapIterator;
+
+namespace {
+struct Split {};
+}  // namespace
+
+TEST(GridMapRange, SameSequenceAsGridMapIterator)
+{
+  GridMap map;
+  map.setGeometry(Length(8.1, 5.1), 1.0, Position(0.0, 0.0)); // bufferSize(8, 5)
+  map.move(Position(2.0, -1.0)); // Non-default start index.
+  map.add("layer", 0.0);
+
+  GridMapRange range(map);
+  EXPECT_EQ(40u, range.size());
+  auto rangeIterator = range.begin();
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator, ++rangeIterator) {
+    ASSERT_TRUE(rangeIterator != range.end());
+    EXPECT_EQ((*iterator)(0), (*rangeIterator)(0));
+    EXPECT_EQ((*iterator)(1), (*rangeIterator)(1));
+    EXPECT_EQ(iterator.getLinearIndex(), rangeIterator.getLinearIndex());
+    EXPECT_EQ(iterator.getUnwrappedIndex()(0), rangeIterator.getUnwrappedIndex()(0));
+    EXPECT_EQ(iterator.getUnwrappedIndex()(1), rangeIterator.getUnwrappedIndex()(1));
+  }
+  EXPECT_TRUE(rangeIterator == range.end());
+}
+
+TEST(GridMapRange, SameCellsAsSubmapIterator)
+{
+  GridMap map;
+  map.setGeometry(Length(8.1, 5.1), 1.0, Position(0.0, 0.0)); // bufferSize(8, 5)
+  map.move(Position(-3.0, 2.0));
+  const Index submapStartIndex(6, 3); // Wraps around in both directions.
+  const Size submapSize(4, 3);
+
+  std::set<std::pair<int, int>> expected;
+  for (SubmapIterator iterator(map, submapStartIndex, submapSize); !iterator.isPastEnd(); ++iterator) {
+    expected.emplace((*iterator)(0), (*iterator)(1));
+  }
+
+  GridMapRange range(map, submapStartIndex, submapSize);
+  std::set<std::pair<int, int>> visited;
+  for (const Index& index : range) {
+    EXPECT_TRUE(index(0) >= 0 && index(0) < map.getSize()(0));
+    EXPECT_TRUE(index(1) >= 0 && index(1) < map.getSize()(1));
+    visited.emplace(index(0), index(1));
+  }
+  EXPECT_EQ(12u, visited.size());
+  EXPECT_EQ(expected, visited);
+}
+
+TEST(GridMapRange, RandomAccess)
+{
+  GridMap map;
+  map.setGeometry(Length(8.1, 5.1), 1.0, Position(0.0, 0.0)); // bufferSize(8, 5)
+  map.move(Position(1.0, 1.0));
+  GridMapRange range(map, Index(5, 4), Size(5, 3));
+
+  // Compare arbitrary jumps (forward and backward) against incremental stepping.
+  std::vector<Index> sequence;
+  for (auto iterator = range.begin(); iterator != range.end(); ++iterator) {
+    sequence.push_back(*iterator);
+  }
+  ASSERT_EQ(range.size(), sequence.size());
+  const auto begin = range.begin();
+  const auto end = range.end();
+  EXPECT_EQ(static_cast<std::ptrdiff_t>(sequence.size()), end - begin);
+  for (size_t i = 0; i < sequence.size(); ++i) {
+    EXPECT_TRUE((begin[i] == sequence[i]).all());
+    EXPECT_TRUE((*(end - (sequence.size() - i)) == sequence[i]).all());
+  }
+
+  auto iterator = end;
+  for (auto rit = sequence.rbegin(); rit != sequence.rend(); ++rit) {
+    --iterator;
+    EXPECT_TRUE((*iterator == *rit).all());
+  }
+  EXPECT_TRUE(iterator == begin);
+  EXPECT_TRUE(begin < end);
+
+  // Input iterators, since the index is returned by value.
+  using Category = std::iterator_traits<grid_map::GridMapRangeIterator>::iterator_category;
+  EXPECT_TRUE((std::is_same<std::input_iterator_tag, Category>::value));
+  const std::vector<Index> copied(range.begin(), range.end());
+  ASSERT_EQ(sequence.size(), copied.size());
+  EXPECT_TRUE((copied.back() == sequence.back()).all());
+}
+
+TEST(GridMapRange, Algorithms)
+{
+  GridMap map;
+  map.setGeometry(Length(8.1, 5.1), 1.0, Position(0.0, 0.0)); // bufferSize(8, 5)
+  map.add("layer", 0.0);
+  map.at("layer", Index(2, 3)) = 1.0;
+  map.at("layer", Index(7, 0)) = 1.0;
+
+  GridMapRange range(map);
+  const auto& data = map["layer"];
+  const auto count = std::count_if(range.begin(), range.end(), [&](const Index& index) { return data(index(0), index(1)) > 0.5; });
+  EXPECT_EQ(2, count);
+
+  const auto found = std::find_if(range.begin(), range.end(), [&](const Index& index) { return data(index(0), index(1)) > 0.5; });
+  ASSERT_TRUE(found != range.end());
+  EXPECT_EQ(7, (*found)(0));
+  EXPECT_EQ(0, (*found)(1));
+}
+
+TEST(GridMapRange, Split)
+{
+  GridMap map;
+  map.setGeometry(Length(20.1, 10.1), 0.1, Position(0.0, 0.0));
+  map.move(Position(1.05, -3.15));
+  map.add("layer", 0.0);
+
+  GridMapRange range(map, Index(150, 20), Size(100, 60));
+  const auto parts = range.split(7);
+  ASSERT_EQ(7u, parts.size());
+  size_t numberOfCells = 0;
+  for (const auto& part : parts) {
+    numberOfCells += part.size();
+  }
+  EXPECT_EQ(range.size(), numberOfCells);
+
+  auto& data = map["layer"];
+  std::vector<std::thread> threads;
+  for (const auto& part : parts) {
+    threads.emplace_back([&data, part]() {
+      for (const Index& index : part) {
+        data(index(0), index(1)) += 1.0;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(static_cast<float>(range.size()), data.sum());
+  EXPECT_EQ(1.0, data.maxCoeff());
+
+  // TBB style splitting.
+  GridMapRange first(range);
+  GridMapRange second(first, Split());
+  EXPECT_TRUE(first.end() == second.begin());
+  EXPECT_EQ(range.size(), first.size() + second.size());
+  EXPECT_TRUE(first.is_divisible());
+  EXPECT_TRUE(range.split(100000).size() == range.size());
+}
+
+TEST(GridMapRange, EmptyRange)
+{
+  GridMap map;
+  map.setGeometry(Length(8.1, 5.1), 1.0, Position(0.0, 0.0));
+  GridMapRange range(map, Index(2, 2), Size(0, 3));
+  EXPECT_TRUE(range.empty());
+  EXPECT_TRUE(range.begin() == range.end());
+  EXPECT_TRUE(range.split(4).empty());
+}
@@ -11,6 +11,9 @@
 // gtest
 #include <gtest/gtest.h>
 
+// STL
+#include <utility>
+
 namespace grid_map {
 
 TEST(GridMap, CopyConstructor) {
@@ -493,4 +496,58 @@ TEST(ValueAtPosition, LinearInterpolated)
   EXPECT_NEAR(2.1963200, value, 0.0000001);
 }
 
+TEST(GridMap, AllocationOptions)
+{
+  LayerAllocationOptions options;
+  options.transparentHugePages = true;
+  options.firstTouchThreads = 4;
+  options.minLayerSize = 1;
+  GridMap map({"layer_a"});
+  map.setAllocationOptions(options);
+  EXPECT_EQ(4u, map.getAllocationOptions().firstTouchThreads);
+  map.setGeometry(Length(60.0, 50.0), 0.05, Position(0.0, 0.0));
+  EXPECT_EQ(1200, map["layer_a"].rows());
+  EXPECT_EQ(1000, map["layer_a"].cols());
+  EXPECT_TRUE(map["layer_a"].array().isNaN().all());
+
+  map.add("layer_b", 1.5);
+  EXPECT_EQ(map.getSize()(0), map["layer_b"].rows());
+  EXPECT_TRUE((map["layer_b"].array() == 1.5f).all());
+  EXPECT_EQ(2u, map.getLayers().size());
+
+  map.add("layer_b", 2.0);
+  EXPECT_TRUE((map["layer_b"].array() == 2.0f).all());
+  EXPECT_EQ(2u, map.getLayers().size());
+
+  map.clear("layer_b");
+  EXPECT_TRUE(map["layer_b"].array().isNaN().all());
+
+  // Added data is copied into layers allocated with the options, also if it is moved.
+  const Matrix data = Matrix::Constant(map.getSize()(0), map.getSize()(1), 3.0f);
+  map.add("layer_c", data);
+  EXPECT_TRUE((map["layer_c"].array() == 3.0f).all());
+  const float* buffer = map["layer_c"].data();
+  map.add("layer_c", Matrix(data * 2.0f));
+  EXPECT_EQ(buffer, map["layer_c"].data());  // Overwritten in place.
+  EXPECT_TRUE((map["layer_c"].array() == 6.0f).all());
+  EXPECT_EQ(3u, map.getLayers().size());
+}
+
+TEST(GridMap, AddMovedData)
+{
+  GridMap map;
+  map.setGeometry(Length(3.0, 2.0), 0.5, Position(0.0, 0.0));
+  map.addSparse("layer");
+  Matrix data = Matrix::Constant(6, 4, 1.5f);
+  const float* buffer = data.data();
+  map.add("layer", std::move(data));
+  EXPECT_FALSE(map.isSparse("layer"));
+  EXPECT_EQ(buffer, map["layer"].data());  // Not copied.
+  EXPECT_TRUE((map["layer"].array() == 1.5f).all());
+
+  map.add("layer", Matrix(Matrix::Constant(6, 4, 2.0f)));
+  EXPECT_TRUE((map["layer"].array() == 2.0f).all());
+  EXPECT_EQ(1u, map.getLayers().size());
+}
+
 }  // namespace grid_map
\ No newline at end of file
@@ -0,0 +1,123 @@
+/*
+ * PreparedPolygonTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/Polygon.hpp"
+#include "grid_map_core/PreparedPolygon.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// Eigen
+#include <Eigen/Core>
+
+// STL
+#include <cmath>
+
+using Eigen::Vector2d;
+
+using grid_map::Polygon;
+using grid_map::Position;
+using grid_map::PreparedPolygon;
+
+namespace {
+
+// Star shaped (non-convex) polygon with a horizontal edge.
+Polygon createStar(int nSpikes)
+{
+  Polygon polygon;
+  for (int i = 0; i < 2 * nSpikes; ++i) {
+    const double angle = M_PI * i / nSpikes;
+    const double radius = i % 2 == 0 ? 2.0 : 0.8;
+    polygon.addVertex(Vector2d(0.3 + radius * std::cos(angle), -0.1 + radius * std::sin(angle)));
+  }
+  polygon.addVertex(Vector2d(2.0, -0.1));
+  return polygon;
+}
+
+void expectSameAsPolygon(const Polygon& polygon, const PreparedPolygon& preparedPolygon)
+{
+  const int nPoints = 100003; // Not a multiple of the block size.
+  Eigen::Matrix2Xd points = 2.5 * Eigen::Matrix2Xd::Random(2, nPoints);
+  PreparedPolygon::Mask mask;
+  preparedPolygon.isInside(points, mask, 4);
+  ASSERT_EQ(nPoints, mask.size());
+  int nInside = 0;
+  for (int i = 0; i < nPoints; ++i) {
+    const Position point = points.col(i);
+    ASSERT_EQ(polygon.isInside(point), mask(i)) << "Point " << point.transpose();
+    ASSERT_EQ(polygon.isInside(point), preparedPolygon.isInside(point)) << "Point " << point.transpose();
+    nInside += mask(i) ? 1 : 0;
+  }
+  EXPECT_GT(nInside, 0);
+  EXPECT_LT(nInside, nPoints);
+}
+
+}  // namespace
+
+TEST(PreparedPolygon, Triangle)
+{
+  Polygon triangle;
+  triangle.addVertex(Vector2d(0.0, 0.0));
+  triangle.addVertex(Vector2d(1.0, 0.0));
+  triangle.addVertex(Vector2d(0.5, 1.0));
+  PreparedPolygon preparedPolygon(triangle);
+
+  EXPECT_EQ(2u, preparedPolygon.nEdges()); // The horizontal edge is never crossed.
+  EXPECT_TRUE(preparedPolygon.isInside(Position(0.5, 0.5)));
+  EXPECT_FALSE(preparedPolygon.isInside(Position(0.0, 0.5)));
+  EXPECT_FALSE(preparedPolygon.isInside(Position(0.5, 1.5)));
+  EXPECT_FALSE(preparedPolygon.isInside(Position(NAN, 0.5)));
+}
+
+TEST(PreparedPolygon, EmptyPolygon)
+{
+  PreparedPolygon preparedPolygon((Polygon()));
+  EXPECT_EQ(0u, preparedPolygon.nEdges());
+  EXPECT_FALSE(preparedPolygon.isInside(Position(0.0, 0.0)));
+
+  Eigen::Matrix2Xd points = Eigen::Matrix2Xd::Random(2, 10);
+  PreparedPolygon::Mask mask;
+  preparedPolygon.isInside(points, mask);
+  EXPECT_FALSE(mask.any());
+}
+
+TEST(PreparedPolygon, BatchSameAsPolygon)
+{
+  const Polygon polygon = createStar(7);
+  expectSameAsPolygon(polygon, PreparedPolygon(polygon));
+}
+
+TEST(PreparedPolygon, BatchWithEdgeIndexSameAsPolygon)
+{
+  const Polygon polygon = createStar(50);
+  const PreparedPolygon preparedPolygon(polygon, true);
+  EXPECT_TRUE(preparedPolygon.hasEdgeIndex());
+  expectSameAsPolygon(polygon, preparedPolygon);
+}
+
+TEST(PreparedPolygon, PointsOnEdgesSameAsPolygon)
+{
+  const Polygon polygon = createStar(50);
+  const PreparedPolygon preparedPolygon(polygon);
+  const PreparedPolygon indexedPolygon(polygon, true);
+  const auto& vertices = polygon.getVertices();
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    for (const double t : {0.0, 0.13, 0.37, 0.5, 0.91}) {
+      // Points exactly on the edge, where rounding decides if the edge is crossed.
+      const double y = vertices[i].y() + t * (vertices[j].y() - vertices[i].y());
+      const double x = (vertices[j].x() - vertices[i].x()) * (y - vertices[i].y()) /
+                       (vertices[j].y() - vertices[i].y()) + vertices[i].x();
+      const Position point(x, y);
+      EXPECT_EQ(polygon.isInside(point), preparedPolygon.isInside(point)) << "Point " << point.transpose();
+      EXPECT_EQ(polygon.isInside(point), indexedPolygon.isInside(point)) << "Point " << point.transpose();
+      Eigen::Matrix2Xd points(2, 1);
+      points.col(0) = point;
+      PreparedPolygon::Mask mask;
+      preparedPolygon.isInside(points, mask);
+      EXPECT_EQ(polygon.isInside(point), mask(0)) << "Point " << point.transpose();
+    }
+  }
+}
@@ -0,0 +1,197 @@
+/*
+ * RegionStatisticsTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/CellSpans.hpp"
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/RegionStatistics.hpp"
+#include "grid_map_core/iterators/CircleIterator.hpp"
+#include "grid_map_core/iterators/EllipseIterator.hpp"
+#include "grid_map_core/iterators/PolygonIterator.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+using CellSet = std::set<std::pair<int, int>>;
+
+GridMap createMap()
+{
+  GridMap map({"elevation", "variance"});
+  map.setGeometry(Length(5.03, 4.01), 0.1, Position(0.2, -0.1));
+  map.move(Position(1.33, 0.71)); // Non-default start index.
+  map["elevation"].setRandom();
+  map["variance"].setRandom();
+  map["variance"] = map["variance"].array().abs();
+  // Some invalid cells.
+  for (int i = 0; i < map.getSize().prod(); i += 7) {
+    map["elevation"](i) = NAN;
+  }
+  return map;
+}
+
+CellSet getCells(const CellSpans& spans, const Size& size)
+{
+  CellSet cells;
+  for (const auto& span : spans) {
+    EXPECT_GT(span.length, 0);
+    EXPECT_LE(span.startIndex(0) + span.length, size(0));
+    for (int i = 0; i < span.length; ++i) {
+      EXPECT_TRUE(cells.emplace(span.startIndex(0) + i, span.startIndex(1)).second) << "Cell visited twice.";
+    }
+  }
+  return cells;
+}
+
+template <typename Iterator>
+CellSet getCells(Iterator iterator)
+{
+  CellSet cells;
+  for (; !iterator.isPastEnd(); ++iterator) {
+    cells.emplace((*iterator)(0), (*iterator)(1));
+  }
+  return cells;
+}
+
+RegionStatistics getStatistics(const GridMap& map, const std::string& layer, const CellSet& cells, double quantile)
+{
+  RegionStatistics statistics;
+  std::vector<float> values;
+  for (const auto& cell : cells) {
+    const float value = map.at(layer, Index(cell.first, cell.second));
+    if (std::isfinite(value)) {
+      values.push_back(value);
+    }
+  }
+  statistics.count = values.size();
+  if (values.empty()) {
+    return statistics;
+  }
+  std::sort(values.begin(), values.end());
+  for (const auto value : values) {
+    statistics.sum += value;
+  }
+  statistics.min = values.front();
+  statistics.max = values.back();
+  statistics.mean = statistics.sum / values.size();
+  const double position = quantile * (values.size() - 1);
+  const auto lower = static_cast<size_t>(position);
+  const double upper = lower + 1 < values.size() ? values[lower + 1] : values[lower];
+  statistics.quantile = values[lower] + (position - lower) * (upper - values[lower]);
+  return statistics;
+}
+
+void expectStatistics(const RegionStatistics& expected, const RegionStatistics& actual)
+{
+  EXPECT_EQ(expected.count, actual.count);
+  EXPECT_NEAR(expected.sum, actual.sum, 1e-4);
+  EXPECT_DOUBLE_EQ(expected.min, actual.min);
+  EXPECT_DOUBLE_EQ(expected.max, actual.max);
+  EXPECT_NEAR(expected.mean, actual.mean, 1e-6);
+  EXPECT_NEAR(expected.quantile, actual.quantile, 1e-6);
+}
+
+}  // namespace
+
+TEST(CellSpans, PolygonSameAsIterator)
+{
+  const GridMap map = createMap();
+  Polygon polygon;
+  polygon.addVertex(Position(-1.03, -1.51));
+  polygon.addVertex(Position(2.47, -0.73));
+  polygon.addVertex(Position(0.31, 0.05)); // Non-convex.
+  polygon.addVertex(Position(2.91, 1.88));
+  polygon.addVertex(Position(-0.66, 2.27));
+  const CellSet expected = getCells(PolygonIterator(map, polygon));
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(expected, getCells(getCellSpans(map, polygon), map.getSize()));
+}
+
+TEST(CellSpans, CircleSameAsIterator)
+{
+  const GridMap map = createMap();
+  const CircleRegion circle{Position(1.72, -0.43), 1.37};
+  const CellSet expected = getCells(CircleIterator(map, circle.center, circle.radius));
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(expected, getCells(getCellSpans(map, circle), map.getSize()));
+}
+
+TEST(CellSpans, EllipseSameAsIterator)
+{
+  const GridMap map = createMap();
+  const EllipseRegion ellipse{Position(0.54, 0.33), Length(3.1, 1.25), 0.61};
+  const CellSet expected = getCells(EllipseIterator(map, ellipse.center, ellipse.length, ellipse.rotation));
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(expected, getCells(getCellSpans(map, ellipse), map.getSize()));
+}
+
+TEST(CellSpans, Rectangle)
+{
+  const GridMap map = createMap();
+  const RectangleRegion rectangle{Position(0.5, 0.2), Length(0.41, 0.22)};
+  const CellSpans spans = getCellSpans(map, rectangle);
+  EXPECT_EQ(8u, getNumberOfCells(spans)); // 4 x 2 cell centers.
+  for (const auto& cell : getCells(spans, map.getSize())) {
+    Position position;
+    map.getPosition(Index(cell.first, cell.second), position);
+    EXPECT_LE(std::abs(position.x() - 0.5), 0.205);
+    EXPECT_LE(std::abs(position.y() - 0.2), 0.11);
+  }
+}
+
+TEST(CellSpans, OutsideMap)
+{
+  const GridMap map = createMap();
+  EXPECT_TRUE(getCellSpans(map, CircleRegion{Position(20.0, 0.0), 1.0}).empty());
+  EXPECT_TRUE(getCellSpans(map, Polygon()).empty());
+}
+
+TEST(RegionStatistics, SameAsIterator)
+{
+  const GridMap map = createMap();
+  const CircleRegion circle{Position(0.72, 0.13), 1.17};
+  const CellSet cells = getCells(CircleIterator(map, circle.center, circle.radius));
+  const double quantile = 0.3;
+
+  expectStatistics(getStatistics(map, "elevation", cells, quantile), computeStatistics(map, "elevation", circle, quantile));
+
+  const auto statistics = computeStatistics(map, std::vector<std::string>{"elevation", "variance"}, circle, quantile);
+  ASSERT_EQ(2u, statistics.size());
+  expectStatistics(getStatistics(map, "elevation", cells, quantile), statistics[0]);
+  expectStatistics(getStatistics(map, "variance", cells, quantile), statistics[1]);
+
+  const RegionStatistics expected = getStatistics(map, "elevation", cells, 0.5);
+  EXPECT_DOUBLE_EQ(expected.max, reduce(map, "elevation", circle, RegionReduction::MAX));
+  EXPECT_DOUBLE_EQ(expected.min, reduce(map, "elevation", circle, RegionReduction::MIN));
+  EXPECT_EQ(expected.count, reduce(map, "elevation", circle, RegionReduction::COUNT));
+  EXPECT_NEAR(expected.sum, reduce(map, "elevation", circle, RegionReduction::SUM), 1e-4);
+  EXPECT_NEAR(expected.mean, reduce(map, "elevation", circle, RegionReduction::MEAN), 1e-6);
+  EXPECT_NEAR(expected.quantile, reduce(map, "elevation", circle, RegionReduction::QUANTILE), 1e-6);
+}
+
+TEST(RegionStatistics, NoValidCells)
+{
+  GridMap map({"elevation"});
+  map.setGeometry(Length(2.0, 2.0), 0.1);
+  const RectangleRegion rectangle{Position(0.0, 0.0), Length(1.0, 1.0)};
+  const RegionStatistics statistics = computeStatistics(map, "elevation", rectangle, 0.5);
+  EXPECT_EQ(0u, statistics.count);
+  EXPECT_EQ(0.0, statistics.sum);
+  EXPECT_TRUE(std::isnan(statistics.min));
+  EXPECT_TRUE(std::isnan(statistics.max));
+  EXPECT_TRUE(std::isnan(statistics.mean));
+  EXPECT_TRUE(std::isnan(statistics.quantile));
+  EXPECT_THROW(reduce(map, "nonexisting", rectangle, RegionReduction::MAX), std::out_of_range);
+}
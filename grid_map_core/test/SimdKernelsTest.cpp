@@ -0,0 +1,249 @@
+/*
+ * SimdKernelsTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/GridMapMath.hpp"
+#include "grid_map_core/SimdKernels.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace grid_map;
+using namespace grid_map::simd;
+
+namespace {
+
+//! Random values with NAN and infinity, size not a multiple of the vector widths.
+std::vector<float> createValues(const size_t size = 1003)
+{
+  Eigen::VectorXf values = Eigen::VectorXf::Random(size) * 100.0f;
+  for (size_t i = 0; i < size; i += 7) {
+    values(i) = NAN;
+  }
+  for (size_t i = 3; i < size; i += 31) {
+    values(i) = (i % 2 == 0 ? 1.0f : -1.0f) * std::numeric_limits<float>::infinity();
+  }
+  return std::vector<float>(values.data(), values.data() + size);
+}
+
+std::vector<InstructionSet> getSupportedInstructionSets()
+{
+  std::vector<InstructionSet> instructionSets;
+  for (const auto instructionSet : {InstructionSet::SCALAR, InstructionSet::AVX2, InstructionSet::AVX512}) {
+    if (isSupported(instructionSet)) {
+      instructionSets.push_back(instructionSet);
+    }
+  }
+  return instructionSets;
+}
+
+/*!
+ * Restores the instruction set after a test.
+ */
+class SimdKernelsTest : public ::testing::Test
+{
+ protected:
+  void SetUp() override { instructionSet_ = getInstructionSet(); }
+  void TearDown() override { setInstructionSet(instructionSet_); }
+  InstructionSet instructionSet_;
+};
+
+}  // namespace
+
+TEST_F(SimdKernelsTest, InstructionSets)
+{
+  EXPECT_TRUE(isSupported(InstructionSet::SCALAR));
+  EXPECT_TRUE(isSupported(getInstructionSet()));
+  EXPECT_TRUE(setInstructionSet(InstructionSet::SCALAR));
+  EXPECT_EQ(InstructionSet::SCALAR, getInstructionSet());
+}
+
+TEST_F(SimdKernelsTest, FiniteStatistics)
+{
+  const std::vector<float> values = createValues();
+  Eigen::Map<const Eigen::VectorXf> vector(values.data(), values.size());
+  size_t count = 0;
+  double sum = 0.0;
+  for (const float value : values) {
+    if (std::isfinite(value)) {
+      ++count;
+      sum += value;
+    }
+  }
+
+  for (const auto instructionSet : getSupportedInstructionSets()) {
+    ASSERT_TRUE(setInstructionSet(instructionSet));
+    // Different sizes for the remainders.
+    for (const size_t size : {values.size(), values.size() - 5, size_t(3), size_t(0)}) {
+      const FiniteStatistics statistics = computeFiniteStatistics(values.data(), size);
+      const FiniteStatistics expected = [&]() {
+        setInstructionSet(InstructionSet::SCALAR);
+        const FiniteStatistics result = computeFiniteStatistics(values.data(), size);
+        setInstructionSet(instructionSet);
+        return result;
+      }();
+      EXPECT_EQ(expected.count, statistics.count);
+      EXPECT_NEAR(expected.sum, statistics.sum, 1e-6 * std::abs(expected.sum) + 1e-9);
+      EXPECT_EQ(expected.min, statistics.min);
+      EXPECT_EQ(expected.max, statistics.max);
+    }
+    const FiniteStatistics statistics = computeFiniteStatistics(values.data(), values.size());
+    EXPECT_EQ(count, statistics.count);
+    EXPECT_NEAR(sum, statistics.sum, 1e-6 * std::abs(sum));
+    EXPECT_EQ(vector.minCoeffOfFinites(), statistics.min);
+    EXPECT_EQ(vector.maxCoeffOfFinites(), statistics.max);
+  }
+
+  // Only invalid values.
+  const std::vector<float> invalid(20, NAN);
+  const FiniteStatistics statistics = computeFiniteStatistics(invalid.data(), invalid.size());
+  EXPECT_EQ(0u, statistics.count);
+  EXPECT_EQ(0.0, statistics.sum);
+  EXPECT_TRUE(std::isinf(statistics.min));
+}
+
+TEST_F(SimdKernelsTest, ScaleAndClamp)
+{
+  const std::vector<float> values = createValues();
+  std::vector<float> expected(values.size());
+  setInstructionSet(InstructionSet::SCALAR);
+  scaleAndClamp(values.data(), expected.data(), values.size(), 0.5f, 3.0f, -10.0f, 20.0f);
+
+  for (const auto instructionSet : getSupportedInstructionSets()) {
+    ASSERT_TRUE(setInstructionSet(instructionSet));
+    std::vector<float> output(values);
+    // In place.
+    scaleAndClamp(output.data(), output.data(), output.size(), 0.5f, 3.0f, -10.0f, 20.0f);
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (std::isnan(values[i])) {
+        EXPECT_TRUE(std::isnan(output[i]));
+        continue;
+      }
+      EXPECT_FLOAT_EQ(expected[i], output[i]);
+      EXPECT_GE(output[i], -10.0f);
+      EXPECT_LE(output[i], 20.0f);
+    }
+  }
+}
+
+TEST_F(SimdKernelsTest, PackColors)
+{
+  std::vector<float> channels[3];
+  for (auto& channel : channels) {
+    const Eigen::VectorXf values = (Eigen::VectorXf::Random(101).array() + 1.0f) * 0.5f;
+    channel.assign(values.data(), values.data() + values.size());
+  }
+  channels[0][5] = 1.5f;  // Clamped.
+  channels[1][5] = -0.5f;
+  channels[2][5] = NAN;
+
+  for (const auto instructionSet : getSupportedInstructionSets()) {
+    ASSERT_TRUE(setInstructionSet(instructionSet));
+    std::vector<float> output(channels[0].size());
+    packColors(channels[0].data(), channels[1].data(), channels[2].data(), output.data(), output.size());
+    for (size_t i = 0; i < output.size(); ++i) {
+      const Eigen::Vector3f color(std::min(std::max(channels[0][i], 0.0f), 1.0f), std::min(std::max(channels[1][i], 0.0f), 1.0f),
+                                  std::isnan(channels[2][i]) ? 0.0f : channels[2][i]);
+      float expected;
+      colorVectorToValue(color, expected);
+      Eigen::Vector3f expectedColor, outputColor;
+      colorValueToVector(expected, expectedColor);
+      colorValueToVector(output[i], outputColor);
+      EXPECT_EQ(expectedColor, outputColor);
+    }
+  }
+}
+
+TEST_F(SimdKernelsTest, InterpolateBilinear)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(3.0, 2.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(0.73, -0.41));  // Non-default start index.
+  map["layer"].setRandom();
+  const Size& size = map.getSize();
+
+  // Query positions between the cell centers (and some invalid ones).
+  std::vector<float> rows, columns;
+  for (int i = 0; i < 500; ++i) {
+    const Eigen::Array2f index = (Eigen::Array2f::Random() + 1.0f) * 0.5f * (size - 1).cast<float>();
+    rows.push_back(index(0));
+    columns.push_back(index(1));
+  }
+  rows.push_back(-0.1f);
+  columns.push_back(1.0f);
+  rows.push_back(1.0f);
+  columns.push_back(static_cast<float>(size(1)));
+  rows.push_back(NAN);
+  columns.push_back(1.0f);
+  rows.push_back(static_cast<float>(size(0) - 1));
+  columns.push_back(static_cast<float>(size(1) - 1));
+
+  std::vector<float> expected(rows.size());
+  setInstructionSet(InstructionSet::SCALAR);
+  interpolateBilinear(map["layer"].data(), size, map.getStartIndex(), rows.data(), columns.data(), expected.data(), rows.size());
+
+  // Compare to the interpolation of the grid map (same data, different parametrization), also across the
+  // wrap of the circular buffer and after converting to the default start index.
+  GridMap unwrappedMap(map);
+  unwrappedMap.convertToDefaultStartIndex();
+  const Position firstCell = map.getPosition() + (0.5 * map.getLength() - 0.5 * map.getResolution()).matrix();
+  for (size_t i = 0; i < 500; ++i) {
+    const Position position = firstCell - map.getResolution() * Position(rows[i], columns[i]);
+    EXPECT_NEAR(map.atPosition("layer", position, InterpolationMethods::INTER_LINEAR), expected[i], 1e-4);
+    EXPECT_NEAR(unwrappedMap.atPosition("layer", position, InterpolationMethods::INTER_LINEAR), expected[i], 1e-4);
+  }
+  const size_t n = rows.size();
+  EXPECT_TRUE(std::isnan(expected[n - 4]));
+  EXPECT_TRUE(std::isnan(expected[n - 3]));
+  EXPECT_TRUE(std::isnan(expected[n - 2]));
+  const Index lastIndex = getBufferIndexFromIndex(size - 1, size, map.getStartIndex());
+  EXPECT_FLOAT_EQ(map.at("layer", lastIndex), expected[n - 1]);
+
+  for (const auto instructionSet : getSupportedInstructionSets()) {
+    ASSERT_TRUE(setInstructionSet(instructionSet));
+    std::vector<float> output(rows.size());
+    interpolateBilinear(map["layer"].data(), size, map.getStartIndex(), rows.data(), columns.data(), output.data(), rows.size());
+    for (size_t i = 0; i < output.size(); ++i) {
+      if (std::isnan(expected[i])) {
+        EXPECT_TRUE(std::isnan(output[i]));
+      } else {
+        EXPECT_FLOAT_EQ(expected[i], output[i]);
+      }
+    }
+  }
+}
+
+TEST_F(SimdKernelsTest, AccumulateHash)
+{
+  const std::vector<float> values = createValues();
+  setInstructionSet(InstructionSet::SCALAR);
+  uint64_t expected = 0;
+  accumulateHash(values.data(), values.size(), 17, expected);
+
+  for (const auto instructionSet : getSupportedInstructionSets()) {
+    ASSERT_TRUE(setInstructionSet(instructionSet));
+    uint64_t hash = 0;
+    accumulateHash(values.data(), values.size(), 17, hash);
+    EXPECT_EQ(expected, hash);
+
+    // Split into parts.
+    hash = 0;
+    accumulateHash(values.data() + 501, values.size() - 501, 17 + 501, hash);
+    accumulateHash(values.data(), 3, 17, hash);
+    accumulateHash(values.data() + 3, 498, 17 + 3, hash);
+    EXPECT_EQ(expected, hash);
+
+    // Other index.
+    hash = 0;
+    accumulateHash(values.data(), values.size(), 18, hash);
+    EXPECT_NE(expected, hash);
+  }
+}
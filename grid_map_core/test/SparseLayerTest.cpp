@@ -0,0 +1,200 @@
+/*
+ * SparseLayerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/SparseLayer.hpp"
+#include "grid_map_core/iterators/GridMapIterator.hpp"
+#include "grid_map_core/iterators/SparseLayerIterator.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+using namespace grid_map;
+
+TEST(SparseLayer, SetAndClear)
+{
+  SparseLayer layer(Size(50, 37));
+  EXPECT_EQ(0u, layer.getNumberOfCells());
+  EXPECT_TRUE(std::isnan(static_cast<const SparseLayer&>(layer).at(Index(3, 4))));
+  EXPECT_FALSE(layer.isSet(Index(3, 4)));
+
+  layer.set(Index(3, 4), 1.5f);
+  layer.set(Index(49, 36), 2.5f);
+  layer.at(Index(20, 20)) = 3.5f;
+  layer.at(Index(20, 20)) += 1.0f;
+  EXPECT_EQ(3u, layer.getNumberOfCells());
+  EXPECT_EQ(3u, layer.getNumberOfTiles());
+  EXPECT_TRUE(layer.isSet(Index(3, 4)));
+  EXPECT_EQ(1.5f, static_cast<const SparseLayer&>(layer).at(Index(3, 4)));
+  EXPECT_EQ(2.5f, static_cast<const SparseLayer&>(layer).at(Index(49, 36)));
+  EXPECT_EQ(4.5f, static_cast<const SparseLayer&>(layer).at(Index(20, 20)));
+
+  layer.clear(Index(3, 4));
+  EXPECT_FALSE(layer.isSet(Index(3, 4)));
+  EXPECT_EQ(2u, layer.getNumberOfTiles());
+
+  // Block spanning several (partially covered) tiles.
+  for (int i = 10; i < 30; ++i) {
+    layer.set(Index(i, i), static_cast<float>(i));
+  }
+  layer.clearBlock(Index(12, 0), Size(10, 37));
+  EXPECT_TRUE(layer.isSet(Index(11, 11)));
+  EXPECT_FALSE(layer.isSet(Index(12, 12)));
+  EXPECT_FALSE(layer.isSet(Index(21, 21)));
+  EXPECT_FALSE(layer.isSet(Index(20, 20)));
+  EXPECT_TRUE(layer.isSet(Index(22, 22)));
+  EXPECT_EQ(11u, layer.getNumberOfCells());
+
+  layer.clearAll();
+  EXPECT_EQ(0u, layer.getNumberOfCells());
+  EXPECT_EQ(0u, layer.getNumberOfTiles());
+}
+
+TEST(SparseLayer, DenseConversionAndIteration)
+{
+  Matrix data(Matrix::Constant(100, 70, NAN));
+  std::set<std::pair<int, int>> populated;
+  for (int i = 0; i < 200; ++i) {
+    const Index index((i * 37) % 100, (i * 13) % 70);
+    data(index(0), index(1)) = static_cast<float>(i);
+    populated.emplace(index(0), index(1));
+  }
+
+  SparseLayer layer;
+  layer.fromDense(data);
+  EXPECT_EQ(populated.size(), layer.getNumberOfCells());
+  Matrix dense;
+  layer.toDense(dense);
+  EXPECT_TRUE(((dense.array() == data.array()) || (dense.array().isNaN() && data.array().isNaN())).all());
+
+  std::set<std::pair<int, int>> visited;
+  for (SparseLayerIterator iterator(layer); !iterator.isPastEnd(); ++iterator) {
+    EXPECT_EQ(data((*iterator)(0), (*iterator)(1)), iterator.getValue());
+    visited.emplace((*iterator)(0), (*iterator)(1));
+  }
+  EXPECT_EQ(populated, visited);
+
+  // Empty layers.
+  EXPECT_TRUE(SparseLayerIterator(SparseLayer(Size(10, 10))).isPastEnd());
+  EXPECT_TRUE(SparseLayerIterator(SparseLayer()).isPastEnd());
+
+  // Sparse storage is much smaller for clustered data.
+  SparseLayer clustered(Size(1000, 1000));
+  for (int i = 0; i < 200; ++i) {
+    for (int j = 0; j < 200; ++j) {
+      clustered.set(Index(i, j), 1.0f);
+    }
+  }
+  EXPECT_LT(clustered.getMemorySize() * 20, static_cast<size_t>(1000 * 1000 * sizeof(float)));
+}
+
+TEST(SparseLayer, GridMap)
+{
+  GridMap map({"elevation"});
+  map.setGeometry(Length(5.0, 4.0), 0.1, Position(0.0, 0.0));
+  map["elevation"].setConstant(1.0f);
+  map.addSparse("label");
+  EXPECT_TRUE(map.exists("label"));
+  EXPECT_TRUE(map.isSparse("label"));
+  EXPECT_FALSE(map.isSparse("elevation"));
+  EXPECT_EQ(1u, map.getLayers().size());
+  EXPECT_THROW(map.get("label"), std::out_of_range);
+
+  const Index index(3, 5);
+  EXPECT_FALSE(map.isValid(index, "label"));
+  map.at("label", index) = 7.0f;
+  map.atPosition("label", Position(-1.0, 1.0)) = 8.0f;
+  EXPECT_TRUE(map.isValid(index, "label"));
+  EXPECT_EQ(7.0f, static_cast<const GridMap&>(map).at("label", index));
+  EXPECT_EQ(2u, map.getSparse("label").getNumberOfCells());
+
+  // Readable with the iterators of the map.
+  size_t nValid = 0;
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    if (map.isValid(*iterator, "label")) {
+      ++nValid;
+    }
+  }
+  EXPECT_EQ(2u, nValid);
+
+  // Moving keeps the populated cells in the map, drops the others.
+  map.move(Position(0.5, 0.0));
+  EXPECT_EQ(8.0f, map.atPosition("label", Position(-1.0, 1.0)));
+  map.move(Position(5.0, 0.0));
+  EXPECT_EQ(0u, map.getSparse("label").getNumberOfCells());
+  map.atPosition("label", Position(4.0, -1.0)) = 9.0f;
+
+  // Submap and default start index.
+  bool isSuccess;
+  const GridMap submap = map.getSubmap(Position(4.0, -1.0), Length(1.0, 1.0), isSuccess);
+  ASSERT_TRUE(isSuccess);
+  EXPECT_TRUE(submap.isSparse("label"));
+  EXPECT_EQ(9.0f, submap.atPosition("label", Position(4.0, -1.0)));
+  EXPECT_EQ(1u, submap.getSparse("label").getNumberOfCells());
+  GridMap copy(map);
+  copy.convertToDefaultStartIndex();
+  EXPECT_EQ(9.0f, copy.atPosition("label", Position(4.0, -1.0)));
+
+  // Conversions.
+  map.convertToDense("label");
+  EXPECT_FALSE(map.isSparse("label"));
+  EXPECT_EQ(9.0f, map.atPosition("label", Position(4.0, -1.0)));
+  EXPECT_EQ(1, map["label"].array().isFinite().count());
+  map.convertToSparse("label");
+  EXPECT_TRUE(map.isSparse("label"));
+  EXPECT_EQ(1u, map.getSparse("label").getNumberOfCells());
+  EXPECT_EQ(9.0f, map.atPosition("label", Position(4.0, -1.0)));
+
+  map.add("label", 0.0);
+  EXPECT_FALSE(map.isSparse("label"));
+  EXPECT_TRUE(map.erase("label"));
+  map.addSparse("label");
+  EXPECT_TRUE(map.erase("label"));
+  EXPECT_FALSE(map.exists("label"));
+}
+
+TEST(SparseLayer, ConstReadingDoesNotPopulate)
+{
+  GridMap map;
+  map.setGeometry(Length(10.0, 10.0), 0.01, Position(0.0, 0.0));  // 1000 x 1000 cells.
+  map.addSparse("label");
+  map.at("label", Index(500, 500)) = 1.0f;
+  const SparseLayer& layer = map.getSparse("label");
+  const size_t memorySize = layer.getMemorySize();
+
+  // Reads of all cells through the const map.
+  const GridMap& constMap = map;
+  size_t nValid = 0;
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    if (!std::isnan(constMap.at("label", *iterator))) {
+      ++nValid;
+    }
+    if (constMap.isValid(*iterator, "label")) {
+      ++nValid;
+    }
+  }
+  EXPECT_TRUE(std::isnan(constMap.atPosition("label", Position(1.0, 1.0))));
+  EXPECT_EQ(2u, nValid);
+  EXPECT_EQ(1u, layer.getNumberOfCells());
+  EXPECT_EQ(1u, layer.getNumberOfTiles());
+  EXPECT_EQ(memorySize, layer.getMemorySize());
+
+  // Writes through references populate distinct cells.
+  float& first = map.at("label", Index(3, 4));
+  float& second = map.at("label", Index(900, 4));
+  EXPECT_NE(&first, &second);
+  first = 2.0f;
+  second = 3.0f;
+  EXPECT_EQ(2.0f, constMap.at("label", Index(3, 4)));
+  EXPECT_EQ(3.0f, constMap.at("label", Index(900, 4)));
+  EXPECT_EQ(3u, layer.getNumberOfCells());
+}
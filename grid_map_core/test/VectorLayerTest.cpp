@@ -0,0 +1,72 @@
+/*
+ * VectorLayerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/VectorLayer.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <vector>
+
+using namespace grid_map;
+
+TEST(VectorLayer, Names)
+{
+  const auto names = getVectorLayerNames("normal_", 3);
+  ASSERT_EQ(3u, names.size());
+  EXPECT_EQ("normal_x", names[0]);
+  EXPECT_EQ("normal_y", names[1]);
+  EXPECT_EQ("normal_z", names[2]);
+  EXPECT_EQ("feature_3", getVectorLayerNames("feature_", 5)[3]);
+}
+
+TEST(VectorLayer, Access)
+{
+  GridMap map;
+  map.setGeometry(Length(1.0, 2.0), 0.1);
+  auto normals = addVectorLayer<3>(map, "normal_");
+  EXPECT_TRUE(map.exists("normal_x"));
+  EXPECT_TRUE(map.exists("normal_z"));
+  EXPECT_FALSE(normals.isValid(0));
+
+  const Index index(3, 7);
+  normals.set(index, Eigen::Vector3d(0.1, 0.2, 0.9));
+  EXPECT_FLOAT_EQ(0.2f, map.at("normal_y", index));
+  Eigen::Vector3d vector;
+  ASSERT_TRUE(map.getVector("normal_", index, vector));
+  EXPECT_NEAR(0.9, vector.z(), 1e-6);
+
+  const ConstVectorLayer<3> constNormals(map, "normal_");
+  ConstVectorLayer<3>::Vector constVector;
+  ASSERT_TRUE(constNormals.getVector(index, constVector));
+  EXPECT_FLOAT_EQ(0.1f, constVector.x());
+  EXPECT_FALSE(constNormals.getVector(Index(0, 0), constVector));
+  EXPECT_THROW(ConstVectorLayer<3>(map, "color_"), std::out_of_range);
+}
+
+TEST(VectorLayer, Interleaved)
+{
+  GridMap map;
+  map.setGeometry(Length(1.0, 2.0), 0.1);
+  auto vectors = addVectorLayer<2>(map, "flow_", 0.0);
+  VectorLayer<2>::Vectors values = VectorLayer<2>::Vectors::Random(2, map.getSize().prod());
+  vectors.setInterleaved(values);
+  EXPECT_EQ(values(1, 13), map["flow_y"](13));
+
+  VectorLayer<2>::Vectors result;
+  vectors.getInterleaved(result);
+  EXPECT_TRUE(result.isApprox(values));
+
+  const std::vector<Eigen::Index> cells{5, 0, 17};
+  vectors.getVectors(cells, result);
+  ASSERT_EQ(3, result.cols());
+  EXPECT_EQ(values.col(5), result.col(0));
+  EXPECT_EQ(values.col(17), result.col(2));
+  EXPECT_EQ(values.col(17), vectors(17));
+}
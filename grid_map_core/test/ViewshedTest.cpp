@@ -0,0 +1,155 @@
+/*
+ * ViewshedTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_core/Viewshed.hpp"
+#include "grid_map_core/iterators/GridMapIterator.hpp"
+#include "grid_map_core/iterators/LineIterator.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <limits>
+
+using namespace grid_map;
+
+namespace {
+
+GridMap createMap()
+{
+  GridMap map({"elevation"});
+  map.setGeometry(Length(10.0, 8.0), 0.1, Position(0.0, 0.0));
+  map["elevation"].setZero();
+  return map;
+}
+
+void setWavyTerrain(GridMap& map)
+{
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    map.at("elevation", *iterator) =
+        0.5 * std::sin(1.3 * position.x()) + 0.3 * std::cos(0.9 * position.y() + 0.4) + 0.05 * position.x();
+  }
+}
+
+//! Visibility of a cell by checking the cells along the line of sight (reference implementation).
+bool isVisible(const GridMap& map, const Index& observer, const Index& target, double observerHeight)
+{
+  Position observerPosition, targetPosition;
+  map.getPosition(observer, observerPosition);
+  map.getPosition(target, targetPosition);
+  const double observerElevation = map.at("elevation", observer) + observerHeight;
+  const double targetDistance = (targetPosition - observerPosition).norm();
+  const double targetSlope = (map.at("elevation", target) - observerElevation) / targetDistance;
+  for (LineIterator iterator(map, observer, target); !iterator.isPastEnd(); ++iterator) {
+    if ((*iterator == observer).all() || (*iterator == target).all()) {
+      continue;
+    }
+    Position position;
+    map.getPosition(*iterator, position);
+    const double slope = (map.at("elevation", *iterator) - observerElevation) / (position - observerPosition).norm();
+    if (slope > targetSlope) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(Viewshed, FlatTerrain)
+{
+  GridMap map = createMap();
+  ASSERT_TRUE(computeViewshed(map, "elevation", "visibility", Position(1.23, -0.77), 1.0));
+  EXPECT_TRUE((map["visibility"].array() == 1.0).all());
+}
+
+TEST(Viewshed, Wall)
+{
+  GridMap map = createMap();
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    if (position.x() > 1.99 && position.x() < 2.21) {
+      map.at("elevation", *iterator) = 2.0;
+    }
+  }
+  ASSERT_TRUE(computeViewshed(map, "elevation", "visibility", Position(0.0, 0.0), 1.0));
+  EXPECT_EQ(1.0, map.atPosition("visibility", Position(1.0, 0.0)));
+  EXPECT_EQ(1.0, map.atPosition("visibility", Position(-3.0, 2.0)));
+  EXPECT_EQ(1.0, map.atPosition("visibility", Position(2.05, 1.0)));
+  EXPECT_EQ(0.0, map.atPosition("visibility", Position(4.0, 0.0)));
+  EXPECT_EQ(0.0, map.atPosition("visibility", Position(4.5, -3.0)));
+
+  // A target high enough is visible over the wall.
+  ASSERT_TRUE(computeViewshed(map, "elevation", "visibility", Position(0.0, 0.0), 1.0, 5.0));
+  EXPECT_EQ(1.0, map.atPosition("visibility", Position(4.0, 0.0)));
+}
+
+TEST(Viewshed, SameAsLineOfSight)
+{
+  GridMap map = createMap();
+  setWavyTerrain(map);
+  const Position observerPosition(-0.43, 0.61);
+  const double observerHeight = 0.8;
+  ASSERT_TRUE(computeViewshed(map, "elevation", "visibility", observerPosition, observerHeight));
+
+  Index observer;
+  ASSERT_TRUE(map.getIndex(observerPosition, observer));
+  int nVisible = 0;
+  int nSame = 0;
+  int nCells = 0;
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    if ((*iterator == observer).all()) {
+      continue;
+    }
+    const bool visible = isVisible(map, observer, *iterator, observerHeight);
+    nVisible += visible;
+    nSame += visible == (map.at("visibility", *iterator) == 1.0);
+    ++nCells;
+  }
+  // The terrain has occlusions and the approximation agrees with the line of sight for most cells.
+  EXPECT_GT(nVisible, nCells / 5);
+  EXPECT_LT(nVisible, nCells * 4 / 5);
+  EXPECT_GT(nSame, nCells * 95 / 100);
+}
+
+TEST(Viewshed, CircularBuffer)
+{
+  GridMap map = createMap();
+  map.move(Position(1.37, -2.11));
+  setWavyTerrain(map);
+  GridMap mapUnmoved = createMap();
+  mapUnmoved.setPosition(map.getPosition());
+  setWavyTerrain(mapUnmoved);
+
+  const Position observerPosition(2.21, -1.35);
+  ASSERT_TRUE(computeViewshed(map, "elevation", "visibility", observerPosition, 0.5));
+  ASSERT_TRUE(computeViewshed(mapUnmoved, "elevation", "visibility", observerPosition, 0.5, 0.0,
+                              std::numeric_limits<double>::infinity(), 1));
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    ASSERT_EQ(mapUnmoved.atPosition("visibility", position), map.at("visibility", *iterator));
+  }
+}
+
+TEST(Viewshed, RangeAndInvalidCells)
+{
+  GridMap map = createMap();
+  map.atPosition("elevation", Position(1.0, 1.0)) = NAN;
+  ASSERT_TRUE(computeViewshed(map, "elevation", "visibility", Position(0.0, 0.0), 1.0, 0.0, 2.0));
+  EXPECT_TRUE(std::isnan(map.atPosition("visibility", Position(1.0, 1.0))));
+  EXPECT_EQ(1.0, map.atPosition("visibility", Position(1.9, 0.0)));
+  EXPECT_EQ(0.0, map.atPosition("visibility", Position(2.1, 0.0)));
+  EXPECT_EQ(0.0, map.atPosition("visibility", Position(1.5, 1.5)));
+
+  EXPECT_FALSE(computeViewshed(map, "elevation", "visibility", Position(1.0, 1.0), 1.0));
+  EXPECT_FALSE(computeViewshed(map, "elevation", "visibility", Position(20.0, 0.0), 1.0));
+}
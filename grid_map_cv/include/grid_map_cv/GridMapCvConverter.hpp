@@ -14,6 +14,7 @@
 #include <cv_bridge/cv_bridge.h>
 
 // STD
+#include <cmath>
 #include <iostream>
 
 namespace grid_map {
@@ -174,8 +175,11 @@ class GridMapCvConverter
   static bool toImage(const grid_map::GridMap& gridMap, const std::string& layer,
                       const int encoding, cv::Mat& image)
   {
-    const float minValue = gridMap.get(layer).minCoeffOfFinites();
-    const float maxValue = gridMap.get(layer).maxCoeffOfFinites();
+    const grid_map::Matrix& data = gridMap.get(layer);
+    const grid_map::simd::FiniteStatistics statistics = grid_map::simd::computeFiniteStatistics(data.data(), data.size());
+    // Without finite values, NAN as from minCoeffOfFinites() and maxCoeffOfFinites().
+    const float minValue = statistics.count > 0 ? statistics.min : NAN;
+    const float maxValue = statistics.count > 0 ? statistics.max : NAN;
     return toImage<Type_, NChannels_>(gridMap, layer, encoding, minValue, maxValue, image);
   }
 
@@ -214,9 +218,8 @@ class GridMapCvConverter
     }
 
     // Clamp outliers.
-    grid_map::GridMap map = gridMap;
-    map.get(layer) = map.get(layer).unaryExpr(grid_map::Clamp<float>(lowerValue, upperValue));
-    const grid_map::Matrix& data = map[layer];
+    grid_map::Matrix data = gridMap.get(layer);
+    grid_map::simd::scaleAndClamp(data.data(), data.data(), data.size(), 1.0F, 0.0F, lowerValue, upperValue);
 
     // Convert to image.
     bool isColor = false;
@@ -224,7 +227,7 @@ class GridMapCvConverter
     bool hasAlpha = false;
     if (image.channels() >= 4) hasAlpha = true;
 
-    for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    for (GridMapIterator iterator(gridMap); !iterator.isPastEnd(); ++iterator) {
       const Index index(*iterator);
       const float& value = data(index(0), index(1));
       if (std::isfinite(value)) {
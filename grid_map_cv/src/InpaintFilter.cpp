@@ -78,8 +78,11 @@ bool InpaintFilter<T>::update(const T& mapIn, T& mapOut) {
   cv::Mat originalImage;
   cv::Mat mask;
   cv::Mat filledImage;
-  const float minValue = mapOut.get(inputLayer_).minCoeffOfFinites();
-  const float maxValue = mapOut.get(inputLayer_).maxCoeffOfFinites();
+  const grid_map::Matrix& data = mapOut.get(inputLayer_);
+  const grid_map::simd::FiniteStatistics statistics = grid_map::simd::computeFiniteStatistics(data.data(), data.size());
+  // Without finite values, NAN as from minCoeffOfFinites() and maxCoeffOfFinites().
+  const float minValue = statistics.count > 0 ? statistics.min : NAN;
+  const float maxValue = statistics.count > 0 ? statistics.max : NAN;
 
   grid_map::GridMapCvConverter::toImage<unsigned char, 3>(mapOut, inputLayer_, CV_8UC3, minValue, maxValue,
                                                           originalImage);
@@ -0,0 +1,80 @@
+/*
+ * allocation_benchmark.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <grid_map_core/grid_map_core.hpp>
+#include <grid_map_core/utils/parallel.hpp>
+#include <chrono>
+#include <iostream>
+
+using namespace std;
+using namespace std::chrono;
+using namespace grid_map;
+
+#define duration(a) duration_cast<milliseconds>(a).count()
+typedef high_resolution_clock clk;
+
+/*!
+ * Parallel pass over all layers with the same partitioning as the first touch
+ * (contiguous chunks of the linear index), as done by parallel filters.
+ */
+double runParallelPass(GridMap& map)
+{
+  double sum = 0.0;
+  for (const auto& layer : map.getLayers()) {
+    Matrix& data = map[layer];
+    parallelFor(0, data.size(), [&data](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        data(i) = 0.5f * data(i) + 1.0f;
+      }
+    });
+    sum += data(0);
+  }
+  return sum;
+}
+
+void runBenchmark(const string& name, const LayerAllocationOptions& options)
+{
+  GridMap map;
+  map.setAllocationOptions(options);
+  map.setGeometry(Length(80.0, 80.0), 0.02, Position(0.0, 0.0));
+
+  clk::time_point t1 = clk::now();
+  for (int i = 0; i < 8; ++i) {
+    map.add("layer" + to_string(i), 0.0);
+  }
+  clk::time_point t2 = clk::now();
+  cout << name << ": allocation and initialization " << duration(t2 - t1) << " ms";
+
+  t1 = clk::now();
+  double sum = 0.0;
+  for (int i = 0; i < 5; ++i) {
+    sum += runParallelPass(map);
+  }
+  t2 = clk::now();
+  cout << ", 5 parallel passes " << duration(t2 - t1) << " ms (" << sum << ")" << endl;
+}
+
+int main()
+{
+  cout << "Results for 8 layers of 4000 x 4000 cells (" << 8 * 4000 * 4000 * sizeof(float) / (1 << 20) << " MB) with "
+       << getNumberOfThreads() << " threads." << endl;
+  cout << "=========================================" << endl;
+
+  runBenchmark("Default allocation", LayerAllocationOptions());
+
+  LayerAllocationOptions options;
+  options.transparentHugePages = true;
+  runBenchmark("Transparent huge pages", options);
+
+  options.transparentHugePages = false;
+  options.firstTouchThreads = 0;
+  runBenchmark("Parallel first touch", options);
+
+  options.transparentHugePages = true;
+  runBenchmark("Huge pages and parallel first touch", options);
+
+  return 0;
+}
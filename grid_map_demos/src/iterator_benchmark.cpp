@@ -58,6 +58,22 @@ void runGridMapIteratorVersion3(GridMap& map, const string& layer_from, const st
   }
 }
 
+/*!
+ * STL conforming range with incremental indices.
+ */
+void runGridMapRange(GridMap& map, const string& layer_from, const string& layer_to)
+{
+  const auto& data_from = map[layer_from];
+  auto& data_to = map[layer_to];
+  GridMapRange range(map);
+  for (auto iterator = range.begin(); iterator != range.end(); ++iterator) {
+    const size_t i = iterator.getLinearIndex();
+    const float value_from = data_from(i);
+    float& value_to = data_to(i);
+    value_to = value_to > value_from ? value_to : value_from;
+  }
+}
+
 /*!
  * Whenever possible, make use of the Eigen methods for maximum efficiency
  * and readability.
@@ -67,6 +83,15 @@ void runEigenFunction(GridMap& map, const string& layer_from, const string& laye
   map[layer_to] = map[layer_to].cwiseMax(map[layer_from]);
 }
 
+/*!
+ * Zipped cell visitor, resolves the layers once and iterates by linear index.
+ */
+void runForEachCell(GridMap& map, const string& layer_from, const string& layer_to)
+{
+  forEachCell(map, [](float& value_to, const float& value_from) { value_to = value_to > value_from ? value_to : value_from; },
+              layer_to, layer_from);
+}
+
 /*!
  * For comparison.
  */
@@ -107,6 +132,8 @@ int main()
   map.add("layer4", 0.0);
   map.add("layer5", 0.0);
   map.add("layer6", 0.0);
+  map.add("layer7", 0.0);
+  map.add("layer8", 0.0);
 
   cout << "Results for iteration over " << map.getSize()(0) << " x " << map.getSize()(1) << " (" << map.getSize().prod() << ") grid cells." << endl;
   cout << "=========================================" << endl;
@@ -126,6 +153,16 @@ int main()
   t2 = clk::now();
   cout << "Duration grid map iterator (linear index): " << duration(t2 - t1) << " ms" << endl;
 
+  t1 = clk::now();
+  runGridMapRange(map, "random", "layer7");
+  t2 = clk::now();
+  cout << "Duration grid map range (linear index): " << duration(t2 - t1) << " ms" << endl;
+
+  t1 = clk::now();
+  runForEachCell(map, "random", "layer8");
+  t2 = clk::now();
+  cout << "Duration for each cell visitor: " << duration(t2 - t1) << " ms" << endl;
+
   t1 = clk::now();
   runEigenFunction(map, "random", "layer4");
   t2 = clk::now();
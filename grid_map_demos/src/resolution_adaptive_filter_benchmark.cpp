@@ -0,0 +1,99 @@
+/*
+ * resolution_adaptive_filter_benchmark.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <filters/filter_base.hpp>
+#include <grid_map_core/grid_map_core.hpp>
+#include <grid_map_filters/MeanInRadiusFilter.hpp>
+#include <grid_map_filters/ResolutionAdaptiveFilter.hpp>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace std;
+using namespace std::chrono;
+using namespace grid_map;
+
+#define duration(a) duration_cast<milliseconds>(a).count()
+typedef high_resolution_clock clk;
+
+using BASE = filters::FilterBase<GridMap>;
+
+XmlRpc::XmlRpcValue getMeanInRadiusConfig()
+{
+  XmlRpc::XmlRpcValue params;
+  params["input_layer"] = "elevation";
+  params["output_layer"] = "elevation_smooth";
+  params["radius"] = 0.5;
+
+  XmlRpc::XmlRpcValue config;
+  config["name"] = "mean_in_radius";
+  config["type"] = "gridMapFilters/MeanInRadiusFilter";
+  config["params"] = params;
+  return config;
+}
+
+/*!
+ * Root mean square error of the valid cells of a layer with respect to a reference.
+ */
+double getRootMeanSquareError(const Matrix& data, const Matrix& reference)
+{
+  double sum = 0.0;
+  int n = 0;
+  for (Eigen::Index i = 0; i < data.size(); ++i) {
+    if (std::isnan(data(i)) || std::isnan(reference(i))) continue;
+    sum += (data(i) - reference(i)) * (data(i) - reference(i));
+    ++n;
+  }
+  return n > 0 ? std::sqrt(sum / n) : NAN;
+}
+
+int main()
+{
+  // Rough terrain: smooth hills with noise.
+  GridMap map({"elevation"});
+  map.setGeometry(Length(20.0, 20.0), 0.05, Position(0.0, 0.0));
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    map.at("elevation", *iterator) = std::sin(0.5 * position.x()) * std::cos(0.7 * position.y());
+  }
+  map["elevation"] += 0.05 * Matrix::Random(map.getSize()(0), map.getSize()(1));
+
+  cout << "Results for mean in radius (0.5 m) on " << map.getSize()(0) << " x " << map.getSize()(1) << " cells." << endl;
+  cout << "=========================================" << endl;
+
+  MeanInRadiusFilter meanInRadiusFilter;
+  meanInRadiusFilter.BASE::configure(getMeanInRadiusConfig());
+  GridMap reference;
+  clk::time_point t1 = clk::now();
+  meanInRadiusFilter.update(map, reference);
+  clk::time_point t2 = clk::now();
+  cout << "Full resolution: " << duration(t2 - t1) << " ms" << endl;
+
+  for (const int factor : {2, 4}) {
+    XmlRpc::XmlRpcValue params;
+    params["factor"] = factor;
+    params["input_layers"][0] = "elevation";
+    params["output_layers"][0] = "elevation_smooth";
+    params["filters"][0] = getMeanInRadiusConfig();
+
+    XmlRpc::XmlRpcValue config;
+    config["name"] = "resolution_adaptive";
+    config["type"] = "gridMapFilters/ResolutionAdaptiveFilter";
+    config["params"] = params;
+
+    ResolutionAdaptiveFilter resolutionAdaptiveFilter;
+    resolutionAdaptiveFilter.BASE::configure(config);
+    GridMap result;
+    t1 = clk::now();
+    resolutionAdaptiveFilter.update(map, result);
+    t2 = clk::now();
+    cout << "Factor " << factor << ": " << duration(t2 - t1) << " ms, RMSE to full resolution "
+         << getRootMeanSquareError(result["elevation_smooth"], reference["elevation_smooth"]) << " m" << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,236 @@
+/*
+ * FilterChainPipeline.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ros/node_handle.h>
+
+#include <grid_map_core/GridMap.hpp>
+
+namespace grid_map {
+
+/*!
+ * Executes a filter chain on a stream of maps as a pipeline: contiguous groups of filters (stages) run on separate
+ * threads, connected by bounded queues, such that map N+1 enters the first stage while map N is in the second stage.
+ * The throughput is limited by the slowest stage instead of the whole chain. The maps leave the pipeline in the order
+ * they entered it.
+ */
+class FilterChainPipeline {
+ public:
+  //! Function of a stage, computes the output map from the input map. Returns false on failure (the map is dropped).
+  using StageFunction = std::function<bool(const GridMap& mapIn, GridMap& mapOut)>;
+
+  //! Callback for the maps leaving the pipeline, called on the thread of the last stage.
+  using Callback = std::function<void(const GridMap& map)>;
+
+  //! Statistics of a stage.
+  struct StageStatistics {
+    //! Number of maps processed by the stage.
+    size_t numberOfMaps = 0;
+
+    //! Average duration of the stage per map [s].
+    double averageDuration = 0.0;
+
+    //! Fraction of the time since the start the stage was busy.
+    double utilization = 0.0;
+  };
+
+  //! Statistics of the pipeline.
+  struct Statistics {
+    //! Statistics per stage.
+    std::vector<StageStatistics> stages;
+
+    //! Number of maps that left the pipeline.
+    size_t numberOfMaps = 0;
+
+    //! Number of maps dropped because the input queue was full.
+    size_t numberOfDroppedMaps = 0;
+
+    //! Number of maps dropped because a stage failed.
+    size_t numberOfFailedMaps = 0;
+
+    //! Maps that left the pipeline per second since the start.
+    double throughput = 0.0;
+
+    //! Average time from entering to leaving the pipeline [s].
+    double averageLatency = 0.0;
+
+    //! Maximum time from entering to leaving the pipeline [s].
+    double maxLatency = 0.0;
+  };
+
+  /*!
+   * Constructor.
+   * @param queueSize the maximum number of maps waiting in front of each stage.
+   */
+  explicit FilterChainPipeline(size_t queueSize = 1);
+
+  /*!
+   * Destructor, stops the pipeline (maps in the pipeline are discarded).
+   */
+  virtual ~FilterChainPipeline();
+
+  /*!
+   * Adds a stage at the end of the pipeline. Only allowed before `start()`.
+   * @param stageFunction the function of the stage.
+   */
+  void addStage(StageFunction stageFunction);
+
+  /*!
+   * Loads a filter chain from the parameter server and adds it as stages, each with its own filter chain.
+   * @param parameterName the name of the filter chain parameter (list of filters, as for filters::FilterChain).
+   * @param numberOfFiltersPerStage the number of consecutive filters of each stage, they have to add up to the number of
+   * filters of the chain. If empty, every filter is a stage.
+   * @param nodeHandle the node handle.
+   * @return true if successful.
+   */
+  bool configure(const std::string& parameterName, const std::vector<size_t>& numberOfFiltersPerStage,
+                 ros::NodeHandle nodeHandle = ros::NodeHandle());
+
+  /*!
+   * Starts the threads of the stages.
+   * @param callback the callback for the maps leaving the pipeline.
+   */
+  void start(Callback callback);
+
+  /*!
+   * Stops the threads of the stages, maps in the pipeline are discarded.
+   */
+  void stop();
+
+  /*!
+   * Adds a map to the pipeline, waiting while the input queue is full. Only allowed after `start()`.
+   * @param map the map.
+   */
+  void push(const GridMap& map);
+
+  /*!
+   * Adds a map to the pipeline if the input queue is not full, e.g. from a subscriber callback. Only allowed after `start()`.
+   * @param map the map.
+   * @return false if the map was dropped because the queue is full.
+   */
+  bool tryPush(const GridMap& map);
+
+  /*!
+   * Waits until all maps that were added left the pipeline (or were dropped).
+   */
+  void waitUntilIdle();
+
+  /*!
+   * Gets the number of stages.
+   * @return the number of stages.
+   */
+  size_t getNumberOfStages() const;
+
+  /*!
+   * Gets the statistics since the start.
+   * @return the statistics.
+   */
+  Statistics getStatistics() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  //! Map in the pipeline.
+  struct Item {
+    //! Map.
+    GridMap map;
+
+    //! Time the map entered the pipeline.
+    Clock::time_point entryTime;
+  };
+
+  //! Bounded queue in front of a stage.
+  struct Queue {
+    std::deque<Item> items;
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    bool isStopped = false;
+  };
+
+  //! Stage of the pipeline.
+  struct Stage {
+    //! Function of the stage.
+    StageFunction function;
+
+    //! Queue in front of the stage.
+    Queue queue;
+
+    //! Thread of the stage.
+    std::thread thread;
+
+    //! Number of processed maps.
+    size_t numberOfMaps = 0;
+
+    //! Time the stage was busy.
+    Clock::duration busyDuration = Clock::duration::zero();
+  };
+
+  /*!
+   * Adds an item to the queue in front of a stage.
+   * @param stageIndex the index of the stage.
+   * @param item the item.
+   * @param wait whether to wait while the queue is full.
+   * @return false if the item was not added because the queue is full (or the pipeline stopped).
+   */
+  bool pushToStage(size_t stageIndex, Item&& item, bool wait);
+
+  /*!
+   * Loop of the thread of a stage.
+   * @param stageIndex the index of the stage.
+   */
+  void runStage(size_t stageIndex);
+
+  /*!
+   * Counts a map as finished (left the pipeline or dropped).
+   */
+  void finishMap();
+
+  //! Maximum number of maps in each queue.
+  size_t queueSize_;
+
+  //! Stages.
+  std::vector<std::unique_ptr<Stage>> stages_;
+
+  //! Callback for the maps leaving the pipeline.
+  Callback callback_;
+
+  //! Whether the threads are running (read by the producers while `stop()` writes it).
+  std::atomic<bool> isRunning_;
+
+  //! Mutex for the statistics and the counters.
+  mutable std::mutex statisticsMutex_;
+
+  //! Signals that a map finished.
+  std::condition_variable mapFinished_;
+
+  //! Number of maps that entered and did not finish yet.
+  size_t numberOfMapsInPipeline_;
+
+  //! Statistics (except of the stages).
+  Statistics statistics_;
+
+  //! Sum of the latencies [s].
+  double latencySum_;
+
+  //! Time of the start.
+  Clock::time_point startTime_;
+};
+
+}  // namespace grid_map
@@ -0,0 +1,21 @@
+/*
+ * FilterChainSupport.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <filters/filter_base.hpp>
+
+namespace grid_map {
+
+/*!
+ * Gets the support radius of a filter chain, i.e. how far a change of the inputs can affect the outputs. The support
+ * radii of the filters (optional parameter `support_radius`, zero if not set) add up along the chain.
+ * @param filters the list of filters of the chain (same format as for a filters::FilterChain).
+ * @return the support radius of the chain [m].
+ */
+double getFilterChainSupportRadius(XmlRpc::XmlRpcValue& filters);
+
+}  // namespace grid_map
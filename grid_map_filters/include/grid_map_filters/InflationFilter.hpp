@@ -0,0 +1,96 @@
+/*
+ * InflationFilter.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <filters/filter_base.hpp>
+#include <grid_map_core/GridMap.hpp>
+
+namespace grid_map {
+
+/*!
+ * Filter class to inflate lethal cells with a cost that decays with the distance (as the costmap_2d inflation layer).
+ * The exact Euclidean distance to the lethal cells is computed with the separable distance transform of grid_map_sdf,
+ * and mapped to a cost with a lookup table. The computation time does not depend on the inflation radius.
+ */
+class InflationFilter : public filters::FilterBase<GridMap> {
+ public:
+  /*!
+   * Constructor.
+   */
+  InflationFilter();
+
+  /*!
+   * Destructor.
+   */
+  ~InflationFilter() override;
+
+  /*!
+   * Configures the filter from parameters on the Parameter Server.
+   */
+  bool configure() override;
+
+  /*!
+   * Computes the inflation cost of each cell from the distance to the closest lethal cell (distance from the cell center to the
+   * border of the lethal cell):
+   *  - lethal cells get the lethal cost,
+   *  - cells within the inscribed radius get the inscribed cost,
+   *  - cells within the inflation radius get the inscribed cost decayed over the distance from the inscribed radius,
+   *  - other cells get zero cost.
+   * Cells with NAN input are not lethal and stay NAN.
+   * @param mapIn grid map containing the input layer.
+   * @param mapOut grid map containing the original layers and the inflation cost layer.
+   */
+  bool update(const GridMap& mapIn, GridMap& mapOut) override;
+
+ private:
+  //! Decay of the cost between the inscribed and the inflation radius.
+  enum class Decay { Exponential, Linear };
+
+  /*!
+   * Computes the cost for all (squared) distances that can occur within the inflation radius.
+   * @param resolution resolution of the map.
+   */
+  void computeLookupTable(double resolution);
+
+  //! Input layer name.
+  std::string inputLayer_;
+
+  //! Output layer name.
+  std::string outputLayer_;
+
+  //! Cells with an input value above (or equal to) this threshold are lethal.
+  double lethalThreshold_;
+
+  //! Radius up to which the cost decays [m].
+  double inflationRadius_;
+
+  //! Radius in which the cost is the inscribed cost [m].
+  double inscribedRadius_;
+
+  //! Decay type.
+  Decay decay_;
+
+  //! Rate of the exponential decay [1/m].
+  double costScalingFactor_;
+
+  //! Cost of the lethal cells.
+  double lethalCost_;
+
+  //! Cost of the cells within the inscribed radius.
+  double inscribedCost_;
+
+  //! Cost per squared distance, indexed by 4 * (distance [cells])^2, which is an integer for the distance to a cell border.
+  std::vector<float> costLookupTable_;
+
+  //! Resolution the lookup table was computed for.
+  double lookupTableResolution_;
+};
+
+}  // namespace grid_map
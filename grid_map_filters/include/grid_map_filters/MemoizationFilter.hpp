@@ -0,0 +1,117 @@
+/*
+ * MemoizationFilter.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <filters/filter_base.hpp>
+#include <filters/filter_chain.hpp>
+#include <grid_map_core/Fingerprint.hpp>
+#include <grid_map_core/GridMap.hpp>
+
+namespace grid_map {
+
+/*!
+ * Filter class to skip a filter chain where its inputs did not change since the previous update, e.g. for static
+ * regions or layers of slow sensors.
+ *
+ * The input layers are fingerprinted per tile (`tile_size` cells per dimension, in buffer coordinates). If the map
+ * geometry is the same as in the previous update, or the map was moved (see `GridMap::move(...)`), the chain
+ * (parameter `filters`, same format as for a filters::FilterChain) is only run on the regions of the changed tiles and
+ * the new regions of a move, expanded by the support radius of the filters (sum of the optional `support_radius`
+ * parameters of the filters of the chain), and the previous output layers are reused elsewhere. Close regions are
+ * merged if this does not increase the number of computed cells. The outputs must only depend on the declared
+ * `input_layers` (and the parameters, which are fixed after `configure()`). If nothing changed, the previous output
+ * layers are reused without running the chain.
+ */
+class MemoizationFilter : public filters::FilterBase<GridMap> {
+ public:
+  /*!
+   * Constructor.
+   */
+  MemoizationFilter();
+
+  /*!
+   * Destructor.
+   */
+  ~MemoizationFilter() override;
+
+  /*!
+   * Configures the filter and its chain from parameters on the Parameter Server, clears the previous outputs.
+   */
+  bool configure() override;
+
+  /*!
+   * Runs the filter chain where the input layers changed.
+   * @param mapIn grid map containing the input layers.
+   * @param mapOut grid map containing the original layers and the output layers.
+   */
+  bool update(const GridMap& mapIn, GridMap& mapOut) override;
+
+  /*!
+   * Gets the number of cells the filter chain was run on in the last update (zero if the outputs were reused, summed
+   * over the regions).
+   * @return the number of cells.
+   */
+  size_t getNumberOfComputedCells() const;
+
+ private:
+  /*!
+   * Checks if a map has the same geometry (and frame) as the previous outputs.
+   * @param map the map.
+   * @return true if the geometry is the same.
+   */
+  bool hasSameGeometry(const GridMap& map) const;
+
+  /*!
+   * Runs the filter chain on the full map and stores the output layers.
+   * @param mapIn the input map.
+   * @return true if successful.
+   */
+  bool updateFullMap(const GridMap& mapIn);
+
+  /*!
+   * Runs the filter chain on a region (with its support) and writes the output layers back into the previous ones.
+   * @param mapIn the input map.
+   * @param regionIndex the first cell of the region (unwrapped index).
+   * @param regionSize the size of the region.
+   * @param supportCells the support radius of the chain in cells.
+   * @return true if successful.
+   */
+  bool updateRegion(const GridMap& mapIn, const Index& regionIndex, const Size& regionSize, int supportCells);
+
+  //! Filter chain.
+  filters::FilterChain<GridMap> filterChain_;
+
+  //! Layers the outputs depend on.
+  std::vector<std::string> inputLayers_;
+
+  //! Layers computed by the chain.
+  std::vector<std::string> outputLayers_;
+
+  //! Number of cells of the tiles per dimension.
+  int tileSize_;
+
+  //! Support radius of the chain.
+  double supportRadius_;
+
+  //! Whether there are previous outputs.
+  bool hasPreviousOutputs_;
+
+  //! Output layers of the previous update (with the geometry of its input map).
+  GridMap previousOutputs_;
+
+  //! Combined fingerprints of the tiles of the input layers of the previous update.
+  TileFingerprints previousFingerprints_;
+
+  //! Number of cells the chain was run on in the last update.
+  size_t numberOfComputedCells_;
+};
+
+}  // namespace grid_map
@@ -101,11 +101,10 @@ class NormalVectorsFilter : public filters::FilterBase<GridMap> {
    *
    * @param map: grid map containing the layer for which the normal vectors are computed for.
    * @param inputLayer: Layer the normal vector should be computed for.
-   * @param outputLayersPrefix: Output layer name prefix.
+   * @param normals: Output vector layer of the normal vectors.
    * @param index: Index of point in the grid map for which this function calculates the normal vector.
    */
-  void areaSingleNormalComputation(GridMap& map, const std::string& inputLayer, const std::string& outputLayersPrefix,
-                                   const grid_map::Index& index);
+  void areaSingleNormalComputation(GridMap& map, const std::string& inputLayer, VectorLayer<3>& normals, const grid_map::Index& index);
   /*!
    * Estimate the normal vector at each point of the input layer by using the rasterSingleNormalComputation function.
    * This function makes use of the raster method and is the serial version of such normal vector computation using a
@@ -152,14 +151,11 @@ class NormalVectorsFilter : public filters::FilterBase<GridMap> {
    *
    * Finally, the sign normal vector is correct to be in the same direction as the user defined "normal vector positive axis"
    *
-   * @param map: grid map containing the layer for which the normal vectors are computed for.
-   * @param inputLayer: Layer the normal vector should be computed for.
-   * @param outputLayersPrefix: Output layer name prefix.
+   * @param normals: Output vector layer of the normal vectors.
    * @param dataMap: Matrix containing the input layer of the grid map in question.
    * @param index: Index of point in the grid map for which this function calculates the normal vector.
    */
-  void rasterSingleNormalComputation(GridMap& map, const std::string& outputLayersPrefix, const grid_map::Matrix& dataMap,
-                                     const grid_map::Index& index);
+  void rasterSingleNormalComputation(VectorLayer<3>& normals, const grid_map::Matrix& dataMap, const grid_map::Index& index);
 
   enum class Method { AreaSerial, AreaParallel, RasterSerial, RasterParallel };
 
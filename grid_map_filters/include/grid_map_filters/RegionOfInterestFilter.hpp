@@ -0,0 +1,69 @@
+/*
+ * RegionOfInterestFilter.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <string>
+
+#include <filters/filter_base.hpp>
+#include <filters/filter_chain.hpp>
+#include <grid_map_core/GridMap.hpp>
+
+namespace grid_map {
+
+/*!
+ * Filter class to run a filter chain only inside a region of interest (e.g. around the robot), such that the
+ * computation time of expensive filters scales with the area of the region instead of the map.
+ *
+ * The chain (parameter `filters`, same format as for a filters::FilterChain) is run on a submap of the region,
+ * expanded by the support radius of the filters (sum of the optional `support_radius` parameters of the filters of
+ * the chain), such that the results inside the region are the same as for the full map. The results inside the
+ * region are written back into the map, cells outside of it keep their values, and the cells of layers added by the
+ * chain are NAN (unknown) outside of it.
+ * The region is centered at the map position (robot-centric maps) or at `position_x`, `position_y` if set.
+ */
+class RegionOfInterestFilter : public filters::FilterBase<GridMap> {
+ public:
+  /*!
+   * Constructor.
+   */
+  RegionOfInterestFilter();
+
+  /*!
+   * Destructor.
+   */
+  ~RegionOfInterestFilter() override;
+
+  /*!
+   * Configures the filter and its chain from parameters on the Parameter Server.
+   */
+  bool configure() override;
+
+  /*!
+   * Runs the filter chain inside the region of interest.
+   * @param mapIn grid map to filter.
+   * @param mapOut grid map with the results of the filter chain inside the region of interest.
+   */
+  bool update(const GridMap& mapIn, GridMap& mapOut) override;
+
+ private:
+  //! Filter chain to run inside the region of interest.
+  filters::FilterChain<GridMap> filterChain_;
+
+  //! Length of the region of interest [m].
+  Length length_;
+
+  //! Whether the region of interest has a fixed position, otherwise it is centered at the map position.
+  bool hasFixedPosition_;
+
+  //! Fixed position of the region of interest [m].
+  Position position_;
+
+  //! Sum of the support radii of the filters of the chain [m].
+  double supportRadius_;
+};
+
+}  // namespace grid_map
@@ -0,0 +1,89 @@
+/*
+ * ResolutionAdaptiveFilter.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <filters/filter_base.hpp>
+#include <filters/filter_chain.hpp>
+#include <grid_map_core/GridMap.hpp>
+
+namespace grid_map {
+
+/*!
+ * Filter class to run expensive filters at a coarser resolution: the input layers are downsampled by an integer
+ * factor (NAN-aware mean, min or max pooling of the cells), the filter chain (parameter `filters`, same format as for
+ * a filters::FilterChain) is run on the coarse map, and the output layers are upsampled bilinearly to the original
+ * resolution. The computation time of the chain decreases with the square of the factor.
+ */
+class ResolutionAdaptiveFilter : public filters::FilterBase<GridMap> {
+ public:
+  //! Pooling of the cells of the fine map into a coarse cell.
+  enum class Pooling { Mean, Min, Max };
+
+  /*!
+   * Constructor.
+   */
+  ResolutionAdaptiveFilter();
+
+  /*!
+   * Destructor.
+   */
+  ~ResolutionAdaptiveFilter() override;
+
+  /*!
+   * Configures the filter and its chain from parameters on the Parameter Server.
+   */
+  bool configure() override;
+
+  /*!
+   * Runs the filter chain at the coarse resolution.
+   * @param mapIn grid map containing the input layers.
+   * @param mapOut grid map containing the original layers and the upsampled output layers.
+   */
+  bool update(const GridMap& mapIn, GridMap& mapOut) override;
+
+  /*!
+   * Downsamples layers of a map. The coarse map covers the fine map, with the same top left corner. The coarse cells
+   * at the bottom and right border may cover less fine cells if the size is not a multiple of the factor.
+   * @param fineMap the map to downsample.
+   * @param layers the layers to downsample.
+   * @param factor the downsampling factor.
+   * @param pooling the pooling of the cells, NAN cells are ignored (NAN if all cells are NAN).
+   * @param coarseMap the coarse map with the layers.
+   */
+  static void downsample(const GridMap& fineMap, const std::vector<std::string>& layers, int factor, Pooling pooling,
+                         GridMap& coarseMap);
+
+  /*!
+   * Upsamples layers of a coarse map (from `downsample()`) bilinearly, NAN cells are ignored.
+   * @param coarseMap the coarse map.
+   * @param layers the layers to upsample.
+   * @param factor the downsampling factor of the coarse map.
+   * @param fineMap the map to write the layers to, they are added if they do not exist.
+   */
+  static void upsample(const GridMap& coarseMap, const std::vector<std::string>& layers, int factor, GridMap& fineMap);
+
+ private:
+  //! Filter chain to run at the coarse resolution.
+  filters::FilterChain<GridMap> filterChain_;
+
+  //! Downsampling factor.
+  int factor_;
+
+  //! Pooling of the input layers.
+  Pooling pooling_;
+
+  //! Layers to downsample.
+  std::vector<std::string> inputLayers_;
+
+  //! Layers to upsample.
+  std::vector<std::string> outputLayers_;
+};
+
+}  // namespace grid_map
@@ -0,0 +1,262 @@
+/*
+ * FilterChainPipeline.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_filters/FilterChainPipeline.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include <filters/filter_chain.hpp>
+
+namespace grid_map {
+
+FilterChainPipeline::FilterChainPipeline(size_t queueSize)
+    : queueSize_(std::max<size_t>(queueSize, 1)), isRunning_(false), numberOfMapsInPipeline_(0), latencySum_(0.0) {}
+
+FilterChainPipeline::~FilterChainPipeline() {
+  stop();
+}
+
+void FilterChainPipeline::addStage(StageFunction stageFunction) {
+  if (isRunning_) {
+    throw std::logic_error("FilterChainPipeline: stages cannot be added while the pipeline is running.");
+  }
+  stages_.emplace_back(new Stage());
+  stages_.back()->function = std::move(stageFunction);
+}
+
+bool FilterChainPipeline::configure(const std::string& parameterName, const std::vector<size_t>& numberOfFiltersPerStage,
+                                    ros::NodeHandle nodeHandle) {
+  XmlRpc::XmlRpcValue config;
+  if (!nodeHandle.getParam(parameterName, config) || config.getType() != XmlRpc::XmlRpcValue::TypeArray) {
+    ROS_ERROR("FilterChainPipeline did not find the list of filters '%s'.", parameterName.c_str());
+    return false;
+  }
+
+  std::vector<size_t> stageSizes = numberOfFiltersPerStage;
+  if (stageSizes.empty()) {
+    stageSizes.assign(config.size(), 1);
+  }
+  if (std::accumulate(stageSizes.begin(), stageSizes.end(), size_t(0)) != static_cast<size_t>(config.size())) {
+    ROS_ERROR("FilterChainPipeline: the filters per stage do not add up to the %d filters of '%s'.", config.size(),
+              parameterName.c_str());
+    return false;
+  }
+
+  int firstFilter = 0;
+  for (const auto stageSize : stageSizes) {
+    XmlRpc::XmlRpcValue stageConfig;
+    stageConfig.setSize(static_cast<int>(stageSize));
+    for (int i = 0; i < static_cast<int>(stageSize); ++i) {
+      stageConfig[i] = config[firstFilter + i];
+    }
+    firstFilter += static_cast<int>(stageSize);
+
+    auto filterChain = std::make_shared<filters::FilterChain<GridMap>>("grid_map::GridMap");
+    if (!filterChain->configure(stageConfig, nodeHandle.getNamespace())) {
+      ROS_ERROR("FilterChainPipeline could not configure the filter chain of stage %zu.", stages_.size());
+      return false;
+    }
+    addStage([filterChain](const GridMap& mapIn, GridMap& mapOut) { return filterChain->update(mapIn, mapOut); });
+  }
+  return true;
+}
+
+void FilterChainPipeline::start(Callback callback) {
+  if (isRunning_) {
+    return;
+  }
+  callback_ = std::move(callback);
+  {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
+    statistics_ = Statistics();
+    latencySum_ = 0.0;
+    for (auto& stage : stages_) {
+      stage->numberOfMaps = 0;
+      stage->busyDuration = Clock::duration::zero();
+    }
+    startTime_ = Clock::now();
+  }
+  for (auto& stage : stages_) {
+    std::lock_guard<std::mutex> lock(stage->queue.mutex);
+    stage->queue.isStopped = false;
+  }
+  for (size_t i = 0; i < stages_.size(); ++i) {
+    stages_[i]->thread = std::thread(&FilterChainPipeline::runStage, this, i);
+  }
+  isRunning_ = true;
+}
+
+void FilterChainPipeline::stop() {
+  if (!isRunning_) {
+    return;
+  }
+  for (auto& stage : stages_) {
+    std::lock_guard<std::mutex> lock(stage->queue.mutex);
+    stage->queue.isStopped = true;
+    stage->queue.notEmpty.notify_all();
+    stage->queue.notFull.notify_all();
+  }
+  for (auto& stage : stages_) {
+    stage->thread.join();
+  }
+
+  // Discard the maps left in the queues.
+  size_t numberOfDiscardedMaps = 0;
+  for (auto& stage : stages_) {
+    numberOfDiscardedMaps += stage->queue.items.size();
+    stage->queue.items.clear();
+  }
+  {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
+    numberOfMapsInPipeline_ -= std::min(numberOfMapsInPipeline_, numberOfDiscardedMaps);
+  }
+  mapFinished_.notify_all();
+  isRunning_ = false;
+}
+
+void FilterChainPipeline::push(const GridMap& map) {
+  if (!isRunning_) {
+    throw std::logic_error("FilterChainPipeline: maps cannot be added before the pipeline is started.");
+  }
+  {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
+    ++numberOfMapsInPipeline_;
+  }
+  if (stages_.empty()) {
+    callback_(map);
+    finishMap();
+    return;
+  }
+  if (!pushToStage(0, Item{map, Clock::now()}, true)) {
+    finishMap();
+  }
+}
+
+bool FilterChainPipeline::tryPush(const GridMap& map) {
+  if (!isRunning_) {
+    throw std::logic_error("FilterChainPipeline: maps cannot be added before the pipeline is started.");
+  }
+  {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
+    ++numberOfMapsInPipeline_;
+  }
+  if (stages_.empty()) {
+    callback_(map);
+    finishMap();
+    return true;
+  }
+  if (!pushToStage(0, Item{map, Clock::now()}, false)) {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
+    ++statistics_.numberOfDroppedMaps;
+    --numberOfMapsInPipeline_;
+    mapFinished_.notify_all();
+    return false;
+  }
+  return true;
+}
+
+void FilterChainPipeline::waitUntilIdle() {
+  std::unique_lock<std::mutex> lock(statisticsMutex_);
+  mapFinished_.wait(lock, [this]() { return numberOfMapsInPipeline_ == 0; });
+}
+
+size_t FilterChainPipeline::getNumberOfStages() const {
+  return stages_.size();
+}
+
+FilterChainPipeline::Statistics FilterChainPipeline::getStatistics() const {
+  std::lock_guard<std::mutex> lock(statisticsMutex_);
+  Statistics statistics = statistics_;
+  const double elapsedTime = std::chrono::duration<double>(Clock::now() - startTime_).count();
+  for (const auto& stage : stages_) {
+    StageStatistics stageStatistics;
+    const double busyTime = std::chrono::duration<double>(stage->busyDuration).count();
+    stageStatistics.numberOfMaps = stage->numberOfMaps;
+    stageStatistics.averageDuration = stage->numberOfMaps > 0 ? busyTime / stage->numberOfMaps : 0.0;
+    stageStatistics.utilization = elapsedTime > 0.0 ? busyTime / elapsedTime : 0.0;
+    statistics.stages.push_back(stageStatistics);
+  }
+  statistics.throughput = elapsedTime > 0.0 ? statistics.numberOfMaps / elapsedTime : 0.0;
+  statistics.averageLatency = statistics.numberOfMaps > 0 ? latencySum_ / statistics.numberOfMaps : 0.0;
+  return statistics;
+}
+
+bool FilterChainPipeline::pushToStage(size_t stageIndex, Item&& item, bool wait) {
+  Queue& queue = stages_[stageIndex]->queue;
+  std::unique_lock<std::mutex> lock(queue.mutex);
+  if (wait) {
+    queue.notFull.wait(lock, [&]() { return queue.items.size() < queueSize_ || queue.isStopped; });
+  }
+  if (queue.isStopped || queue.items.size() >= queueSize_) {
+    return false;
+  }
+  queue.items.push_back(std::move(item));
+  queue.notEmpty.notify_one();
+  return true;
+}
+
+void FilterChainPipeline::runStage(size_t stageIndex) {
+  Stage& stage = *stages_[stageIndex];
+  const bool isLastStage = stageIndex + 1 == stages_.size();
+  while (true) {
+    Item item;
+    {
+      std::unique_lock<std::mutex> lock(stage.queue.mutex);
+      stage.queue.notEmpty.wait(lock, [&]() { return !stage.queue.items.empty() || stage.queue.isStopped; });
+      if (stage.queue.isStopped) {
+        return;
+      }
+      item = std::move(stage.queue.items.front());
+      stage.queue.items.pop_front();
+      stage.queue.notFull.notify_one();
+    }
+
+    // Run the stage.
+    const Clock::time_point startTime = Clock::now();
+    Item output{GridMap(), item.entryTime};
+    const bool isSuccess = stage.function(item.map, output.map);
+    const Clock::time_point endTime = Clock::now();
+    {
+      std::lock_guard<std::mutex> lock(statisticsMutex_);
+      ++stage.numberOfMaps;
+      stage.busyDuration += endTime - startTime;
+      if (!isSuccess) {
+        ++statistics_.numberOfFailedMaps;
+      }
+    }
+
+    if (!isSuccess) {
+      finishMap();
+    } else if (!isLastStage) {
+      if (!pushToStage(stageIndex + 1, std::move(output), true)) {
+        finishMap();
+      }
+    } else {
+      callback_(output.map);
+      {
+        std::lock_guard<std::mutex> lock(statisticsMutex_);
+        const double latency = std::chrono::duration<double>(Clock::now() - output.entryTime).count();
+        ++statistics_.numberOfMaps;
+        latencySum_ += latency;
+        statistics_.maxLatency = std::max(statistics_.maxLatency, latency);
+      }
+      finishMap();
+    }
+  }
+}
+
+void FilterChainPipeline::finishMap() {
+  std::lock_guard<std::mutex> lock(statisticsMutex_);
+  if (numberOfMapsInPipeline_ > 0) {
+    --numberOfMapsInPipeline_;
+  }
+  mapFinished_.notify_all();
+}
+
+}  // namespace grid_map
@@ -0,0 +1,26 @@
+/*
+ * FilterChainSupport.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_filters/FilterChainSupport.hpp"
+
+namespace grid_map {
+
+double getFilterChainSupportRadius(XmlRpc::XmlRpcValue& filters) {
+  double supportRadius = 0.0;
+  for (int i = 0; i < filters.size(); ++i) {
+    if (filters[i].hasMember("params") && filters[i]["params"].hasMember("support_radius")) {
+      XmlRpc::XmlRpcValue& filterSupportRadius = filters[i]["params"]["support_radius"];
+      if (filterSupportRadius.getType() == XmlRpc::XmlRpcValue::TypeDouble) {
+        supportRadius += static_cast<double>(filterSupportRadius);
+      } else if (filterSupportRadius.getType() == XmlRpc::XmlRpcValue::TypeInt) {
+        supportRadius += static_cast<int>(filterSupportRadius);
+      }
+    }
+  }
+  return supportRadius;
+}
+
+}  // namespace grid_map
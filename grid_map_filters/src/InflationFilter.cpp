@@ -0,0 +1,176 @@
+/*
+ * InflationFilter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_filters/InflationFilter.hpp"
+
+#include <cmath>
+
+#include <tbb/tbb.h>
+
+#include <grid_map_core/grid_map_core.hpp>
+#include <grid_map_sdf/SignedDistance2d.hpp>
+#include <grid_map_sdf/Utils.hpp>
+
+using namespace filters;
+
+namespace grid_map {
+
+InflationFilter::InflationFilter()
+    : lethalThreshold_(1.0),
+      inflationRadius_(0.0),
+      inscribedRadius_(0.0),
+      decay_(Decay::Exponential),
+      costScalingFactor_(10.0),
+      lethalCost_(1.0),
+      inscribedCost_(0.99),
+      lookupTableResolution_(0.0) {}
+
+InflationFilter::~InflationFilter() = default;
+
+bool InflationFilter::configure() {
+  if (!FilterBase::getParam(std::string("input_layer"), inputLayer_)) {
+    ROS_ERROR("InflationFilter did not find parameter 'input_layer'.");
+    return false;
+  }
+  ROS_DEBUG("InflationFilter input layer is = %s.", inputLayer_.c_str());
+
+  if (!FilterBase::getParam(std::string("output_layer"), outputLayer_)) {
+    ROS_ERROR("InflationFilter did not find parameter 'output_layer'.");
+    return false;
+  }
+  ROS_DEBUG("InflationFilter output_layer = %s.", outputLayer_.c_str());
+
+  if (!FilterBase::getParam(std::string("lethal_threshold"), lethalThreshold_)) {
+    ROS_ERROR("InflationFilter did not find parameter 'lethal_threshold'.");
+    return false;
+  }
+  ROS_DEBUG("Lethal threshold = %f.", lethalThreshold_);
+
+  if (!FilterBase::getParam(std::string("inflation_radius"), inflationRadius_)) {
+    ROS_ERROR("InflationFilter did not find parameter 'inflation_radius'.");
+    return false;
+  }
+  if (inflationRadius_ < 0.0) {
+    ROS_ERROR("InflationFilter parameter 'inflation_radius' must not be negative.");
+    return false;
+  }
+  ROS_DEBUG("Inflation radius = %f.", inflationRadius_);
+
+  if (FilterBase::getParam(std::string("inscribed_radius"), inscribedRadius_) &&
+      (inscribedRadius_ < 0.0 || inscribedRadius_ > inflationRadius_)) {
+    ROS_ERROR("InflationFilter parameter 'inscribed_radius' must be between 0 and 'inflation_radius'.");
+    return false;
+  }
+  ROS_DEBUG("Inscribed radius = %f.", inscribedRadius_);
+
+  std::string decay;
+  if (!FilterBase::getParam(std::string("decay"), decay)) {
+    decay = "exponential";
+  }
+  if (decay == "exponential") {
+    decay_ = Decay::Exponential;
+  } else if (decay == "linear") {
+    decay_ = Decay::Linear;
+  } else {
+    ROS_ERROR("InflationFilter parameter 'decay' must be 'exponential' or 'linear', not '%s'.", decay.c_str());
+    return false;
+  }
+  ROS_DEBUG("Decay = %s.", decay.c_str());
+
+  if (FilterBase::getParam(std::string("cost_scaling_factor"), costScalingFactor_) && costScalingFactor_ < 0.0) {
+    ROS_ERROR("InflationFilter parameter 'cost_scaling_factor' must not be negative.");
+    return false;
+  }
+  FilterBase::getParam(std::string("lethal_cost"), lethalCost_);
+  FilterBase::getParam(std::string("inscribed_cost"), inscribedCost_);
+  ROS_DEBUG("Cost scaling factor = %f, lethal cost = %f, inscribed cost = %f.", costScalingFactor_, lethalCost_, inscribedCost_);
+
+  // The lookup table depends on the map resolution and is computed on the first update.
+  costLookupTable_.clear();
+  lookupTableResolution_ = 0.0;
+  return true;
+}
+
+bool InflationFilter::update(const GridMap& mapIn, GridMap& mapOut) {
+  mapOut = mapIn;
+  if (!mapOut.exists(inputLayer_)) {
+    ROS_ERROR("Check your input_layer! Layer %s does not exist", inputLayer_.c_str());
+    return false;
+  }
+  if (!mapOut.exists(outputLayer_)) {
+    mapOut.add(outputLayer_);
+  }
+  if (mapOut.getResolution() != lookupTableResolution_) {
+    computeLookupTable(mapOut.getResolution());
+  }
+
+  const Size size = mapOut.getSize();
+  const Index startIndex = mapOut.getStartIndex();
+  const Matrix& input = mapOut[inputLayer_];
+
+  // Squared distance in cells to the border of the closest lethal cell, on the unwrapped map.
+  Matrix squareDistance(size.x(), size.y());
+  bool hasLethalCells = false;
+  for (GridMapIterator iterator(mapOut); !iterator.isPastEnd(); ++iterator) {
+    const Index unwrappedIndex = iterator.getUnwrappedIndex();
+    const bool isLethal = input((*iterator).x(), (*iterator).y()) >= lethalThreshold_;
+    squareDistance(unwrappedIndex.x(), unwrappedIndex.y()) = isLethal ? 0.0F : signed_distance_field::INF;
+    hasLethalCells = hasLethalCells || isLethal;
+  }
+
+  Matrix& output = mapOut[outputLayer_];
+  if (!hasLethalCells) {
+    output = input.unaryExpr([](float value) { return std::isnan(value) ? value : 0.0F; });
+    return true;
+  }
+
+  // Separable exact Euclidean distance transform: columns, then rows (as columns of the transpose).
+  tbb::parallel_for(0, static_cast<int>(size.y()),
+                    [&](int col) { signed_distance_field::distanceTransform1d(squareDistance.col(col), false); });
+  Matrix squareDistanceTranspose = squareDistance.transpose();
+  tbb::parallel_for(0, static_cast<int>(size.x()),
+                    [&](int row) { signed_distance_field::distanceTransform1d(squareDistanceTranspose.col(row), false); });
+
+  // Map the squared distances to costs. With the pixel border metric, 4 times the squared distance is an integer.
+  const auto maxLookupIndex = static_cast<float>(costLookupTable_.size() - 1);
+  tbb::parallel_for(0, static_cast<int>(size.y()), [&](int unwrappedCol) {
+    const Index::Scalar col = (unwrappedCol + startIndex.y()) % size.y();
+    for (Index::Scalar unwrappedRow = 0; unwrappedRow < size.x(); ++unwrappedRow) {
+      const Index::Scalar row = (unwrappedRow + startIndex.x()) % size.x();
+      if (std::isnan(input(row, col))) {
+        output(row, col) = NAN;
+        continue;
+      }
+      const float lookupIndex = std::round(4.0F * squareDistanceTranspose(unwrappedCol, unwrappedRow));
+      output(row, col) = lookupIndex <= maxLookupIndex ? costLookupTable_[static_cast<size_t>(lookupIndex)] : 0.0F;
+    }
+  });
+
+  return true;
+}
+
+void InflationFilter::computeLookupTable(double resolution) {
+  const double radiusInCells = inflationRadius_ / resolution;
+  const auto numberOfEntries = static_cast<size_t>(std::floor(4.0 * radiusInCells * radiusInCells)) + 1;
+  costLookupTable_.resize(numberOfEntries);
+  for (size_t i = 0; i < numberOfEntries; ++i) {
+    const double distance = 0.5 * std::sqrt(static_cast<double>(i)) * resolution;
+    double cost = 0.0;
+    if (i == 0) {
+      cost = lethalCost_;
+    } else if (distance <= inscribedRadius_) {
+      cost = inscribedCost_;
+    } else if (decay_ == Decay::Exponential) {
+      cost = inscribedCost_ * std::exp(-costScalingFactor_ * (distance - inscribedRadius_));
+    } else {
+      cost = inscribedCost_ * (inflationRadius_ - distance) / (inflationRadius_ - inscribedRadius_);
+    }
+    costLookupTable_[i] = static_cast<float>(cost);
+  }
+  lookupTableResolution_ = resolution;
+}
+
+}  // namespace grid_map
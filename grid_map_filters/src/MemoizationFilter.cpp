@@ -0,0 +1,343 @@
+/*
+ * MemoizationFilter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_filters/MemoizationFilter.hpp"
+#include "grid_map_filters/FilterChainSupport.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <grid_map_core/grid_map_core.hpp>
+
+using namespace filters;
+
+namespace grid_map {
+
+namespace {
+
+/*!
+ * Calls a function for the blocks of a region of cells (unwrapped indices) in a circular buffer, with the start
+ * index of the block in the buffer, its start index in the region and its size.
+ */
+template <typename Function>
+void forEachBufferBlock(const Size& bufferSize, const Index& bufferStartIndex, const Index& regionIndex, const Size& regionSize,
+                        const Function& function) {
+  std::vector<BufferRegion> bufferRegions;
+  getBufferRegionsForSubmap(bufferRegions, getBufferIndexFromIndex(regionIndex, bufferSize, bufferStartIndex), regionSize, bufferSize,
+                            bufferStartIndex);
+  for (const auto& bufferRegion : bufferRegions) {
+    const Size& blockSize = bufferRegion.getSize();
+    const BufferRegion::Quadrant quadrant = bufferRegion.getQuadrant();
+    const bool isTop = quadrant == BufferRegion::Quadrant::TopLeft || quadrant == BufferRegion::Quadrant::TopRight;
+    const bool isLeft = quadrant == BufferRegion::Quadrant::TopLeft || quadrant == BufferRegion::Quadrant::BottomLeft;
+    const Index regionBlockIndex(isTop ? 0 : regionSize(0) - blockSize(0), isLeft ? 0 : regionSize(1) - blockSize(1));
+    function(bufferRegion.getStartIndex(), regionBlockIndex, blockSize);
+  }
+}
+
+//! Region of cells (unwrapped indices).
+struct CellRegion {
+  Index index;
+  Size size;
+};
+
+/*!
+ * Appends the regions (unwrapped indices) of a block of cells of a circular buffer, the block is split at the wrap.
+ */
+void appendUnwrappedRegions(const Index& bufferIndex, const Size& blockSize, const Size& bufferSize, const Index& bufferStartIndex,
+                            std::vector<CellRegion>& regions) {
+  // Parts of the block per dimension as (first unwrapped index, number of cells).
+  std::vector<std::pair<int, int>> parts[2];
+  for (int i = 0; i < 2; ++i) {
+    const int begin = bufferIndex(i);
+    const int end = begin + blockSize(i);
+    const int start = bufferStartIndex(i);
+    const auto addPart = [&](int partBegin, int partEnd) {
+      if (partEnd > partBegin) {
+        parts[i].emplace_back((partBegin - start + bufferSize(i)) % bufferSize(i), partEnd - partBegin);
+      }
+    };
+    if (begin < start && start < end) {
+      addPart(begin, start);
+      addPart(start, end);
+    } else {
+      addPart(begin, end);
+    }
+  }
+  for (const auto& rows : parts[0]) {
+    for (const auto& columns : parts[1]) {
+      regions.push_back(CellRegion{Index(rows.first, columns.first), Size(rows.second, columns.second)});
+    }
+  }
+}
+
+/*!
+ * Gets a region expanded by a number of cells, clipped to the map.
+ */
+CellRegion expandRegion(const CellRegion& region, int cells, const Size& mapSize) {
+  const Index index = (region.index - cells).max(0);
+  return CellRegion{index, ((region.index + region.size + cells).min(mapSize) - index).max(0)};
+}
+
+/*!
+ * Merges regions as long as the merged region (with its support) does not have more cells than the separate ones, such
+ * that the chain is run on few submaps without computing much more cells.
+ */
+void mergeRegions(std::vector<CellRegion>& regions, int supportCells, const Size& mapSize) {
+  const auto getCost = [&](const CellRegion& region) { return expandRegion(region, supportCells, mapSize).size.prod(); };
+  bool isMerged = true;
+  while (isMerged) {
+    isMerged = false;
+    for (size_t i = 0; i < regions.size(); ++i) {
+      for (size_t j = i + 1; j < regions.size();) {
+        const Index index = regions[i].index.min(regions[j].index);
+        const CellRegion merged{index, (regions[i].index + regions[i].size).max(regions[j].index + regions[j].size) - index};
+        if (getCost(merged) <= getCost(regions[i]) + getCost(regions[j])) {
+          regions[i] = merged;
+          regions.erase(regions.begin() + j);
+          isMerged = true;
+        } else {
+          ++j;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+MemoizationFilter::MemoizationFilter()
+    : filterChain_("grid_map::GridMap"), tileSize_(64), supportRadius_(0.0), hasPreviousOutputs_(false), numberOfComputedCells_(0) {}
+
+MemoizationFilter::~MemoizationFilter() = default;
+
+bool MemoizationFilter::configure() {
+  hasPreviousOutputs_ = false;
+  if (!FilterBase::getParam(std::string("input_layers"), inputLayers_) || inputLayers_.empty()) {
+    ROS_ERROR("MemoizationFilter did not find parameter 'input_layers'.");
+    return false;
+  }
+  if (!FilterBase::getParam(std::string("output_layers"), outputLayers_) || outputLayers_.empty()) {
+    ROS_ERROR("MemoizationFilter did not find parameter 'output_layers'.");
+    return false;
+  }
+
+  if (!FilterBase::getParam(std::string("tile_size"), tileSize_)) {
+    tileSize_ = 64;
+  }
+  if (tileSize_ < 1) {
+    ROS_ERROR("MemoizationFilter parameter 'tile_size' must be positive.");
+    return false;
+  }
+  ROS_DEBUG("Tile size = %d.", tileSize_);
+
+  XmlRpc::XmlRpcValue filters;
+  if (!FilterBase::getParam(std::string("filters"), filters) || filters.getType() != XmlRpc::XmlRpcValue::TypeArray) {
+    ROS_ERROR("MemoizationFilter did not find the list of filters 'filters'.");
+    return false;
+  }
+
+  supportRadius_ = getFilterChainSupportRadius(filters);
+  ROS_DEBUG("Memoization support radius = %f.", supportRadius_);
+
+  if (!filterChain_.configure(filters, getName())) {
+    ROS_ERROR("MemoizationFilter could not configure the filter chain.");
+    return false;
+  }
+  return true;
+}
+
+bool MemoizationFilter::update(const GridMap& mapIn, GridMap& mapOut) {
+  for (const auto& layer : inputLayers_) {
+    if (!mapIn.exists(layer)) {
+      ROS_ERROR("Check your input_layers! Layer %s does not exist", layer.c_str());
+      return false;
+    }
+  }
+
+  // Combined fingerprints of the input layers per tile, in buffer coordinates such that they can be compared after
+  // the map was moved.
+  TileFingerprints fingerprints = computeTileFingerprints(mapIn.get(inputLayers_[0]), Index::Zero(), tileSize_);
+  for (size_t i = 1; i < inputLayers_.size(); ++i) {
+    const TileFingerprints layerFingerprints = computeTileFingerprints(mapIn.get(inputLayers_[i]), Index::Zero(), tileSize_);
+    for (Eigen::Index j = 0; j < fingerprints.size(); ++j) {
+      fingerprints(j) = combineFingerprints(fingerprints(j), layerFingerprints(j));
+    }
+  }
+
+  // A moved map keeps the previous outputs in the circular buffer, except in the new regions.
+  std::vector<BufferRegion> newRegions;
+  Index previousStartIndex = mapIn.getStartIndex();
+  if (hasPreviousOutputs_ && !hasSameGeometry(mapIn) && (mapIn.getSize() == previousOutputs_.getSize()).all() &&
+      mapIn.getResolution() == previousOutputs_.getResolution() && mapIn.getFrameId() == previousOutputs_.getFrameId()) {
+    previousStartIndex = previousOutputs_.getStartIndex();
+    previousOutputs_.move(mapIn.getPosition(), newRegions);
+  }
+
+  numberOfComputedCells_ = 0;
+  bool isSuccess = true;
+  if (!hasPreviousOutputs_ || !hasSameGeometry(mapIn)) {
+    isSuccess = updateFullMap(mapIn);
+  } else {
+    // Regions (unwrapped indices) of the changed inputs: the changed tiles and the new regions of a move.
+    const Size& size = mapIn.getSize();
+    const Index& startIndex = mapIn.getStartIndex();
+    std::vector<CellRegion> regions;
+    for (Eigen::Index j = 0; j < fingerprints.cols(); ++j) {
+      for (Eigen::Index i = 0; i < fingerprints.rows(); ++i) {
+        if (fingerprints(i, j) != previousFingerprints_(i, j)) {
+          const Index tileIndex = Index(i, j) * tileSize_;
+          appendUnwrappedRegions(tileIndex, (tileIndex + tileSize_).min(size) - tileIndex, size, startIndex, regions);
+        }
+      }
+    }
+    for (const auto& newRegion : newRegions) {
+      appendUnwrappedRegions(newRegion.getStartIndex(), newRegion.getSize(), size, startIndex, regions);
+    }
+    // The inputs outside of the map changed at the borders in the direction of a move.
+    if (previousStartIndex(0) != startIndex(0)) {
+      regions.push_back(CellRegion{Index(0, 0), Size(0, size(1))});
+      regions.push_back(CellRegion{Index(size(0), 0), Size(0, size(1))});
+    }
+    if (previousStartIndex(1) != startIndex(1)) {
+      regions.push_back(CellRegion{Index(0, 0), Size(size(0), 0)});
+      regions.push_back(CellRegion{Index(0, size(1)), Size(size(0), 0)});
+    }
+
+    // The outputs change within the support radius of the changed inputs.
+    const int supportCells = static_cast<int>(std::ceil(supportRadius_ / mapIn.getResolution()));
+    for (auto& region : regions) {
+      region = expandRegion(region, supportCells, size);
+    }
+    regions.erase(std::remove_if(regions.begin(), regions.end(), [](const CellRegion& region) { return region.size.prod() == 0; }),
+                  regions.end());
+    mergeRegions(regions, supportCells, size);
+
+    int numberOfCells = 0;
+    for (const auto& region : regions) {
+      numberOfCells += expandRegion(region, supportCells, size).size.prod();
+    }
+    if (numberOfCells >= size.prod()) {
+      isSuccess = updateFullMap(mapIn);
+    } else {
+      for (const auto& region : regions) {
+        if (!updateRegion(mapIn, region.index, region.size, supportCells)) {
+          isSuccess = false;
+          break;
+        }
+      }
+    }
+  }
+  if (!isSuccess) {
+    hasPreviousOutputs_ = false;
+    return false;
+  }
+  previousFingerprints_ = std::move(fingerprints);
+
+  mapOut = mapIn;
+  for (const auto& layer : outputLayers_) {
+    mapOut.add(layer, previousOutputs_[layer]);
+  }
+  return true;
+}
+
+size_t MemoizationFilter::getNumberOfComputedCells() const {
+  return numberOfComputedCells_;
+}
+
+bool MemoizationFilter::hasSameGeometry(const GridMap& map) const {
+  return (map.getSize() == previousOutputs_.getSize()).all() && (map.getStartIndex() == previousOutputs_.getStartIndex()).all() &&
+         map.getResolution() == previousOutputs_.getResolution() && map.getPosition() == previousOutputs_.getPosition() &&
+         map.getFrameId() == previousOutputs_.getFrameId();
+}
+
+bool MemoizationFilter::updateFullMap(const GridMap& mapIn) {
+  GridMap mapOut;
+  if (!filterChain_.update(mapIn, mapOut)) {
+    ROS_ERROR("MemoizationFilter: could not run the filter chain.");
+    return false;
+  }
+  if ((mapOut.getSize() != mapIn.getSize()).any() || (mapOut.getStartIndex() != mapIn.getStartIndex()).any()) {
+    ROS_ERROR("MemoizationFilter: the filter chain must not change the geometry of the map.");
+    return false;
+  }
+  for (const auto& layer : outputLayers_) {
+    if (!mapOut.exists(layer)) {
+      ROS_ERROR("Check your output_layers! Layer %s was not computed by the filter chain", layer.c_str());
+      return false;
+    }
+  }
+
+  // Keep only the output layers, with the geometry of the input map.
+  previousOutputs_ = GridMap();
+  previousOutputs_.setGeometry(mapIn.getLength(), mapIn.getResolution(), mapIn.getPosition());
+  previousOutputs_.setStartIndex(mapIn.getStartIndex());
+  previousOutputs_.setFrameId(mapIn.getFrameId());
+  for (const auto& layer : outputLayers_) {
+    previousOutputs_.add(layer, mapOut[layer]);
+  }
+  hasPreviousOutputs_ = true;
+  numberOfComputedCells_ = mapIn.getSize().prod();
+  return true;
+}
+
+bool MemoizationFilter::updateRegion(const GridMap& mapIn, const Index& regionIndex, const Size& regionSize, int supportCells) {
+  const Size& size = mapIn.getSize();
+  const Index& startIndex = mapIn.getStartIndex();
+  const Index submapIndex = (regionIndex - supportCells).max(0);
+  const Size submapSize = (regionIndex + regionSize + supportCells).min(size) - submapIndex;
+
+  // Submap with the input layers (default start index).
+  const double resolution = mapIn.getResolution();
+  Position firstCellPosition;
+  mapIn.getPosition(getBufferIndexFromIndex(submapIndex, size, startIndex), firstCellPosition);
+  GridMap submap(inputLayers_);
+  submap.setFrameId(mapIn.getFrameId());
+  submap.setTimestamp(mapIn.getTimestamp());
+  submap.setGeometry(Length(submapSize.cast<double>() * resolution), resolution,
+                     firstCellPosition - 0.5 * resolution * (submapSize - 1).cast<double>().matrix());
+  for (const auto& layer : inputLayers_) {
+    const Matrix& data = mapIn[layer];
+    Matrix& submapData = submap[layer];
+    forEachBufferBlock(size, startIndex, submapIndex, submapSize,
+                       [&](const Index& bufferIndex, const Index& blockIndex, const Size& blockSize) {
+                         submapData.block(blockIndex(0), blockIndex(1), blockSize(0), blockSize(1)) =
+                             data.block(bufferIndex(0), bufferIndex(1), blockSize(0), blockSize(1));
+                       });
+  }
+
+  GridMap filteredSubmap;
+  if (!filterChain_.update(submap, filteredSubmap)) {
+    ROS_ERROR("MemoizationFilter: could not run the filter chain.");
+    return false;
+  }
+  if ((filteredSubmap.getSize() != submapSize).any() || !filteredSubmap.getStartIndex().isZero()) {
+    ROS_ERROR("MemoizationFilter: the filter chain must not change the geometry of the map.");
+    return false;
+  }
+
+  // Write the outputs inside the region back.
+  const Index offset = regionIndex - submapIndex;
+  for (const auto& layer : outputLayers_) {
+    if (!filteredSubmap.exists(layer)) {
+      ROS_ERROR("Check your output_layers! Layer %s was not computed by the filter chain", layer.c_str());
+      return false;
+    }
+    const Matrix& filteredData = filteredSubmap[layer];
+    Matrix& data = previousOutputs_[layer];
+    forEachBufferBlock(size, startIndex, regionIndex, regionSize,
+                       [&](const Index& bufferIndex, const Index& blockIndex, const Size& blockSize) {
+                         data.block(bufferIndex(0), bufferIndex(1), blockSize(0), blockSize(1)) =
+                             filteredData.block(offset(0) + blockIndex(0), offset(1) + blockIndex(1), blockSize(0), blockSize(1));
+                       });
+  }
+  numberOfComputedCells_ += submapSize.prod();
+  return true;
+}
+
+}  // namespace grid_map
@@ -36,9 +36,7 @@ bool NormalColorMapFilter::configure() {
 }
 
 bool NormalColorMapFilter::update(const GridMap& mapIn, GridMap& mapOut) {
-  const auto& normalX = mapIn[inputLayersPrefix_ + "x"];
-  const auto& normalY = mapIn[inputLayersPrefix_ + "y"];
-  const auto& normalZ = mapIn[inputLayersPrefix_ + "z"];
+  const ConstVectorLayer<3> normals(mapIn, inputLayersPrefix_);
 
   mapOut = mapIn;
   mapOut.add(outputLayer_);
@@ -48,11 +46,15 @@ bool NormalColorMapFilter::update(const GridMap& mapIn, GridMap& mapOut) {
   // Y: -1 to +1 : Green: 0 to 255
   // Z:  0 to  1 : Blue: 128 to 255
 
-  // For each cell in map.
-  for (Eigen::Index i = 0; i < color.size(); ++i) {
-    const Eigen::Vector3f colorVector((normalX(i) + 1.0) / 2.0, (normalY(i) + 1.0) / 2.0, (normalZ(i) / 2.0) + 0.5);
-    colorVectorToValue(colorVector, color(i));
-  }
+  // Map the channels to [0, 1] and pack them for all cells (same as `colorVectorToValue()` per cell).
+  const auto size = static_cast<size_t>(color.size());
+  Matrix red(color.rows(), color.cols());
+  Matrix green(color.rows(), color.cols());
+  Matrix blue(color.rows(), color.cols());
+  simd::scaleAndClamp(normals.getChannel(0).data(), red.data(), size, 0.5F, 0.5F, 0.0F, 1.0F);
+  simd::scaleAndClamp(normals.getChannel(1).data(), green.data(), size, 0.5F, 0.5F, 0.0F, 1.0F);
+  simd::scaleAndClamp(normals.getChannel(2).data(), blue.data(), size, 0.5F, 0.5F, 0.0F, 1.0F);
+  simd::packColors(red.data(), green.data(), blue.data(), color.data(), size);
 
   return true;
 }
@@ -125,15 +125,8 @@ bool NormalVectorsFilter::configure() {
 }
 
 bool NormalVectorsFilter::update(const GridMap& mapIn, GridMap& mapOut) {
-  std::vector<std::string> normalVectorsLayers;
-  normalVectorsLayers.push_back(outputLayersPrefix_ + "x");
-  normalVectorsLayers.push_back(outputLayersPrefix_ + "y");
-  normalVectorsLayers.push_back(outputLayersPrefix_ + "z");
-
   mapOut = mapIn;
-  for (const auto& layer : normalVectorsLayers) {
-    mapOut.add(layer);
-  }
+  addVectorLayer<3>(mapOut, outputLayersPrefix_);
   switch (method_) {
     case Method::AreaSerial:
       computeWithAreaSerial(mapOut, inputLayer_, outputLayersPrefix_);
@@ -155,13 +148,14 @@ bool NormalVectorsFilter::update(const GridMap& mapIn, GridMap& mapOut) {
 // SVD Area based methods.
 void NormalVectorsFilter::computeWithAreaSerial(GridMap& map, const std::string& inputLayer, const std::string& outputLayersPrefix) {
   const double start = ros::Time::now().toSec();
+  VectorLayer<3> normals(map, outputLayersPrefix);
 
   // For each cell in submap.
   for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
     // Check if this is an empty cell (hole in the map).
     if (map.isValid(*iterator, inputLayer)) {
       const Index index(*iterator);
-      areaSingleNormalComputation(map, inputLayer, outputLayersPrefix, index);
+      areaSingleNormalComputation(map, inputLayer, normals, index);
     }
   }
 
@@ -172,6 +166,7 @@ void NormalVectorsFilter::computeWithAreaSerial(GridMap& map, const std::string&
 void NormalVectorsFilter::computeWithAreaParallel(GridMap& map, const std::string& inputLayer, const std::string& outputLayersPrefix) {
   const double start = ros::Time::now().toSec();
   grid_map::Size gridMapSize = map.getSize();
+  VectorLayer<3> normals(map, outputLayersPrefix);
 
   // Set number of thread to use for parallel programming.
   std::unique_ptr<tbb::task_scheduler_init> TBBInitPtr;
@@ -184,7 +179,7 @@ void NormalVectorsFilter::computeWithAreaParallel(GridMap& map, const std::strin
     // Recover Cell index from range iterator.
     const Index index(range / gridMapSize(1), range % gridMapSize(1));
     if (map.isValid(index, inputLayer)) {
-      areaSingleNormalComputation(map, inputLayer, outputLayersPrefix, index);
+      areaSingleNormalComputation(map, inputLayer, normals, index);
     }
   });
 
@@ -192,7 +187,7 @@ void NormalVectorsFilter::computeWithAreaParallel(GridMap& map, const std::strin
   ROS_DEBUG_THROTTLE(2.0, "NORMAL COMPUTATION TIME = %f", (end - start));
 }
 
-void NormalVectorsFilter::areaSingleNormalComputation(GridMap& map, const std::string& inputLayer, const std::string& outputLayersPrefix,
+void NormalVectorsFilter::areaSingleNormalComputation(GridMap& map, const std::string& inputLayer, VectorLayer<3>& normals,
                                                       const grid_map::Index& index) {
   // Requested position (center) of circle in map.
   Position center;
@@ -245,9 +240,7 @@ void NormalVectorsFilter::areaSingleNormalComputation(GridMap& map, const std::s
     unitaryNormalVector = -unitaryNormalVector;
   }
 
-  map.at(outputLayersPrefix + "x", index) = unitaryNormalVector.x();
-  map.at(outputLayersPrefix + "y", index) = unitaryNormalVector.y();
-  map.at(outputLayersPrefix + "z", index) = unitaryNormalVector.z();
+  normals.set(index, unitaryNormalVector);
 }
 // Raster based methods.
 void NormalVectorsFilter::computeWithRasterSerial(GridMap& map, const std::string& inputLayer, const std::string& outputLayersPrefix) {
@@ -258,6 +251,7 @@ void NormalVectorsFilter::computeWithRasterSerial(GridMap& map, const std::strin
   gridMapResolution_ = map.getResolution();
   // Faster access to grid map values.
   const grid_map::Matrix dataMap = map[inputLayer];
+  VectorLayer<3> normals(map, outputLayersPrefix);
   // Height and width of submap. Submap is Map without the outermost line of cells, no need to check if index is inside.
   const Index submapStartIndex(1, 1);
   const Index submapBufferSize(gridMapSize(0) - 2, gridMapSize(1) - 2);
@@ -265,7 +259,7 @@ void NormalVectorsFilter::computeWithRasterSerial(GridMap& map, const std::strin
   // For each cell in submap.
   for (SubmapIterator iterator(map, submapStartIndex, submapBufferSize); !iterator.isPastEnd(); ++iterator) {
     const Index index(*iterator);
-    rasterSingleNormalComputation(map, outputLayersPrefix, dataMap, index);
+    rasterSingleNormalComputation(normals, dataMap, index);
   }
 
   const double end = ros::Time::now().toSec();
@@ -279,6 +273,7 @@ void NormalVectorsFilter::computeWithRasterParallel(GridMap& map, const std::str
   gridMapResolution_ = map.getResolution();
   // Faster access to grid map values if copy grid map layer into local matrix.
   const grid_map::Matrix dataMap = map[inputLayer];
+  VectorLayer<3> normals(map, outputLayersPrefix);
   // Height and width of submap. Submap is Map without the outermost line of cells, no need to check if index is inside.
   const Index submapStartIndex(1, 1);
   const Index submapBufferSize(gridMapSize(0) - 2, gridMapSize(1) - 2);
@@ -291,7 +286,7 @@ void NormalVectorsFilter::computeWithRasterParallel(GridMap& map, const std::str
     // Parallelized iteration through the map.
     tbb::parallel_for(0, submapBufferSize(0) * submapBufferSize(1), [&](int range) {
       const Index index(range / submapBufferSize(1) + submapStartIndex(0), range % submapBufferSize(1) + submapStartIndex(1));
-      rasterSingleNormalComputation(map, outputLayersPrefix, dataMap, index);
+      rasterSingleNormalComputation(normals, dataMap, index);
     });
   } else {
     ROS_ERROR("Grid map size is too small for normal raster computation");
@@ -301,8 +296,8 @@ void NormalVectorsFilter::computeWithRasterParallel(GridMap& map, const std::str
   ROS_DEBUG_THROTTLE(2.0, "NORMAL COMPUTATION TIME = %f", (end - start));
 }
 
-void NormalVectorsFilter::rasterSingleNormalComputation(GridMap& map, const std::string& outputLayersPrefix,
-                                                        const grid_map::Matrix& dataMap, const grid_map::Index& index) {
+void NormalVectorsFilter::rasterSingleNormalComputation(VectorLayer<3>& normals, const grid_map::Matrix& dataMap,
+                                                        const grid_map::Index& index) {
   // Inspiration for algorithm:
   // http://www.flipcode.com/archives/Calculating_Vertex_Normals_for_Height_Maps.shtml
   const double centralCell = dataMap(index(0), index(1));
@@ -387,9 +382,7 @@ void NormalVectorsFilter::rasterSingleNormalComputation(GridMap& map, const std:
       normalVector = -normalVector;
     }
 
-    map.at(outputLayersPrefix + "x", index) = normalVector.x();
-    map.at(outputLayersPrefix + "y", index) = normalVector.y();
-    map.at(outputLayersPrefix + "z", index) = normalVector.z();
+    normals.set(index, normalVector);
   }
 }
 
@@ -0,0 +1,123 @@
+/*
+ * RegionOfInterestFilter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_filters/RegionOfInterestFilter.hpp"
+#include "grid_map_filters/FilterChainSupport.hpp"
+
+#include <vector>
+
+#include <grid_map_core/grid_map_core.hpp>
+
+using namespace filters;
+
+namespace grid_map {
+
+RegionOfInterestFilter::RegionOfInterestFilter()
+    : filterChain_("grid_map::GridMap"), length_(0.0, 0.0), hasFixedPosition_(false), position_(0.0, 0.0), supportRadius_(0.0) {}
+
+RegionOfInterestFilter::~RegionOfInterestFilter() = default;
+
+bool RegionOfInterestFilter::configure() {
+  double lengthX = 0.0;
+  double lengthY = 0.0;
+  if (!FilterBase::getParam(std::string("length_x"), lengthX) || !FilterBase::getParam(std::string("length_y"), lengthY)) {
+    ROS_ERROR("RegionOfInterestFilter did not find parameters 'length_x' and 'length_y'.");
+    return false;
+  }
+  if (lengthX <= 0.0 || lengthY <= 0.0) {
+    ROS_ERROR("RegionOfInterestFilter parameters 'length_x' and 'length_y' must be positive.");
+    return false;
+  }
+  length_ = Length(lengthX, lengthY);
+  ROS_DEBUG("Region of interest length = (%f, %f).", lengthX, lengthY);
+
+  double positionX = 0.0;
+  double positionY = 0.0;
+  hasFixedPosition_ = FilterBase::getParam(std::string("position_x"), positionX);
+  if (hasFixedPosition_ != FilterBase::getParam(std::string("position_y"), positionY)) {
+    ROS_ERROR("RegionOfInterestFilter needs both or none of the parameters 'position_x' and 'position_y'.");
+    return false;
+  }
+  position_ = Position(positionX, positionY);
+
+  XmlRpc::XmlRpcValue filters;
+  if (!FilterBase::getParam(std::string("filters"), filters) || filters.getType() != XmlRpc::XmlRpcValue::TypeArray) {
+    ROS_ERROR("RegionOfInterestFilter did not find the list of filters 'filters'.");
+    return false;
+  }
+
+  supportRadius_ = getFilterChainSupportRadius(filters);
+  ROS_DEBUG("Region of interest support radius = %f.", supportRadius_);
+
+  if (!filterChain_.configure(filters, getName())) {
+    ROS_ERROR("RegionOfInterestFilter could not configure the filter chain.");
+    return false;
+  }
+  return true;
+}
+
+bool RegionOfInterestFilter::update(const GridMap& mapIn, GridMap& mapOut) {
+  mapOut = mapIn;
+  const Position position = hasFixedPosition_ ? position_ : mapIn.getPosition();
+
+  // Region of interest and the submap the chain is run on.
+  bool isSuccess = false;
+  const SubmapGeometry region(mapIn, position, length_, isSuccess);
+  if (!isSuccess) {
+    ROS_ERROR("RegionOfInterestFilter: the region of interest is outside of the map.");
+    return false;
+  }
+  const Length supportLength = length_ + Length::Constant(2.0 * supportRadius_);
+  GridMap submap = mapIn.getSubmap(position, supportLength, isSuccess);
+  if (!isSuccess) {
+    ROS_ERROR("RegionOfInterestFilter: could not get the submap of the support region.");
+    return false;
+  }
+
+  // Index of the region of interest in the submap (which has a zero start index).
+  Position regionStartPosition;
+  Index offset;
+  mapIn.getPosition(region.getStartIndex(), regionStartPosition);
+  if (!submap.getIndex(regionStartPosition, offset) || (offset + region.getSize() > submap.getSize()).any()) {
+    ROS_ERROR("RegionOfInterestFilter: the support region does not contain the region of interest.");
+    return false;
+  }
+
+  GridMap filteredSubmap;
+  if (!filterChain_.update(submap, filteredSubmap)) {
+    ROS_ERROR("RegionOfInterestFilter: could not run the filter chain.");
+    return false;
+  }
+  if ((filteredSubmap.getSize() != submap.getSize()).any() || !filteredSubmap.getStartIndex().isZero()) {
+    ROS_ERROR("RegionOfInterestFilter: the filter chain must not change the geometry of the map.");
+    return false;
+  }
+
+  // Write the results inside the region of interest back.
+  std::vector<BufferRegion> bufferRegions;
+  getBufferRegionsForSubmap(bufferRegions, region.getStartIndex(), region.getSize(), mapOut.getSize(), mapOut.getStartIndex());
+  for (const auto& layer : filteredSubmap.getLayers()) {
+    if (!mapOut.exists(layer)) {
+      mapOut.add(layer);
+    }
+    Matrix& data = mapOut[layer];
+    const Matrix& filteredData = filteredSubmap[layer];
+    for (const auto& bufferRegion : bufferRegions) {
+      const Index& regionStart = bufferRegion.getStartIndex();
+      const Size& regionSize = bufferRegion.getSize();
+      const BufferRegion::Quadrant quadrant = bufferRegion.getQuadrant();
+      const bool isTop = quadrant == BufferRegion::Quadrant::TopLeft || quadrant == BufferRegion::Quadrant::TopRight;
+      const bool isLeft = quadrant == BufferRegion::Quadrant::TopLeft || quadrant == BufferRegion::Quadrant::BottomLeft;
+      const Index sourceStart =
+          offset + Index(isTop ? 0 : region.getSize()(0) - regionSize(0), isLeft ? 0 : region.getSize()(1) - regionSize(1));
+      data.block(regionStart(0), regionStart(1), regionSize(0), regionSize(1)) =
+          filteredData.block(sourceStart(0), sourceStart(1), regionSize(0), regionSize(1));
+    }
+  }
+  return true;
+}
+
+}  // namespace grid_map
@@ -0,0 +1,202 @@
+/*
+ * ResolutionAdaptiveFilter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_filters/ResolutionAdaptiveFilter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <tbb/tbb.h>
+
+#include <grid_map_core/grid_map_core.hpp>
+
+using namespace filters;
+
+namespace grid_map {
+
+ResolutionAdaptiveFilter::ResolutionAdaptiveFilter() : filterChain_("grid_map::GridMap"), factor_(2), pooling_(Pooling::Mean) {}
+
+ResolutionAdaptiveFilter::~ResolutionAdaptiveFilter() = default;
+
+bool ResolutionAdaptiveFilter::configure() {
+  if (!FilterBase::getParam(std::string("factor"), factor_) || factor_ < 1) {
+    ROS_ERROR("ResolutionAdaptiveFilter did not find parameter 'factor' (positive integer).");
+    return false;
+  }
+  ROS_DEBUG("Downsampling factor = %d.", factor_);
+
+  std::string pooling;
+  if (!FilterBase::getParam(std::string("pooling"), pooling)) {
+    pooling = "mean";
+  }
+  if (pooling == "mean") {
+    pooling_ = Pooling::Mean;
+  } else if (pooling == "min") {
+    pooling_ = Pooling::Min;
+  } else if (pooling == "max") {
+    pooling_ = Pooling::Max;
+  } else {
+    ROS_ERROR("ResolutionAdaptiveFilter parameter 'pooling' must be 'mean', 'min' or 'max', not '%s'.", pooling.c_str());
+    return false;
+  }
+  ROS_DEBUG("Pooling = %s.", pooling.c_str());
+
+  if (!FilterBase::getParam(std::string("input_layers"), inputLayers_)) {
+    ROS_ERROR("ResolutionAdaptiveFilter did not find parameter 'input_layers'.");
+    return false;
+  }
+  if (!FilterBase::getParam(std::string("output_layers"), outputLayers_)) {
+    ROS_ERROR("ResolutionAdaptiveFilter did not find parameter 'output_layers'.");
+    return false;
+  }
+
+  XmlRpc::XmlRpcValue filters;
+  if (!FilterBase::getParam(std::string("filters"), filters) || filters.getType() != XmlRpc::XmlRpcValue::TypeArray) {
+    ROS_ERROR("ResolutionAdaptiveFilter did not find the list of filters 'filters'.");
+    return false;
+  }
+  if (!filterChain_.configure(filters, getName())) {
+    ROS_ERROR("ResolutionAdaptiveFilter could not configure the filter chain.");
+    return false;
+  }
+  return true;
+}
+
+bool ResolutionAdaptiveFilter::update(const GridMap& mapIn, GridMap& mapOut) {
+  for (const auto& layer : inputLayers_) {
+    if (!mapIn.exists(layer)) {
+      ROS_ERROR("Check your input_layers! Layer %s does not exist", layer.c_str());
+      return false;
+    }
+  }
+
+  GridMap coarseMapIn;
+  downsample(mapIn, inputLayers_, factor_, pooling_, coarseMapIn);
+  GridMap coarseMapOut;
+  if (!filterChain_.update(coarseMapIn, coarseMapOut)) {
+    ROS_ERROR("ResolutionAdaptiveFilter: could not run the filter chain.");
+    return false;
+  }
+  for (const auto& layer : outputLayers_) {
+    if (!coarseMapOut.exists(layer)) {
+      ROS_ERROR("Check your output_layers! Layer %s was not computed by the filter chain", layer.c_str());
+      return false;
+    }
+  }
+
+  mapOut = mapIn;
+  upsample(coarseMapOut, outputLayers_, factor_, mapOut);
+  return true;
+}
+
+void ResolutionAdaptiveFilter::downsample(const GridMap& fineMap, const std::vector<std::string>& layers, int factor,
+                                          Pooling pooling, GridMap& coarseMap) {
+  // Same top left corner (cell with index (0, 0), at the maximal x and y position).
+  const Size& fineSize = fineMap.getSize();
+  const Size coarseSize = (fineSize + factor - 1) / factor;
+  const double coarseResolution = factor * fineMap.getResolution();
+  const Length coarseLength = coarseSize.cast<double>() * coarseResolution;
+  const Position topLeftCorner = fineMap.getPosition() + 0.5 * fineMap.getLength().matrix();
+  coarseMap = GridMap(layers);
+  coarseMap.setFrameId(fineMap.getFrameId());
+  coarseMap.setTimestamp(fineMap.getTimestamp());
+  coarseMap.setGeometry(coarseLength, coarseResolution, topLeftCorner - 0.5 * coarseLength.matrix());
+
+  const Index& fineStartIndex = fineMap.getStartIndex();
+  for (const auto& layer : layers) {
+    const Matrix& fineData = fineMap[layer];
+    Matrix& coarseData = coarseMap[layer];
+    tbb::parallel_for(0, static_cast<int>(coarseSize(1)), [&](int coarseCol) {
+      const Index::Scalar colEnd = std::min((coarseCol + 1) * factor, fineSize(1));
+      for (Index::Scalar coarseRow = 0; coarseRow < coarseSize(0); ++coarseRow) {
+        const Index::Scalar rowEnd = std::min((coarseRow + 1) * factor, fineSize(0));
+        float pooledValue = pooling == Pooling::Min ? std::numeric_limits<float>::infinity()
+                                                    : (pooling == Pooling::Max ? -std::numeric_limits<float>::infinity() : 0.0F);
+        int numberOfValues = 0;
+        for (Index::Scalar fineCol = coarseCol * factor; fineCol < colEnd; ++fineCol) {
+          const Index::Scalar col = (fineCol + fineStartIndex(1)) % fineSize(1);
+          for (Index::Scalar fineRow = coarseRow * factor; fineRow < rowEnd; ++fineRow) {
+            const float value = fineData((fineRow + fineStartIndex(0)) % fineSize(0), col);
+            if (std::isnan(value)) {
+              continue;
+            }
+            ++numberOfValues;
+            if (pooling == Pooling::Mean) {
+              pooledValue += value;
+            } else if (pooling == Pooling::Min) {
+              pooledValue = std::min(pooledValue, value);
+            } else {
+              pooledValue = std::max(pooledValue, value);
+            }
+          }
+        }
+        if (numberOfValues == 0) {
+          pooledValue = NAN;
+        } else if (pooling == Pooling::Mean) {
+          pooledValue /= static_cast<float>(numberOfValues);
+        }
+        coarseData(coarseRow, coarseCol) = pooledValue;
+      }
+    });
+  }
+}
+
+void ResolutionAdaptiveFilter::upsample(const GridMap& coarseMap, const std::vector<std::string>& layers, int factor,
+                                        GridMap& fineMap) {
+  const Size& fineSize = fineMap.getSize();
+  const Size& coarseSize = coarseMap.getSize();
+  const Index& fineStartIndex = fineMap.getStartIndex();
+  const Index& coarseStartIndex = coarseMap.getStartIndex();
+  const float inverseFactor = 1.0F / static_cast<float>(factor);
+
+  // Bilinear interpolation weights along one dimension, between the coarse cells `first` and `first + 1` (clamped).
+  const auto getWeights = [inverseFactor](Index::Scalar fineIndex, Index::Scalar size, Index::Scalar& first, float& weight) {
+    const float coarseIndex = std::min(std::max((fineIndex + 0.5F) * inverseFactor - 0.5F, 0.0F), static_cast<float>(size - 1));
+    first = std::min(static_cast<Index::Scalar>(coarseIndex), size - 1);
+    weight = coarseIndex - static_cast<float>(first);
+  };
+
+  for (const auto& layer : layers) {
+    if (!fineMap.exists(layer)) {
+      fineMap.add(layer);
+    }
+    const Matrix& coarseData = coarseMap[layer];
+    Matrix& fineData = fineMap[layer];
+    const auto coarseValue = [&](Index::Scalar row, Index::Scalar col) {
+      return coarseData((std::min(row, coarseSize(0) - 1) + coarseStartIndex(0)) % coarseSize(0),
+                        (std::min(col, coarseSize(1) - 1) + coarseStartIndex(1)) % coarseSize(1));
+    };
+    tbb::parallel_for(0, static_cast<int>(fineSize(1)), [&](int fineCol) {
+      Index::Scalar coarseCol = 0;
+      float colWeight = 0.0F;
+      getWeights(fineCol, coarseSize(1), coarseCol, colWeight);
+      const Index::Scalar col = (fineCol + fineStartIndex(1)) % fineSize(1);
+      for (Index::Scalar fineRow = 0; fineRow < fineSize(0); ++fineRow) {
+        Index::Scalar coarseRow = 0;
+        float rowWeight = 0.0F;
+        getWeights(fineRow, coarseSize(0), coarseRow, rowWeight);
+
+        // Weighted mean of the valid neighbors.
+        const float values[4] = {coarseValue(coarseRow, coarseCol), coarseValue(coarseRow + 1, coarseCol),
+                                 coarseValue(coarseRow, coarseCol + 1), coarseValue(coarseRow + 1, coarseCol + 1)};
+        const float weights[4] = {(1.0F - rowWeight) * (1.0F - colWeight), rowWeight * (1.0F - colWeight),
+                                  (1.0F - rowWeight) * colWeight, rowWeight * colWeight};
+        float weightedSum = 0.0F;
+        float weightSum = 0.0F;
+        for (int i = 0; i < 4; ++i) {
+          if (!std::isnan(values[i]) && weights[i] > 0.0F) {
+            weightedSum += weights[i] * values[i];
+            weightSum += weights[i];
+          }
+        }
+        fineData((fineRow + fineStartIndex(0)) % fineSize(0), col) = weightSum > 0.0F ? weightedSum / weightSum : NAN;
+      }
+    });
+  }
+}
+
+}  // namespace grid_map
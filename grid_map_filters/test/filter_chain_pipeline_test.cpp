@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <grid_map_core/GridMap.hpp>
+
+#include "grid_map_filters/FilterChainPipeline.hpp"
+
+using namespace grid_map;
+
+namespace {
+
+//! Stage adding a value to the layer, taking some time.
+FilterChainPipeline::StageFunction createStage(float value, std::chrono::milliseconds duration) {
+  return [value, duration](const GridMap& mapIn, GridMap& mapOut) {
+    std::this_thread::sleep_for(duration);
+    mapOut = mapIn;
+    mapOut["layer"].array() += value;
+    return true;
+  };
+}
+
+}  // namespace
+
+TEST(FilterChainPipeline, OrderAndResults) {  // NOLINT
+  FilterChainPipeline pipeline(2);
+  pipeline.addStage(createStage(1.0, std::chrono::milliseconds(2)));
+  pipeline.addStage(createStage(10.0, std::chrono::milliseconds(1)));
+  pipeline.addStage(createStage(100.0, std::chrono::milliseconds(3)));
+  ASSERT_EQ(3u, pipeline.getNumberOfStages());
+
+  std::vector<float> outputs;
+  pipeline.start([&](const GridMap& map) { outputs.push_back(map.at("layer", Index(0, 0))); });
+
+  GridMap map({"layer"});
+  map.setGeometry(Length(1.0, 1.0), 0.1);
+  const int numberOfMaps = 20;
+  for (int i = 0; i < numberOfMaps; ++i) {
+    map["layer"].setConstant(1000.0 * i);
+    pipeline.push(map);
+  }
+  pipeline.waitUntilIdle();
+
+  ASSERT_EQ(numberOfMaps, outputs.size());
+  for (int i = 0; i < numberOfMaps; ++i) {
+    EXPECT_FLOAT_EQ(1000.0 * i + 111.0, outputs[i]);
+  }
+
+  const auto statistics = pipeline.getStatistics();
+  EXPECT_EQ(numberOfMaps, statistics.numberOfMaps);
+  EXPECT_EQ(0u, statistics.numberOfDroppedMaps);
+  EXPECT_EQ(0u, statistics.numberOfFailedMaps);
+  ASSERT_EQ(3u, statistics.stages.size());
+  for (const auto& stage : statistics.stages) {
+    EXPECT_EQ(numberOfMaps, stage.numberOfMaps);
+    EXPECT_GT(stage.utilization, 0.0);
+    EXPECT_LE(stage.utilization, 1.0);
+  }
+  EXPECT_GT(statistics.throughput, 0.0);
+  EXPECT_GE(statistics.averageLatency, 0.006);
+  EXPECT_GE(statistics.maxLatency, statistics.averageLatency);
+}
+
+TEST(FilterChainPipeline, StagesRunConcurrently) {  // NOLINT
+  FilterChainPipeline pipeline;
+  const auto duration = std::chrono::milliseconds(20);
+  pipeline.addStage(createStage(1.0, duration));
+  pipeline.addStage(createStage(1.0, duration));
+  pipeline.addStage(createStage(1.0, duration));
+  pipeline.start([](const GridMap& /*map*/) {});
+
+  GridMap map({"layer"});
+  map.setGeometry(Length(1.0, 1.0), 0.1);
+  const auto startTime = std::chrono::steady_clock::now();
+  const int numberOfMaps = 10;
+  for (int i = 0; i < numberOfMaps; ++i) {
+    pipeline.push(map);
+  }
+  pipeline.waitUntilIdle();
+  const auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+
+  // Sequentially, this would take 30 * 20 ms.
+  EXPECT_LT(elapsedTime, 20 * duration);
+  EXPECT_EQ(numberOfMaps, pipeline.getStatistics().numberOfMaps);
+}
+
+TEST(FilterChainPipeline, DropsWhenFullAndOnFailure) {  // NOLINT
+  FilterChainPipeline pipeline(1);
+  pipeline.addStage(createStage(1.0, std::chrono::milliseconds(20)));
+  pipeline.addStage([](const GridMap& mapIn, GridMap& mapOut) {
+    mapOut = mapIn;
+    return mapIn.at("layer", Index(0, 0)) < 5.0;
+  });
+  size_t numberOfOutputs = 0;
+  pipeline.start([&](const GridMap& /*map*/) { ++numberOfOutputs; });
+
+  GridMap map({"layer"});
+  map.setGeometry(Length(1.0, 1.0), 0.1);
+  map["layer"].setConstant(0.0);
+  size_t numberOfAcceptedMaps = 0;
+  for (int i = 0; i < 10; ++i) {
+    numberOfAcceptedMaps += pipeline.tryPush(map) ? 1 : 0;
+  }
+  map["layer"].setConstant(10.0);
+  pipeline.push(map);
+  pipeline.waitUntilIdle();
+
+  const auto statistics = pipeline.getStatistics();
+  EXPECT_LT(numberOfAcceptedMaps, 10u);
+  EXPECT_EQ(10u - numberOfAcceptedMaps, statistics.numberOfDroppedMaps);
+  EXPECT_EQ(1u, statistics.numberOfFailedMaps);
+  EXPECT_EQ(numberOfAcceptedMaps, numberOfOutputs);
+  EXPECT_EQ(numberOfAcceptedMaps, statistics.numberOfMaps);
+}
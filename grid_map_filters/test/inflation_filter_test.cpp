@@ -0,0 +1,129 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filters/filter_base.hpp>
+#include <grid_map_core/GridMap.hpp>
+#include <grid_map_core/iterators/GridMapIterator.hpp>
+
+#include "grid_map_filters/InflationFilter.hpp"
+
+#include <cmath>
+
+using namespace grid_map;
+using namespace ::testing;
+
+using BASE = filters::FilterBase<grid_map::GridMap>;
+
+namespace {
+
+//! Configures an inflation filter with an exponential decay.
+void configureInflationFilter(InflationFilter& inflationFilter) {
+  XmlRpc::XmlRpcValue config;
+  config["name"] = "inflation_filter";
+  config["type"] = "gridMapFilters/InflationFilter";
+
+  XmlRpc::XmlRpcValue params;
+  params["input_layer"] = "occupancy";
+  params["output_layer"] = "cost";
+  params["lethal_threshold"] = 0.5;
+  params["inflation_radius"] = 0.5;
+  params["inscribed_radius"] = 0.1;
+  params["cost_scaling_factor"] = 10.0;
+
+  config["params"] = params;
+
+  ASSERT_TRUE(inflationFilter.BASE::configure(config));
+}
+
+//! Cost by brute force search of the closest lethal cell, for the parameters of configureInflationFilter.
+float bruteForceCost(const GridMap& map, const Index& index) {
+  double minDistance = INFINITY;
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    if (map.at("occupancy", *iterator) >= 0.5) {
+      Position position;
+      Position lethalPosition;
+      map.getPosition(index, position);
+      map.getPosition(*iterator, lethalPosition);
+      // Distance to the border of the lethal cell.
+      const Position cellDistance = ((position - lethalPosition).cwiseAbs() / map.getResolution()).array().round();
+      const Position borderDistance = (cellDistance.array() - 0.5).cwiseMax(0.0);
+      minDistance = std::min(minDistance, borderDistance.norm() * map.getResolution());
+    }
+  }
+  if (minDistance == 0.0) {
+    return 1.0;
+  } else if (minDistance <= 0.1) {
+    return 0.99;
+  } else if (minDistance <= 0.5) {
+    return 0.99 * std::exp(-10.0 * (minDistance - 0.1));
+  }
+  return 0.0;
+}
+
+}  // namespace
+
+TEST(InflationFilter, SingleLethalCell) {  // NOLINT
+  InflationFilter inflationFilter;
+  configureInflationFilter(inflationFilter);
+
+  GridMap filterInput({"occupancy"});
+  filterInput.setGeometry(Length(1.0, 1.0), 0.1);
+  filterInput["occupancy"].setZero();
+  filterInput.at("occupancy", Index(5, 5)) = 1.0;
+  filterInput.at("occupancy", Index(9, 9)) = NAN;
+
+  GridMap filterOutput;
+  ASSERT_TRUE(inflationFilter.update(filterInput, filterOutput));
+  ASSERT_TRUE(filterOutput.exists("cost"));
+
+  // Lethal cell, inside the inscribed radius, decaying, outside the inflation radius.
+  EXPECT_FLOAT_EQ(filterOutput.at("cost", Index(5, 5)), 1.0);
+  EXPECT_FLOAT_EQ(filterOutput.at("cost", Index(4, 5)), 0.99);
+  EXPECT_FLOAT_EQ(filterOutput.at("cost", Index(5, 6)), 0.99);
+  EXPECT_NEAR(filterOutput.at("cost", Index(2, 5)), 0.99 * std::exp(-10.0 * (0.25 - 0.1)), 1e-6);
+  EXPECT_FLOAT_EQ(filterOutput.at("cost", Index(0, 0)), 0.0);
+
+  // Unknown cells stay unknown.
+  EXPECT_TRUE(std::isnan(filterOutput.at("cost", Index(9, 9))));
+}
+
+TEST(InflationFilter, NoLethalCells) {  // NOLINT
+  InflationFilter inflationFilter;
+  configureInflationFilter(inflationFilter);
+
+  GridMap filterInput({"occupancy"});
+  filterInput.setGeometry(Length(1.0, 1.0), 0.1);
+  filterInput["occupancy"].setZero();
+
+  GridMap filterOutput;
+  ASSERT_TRUE(inflationFilter.update(filterInput, filterOutput));
+  EXPECT_TRUE(filterOutput["cost"].isZero());
+}
+
+TEST(InflationFilter, MovedMapMatchesBruteForce) {  // NOLINT
+  InflationFilter inflationFilter;
+  configureInflationFilter(inflationFilter);
+
+  GridMap filterInput({"occupancy"});
+  filterInput.setGeometry(Length(2.0, 1.5), 0.1);
+  filterInput["occupancy"].setZero();
+  filterInput.at("occupancy", Index(3, 4)) = 1.0;
+  filterInput.at("occupancy", Index(12, 10)) = 1.0;
+  filterInput.at("occupancy", Index(13, 10)) = 1.0;
+
+  // Move the map, such that the buffer wraps around.
+  filterInput.move(Position(0.35, -0.42));
+  for (GridMapIterator iterator(filterInput); !iterator.isPastEnd(); ++iterator) {
+    if (!filterInput.isValid(*iterator, "occupancy")) {
+      filterInput.at("occupancy", *iterator) = 0.0;
+    }
+  }
+  filterInput.at("occupancy", Index(1, 1)) = 1.0;
+  ASSERT_FALSE(filterInput.getStartIndex().isZero());
+
+  GridMap filterOutput;
+  ASSERT_TRUE(inflationFilter.update(filterInput, filterOutput));
+  for (GridMapIterator iterator(filterOutput); !iterator.isPastEnd(); ++iterator) {
+    EXPECT_NEAR(filterOutput.at("cost", *iterator), bruteForceCost(filterInput, *iterator), 1e-5) << "Index: " << (*iterator).transpose();
+  }
+}
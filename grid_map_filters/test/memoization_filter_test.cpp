@@ -0,0 +1,146 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filters/filter_base.hpp>
+#include <grid_map_core/GridMap.hpp>
+#include <grid_map_core/GridMapMath.hpp>
+#include <grid_map_core/iterators/GridMapIterator.hpp>
+
+#include "grid_map_filters/MeanInRadiusFilter.hpp"
+#include "grid_map_filters/MemoizationFilter.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace grid_map;
+using namespace ::testing;
+
+using BASE = filters::FilterBase<grid_map::GridMap>;
+
+namespace {
+
+XmlRpc::XmlRpcValue getMeanInRadiusConfig() {
+  XmlRpc::XmlRpcValue params;
+  params["input_layer"] = "elevation";
+  params["output_layer"] = "elevation_smooth";
+  params["radius"] = 0.25;
+  params["support_radius"] = 0.25;
+
+  XmlRpc::XmlRpcValue config;
+  config["name"] = "mean_in_radius";
+  config["type"] = "gridMapFilters/MeanInRadiusFilter";
+  config["params"] = params;
+  return config;
+}
+
+XmlRpc::XmlRpcValue getMemoizationConfig() {
+  XmlRpc::XmlRpcValue params;
+  params["input_layers"][0] = "elevation";
+  params["output_layers"][0] = "elevation_smooth";
+  params["tile_size"] = 8;
+  params["filters"][0] = getMeanInRadiusConfig();
+
+  XmlRpc::XmlRpcValue config;
+  config["name"] = "memoization";
+  config["type"] = "gridMapFilters/MemoizationFilter";
+  config["params"] = params;
+  return config;
+}
+
+void expectSameAsFullMap(const GridMap& map, const GridMap& memoizedOutput) {
+  MeanInRadiusFilter meanInRadiusFilter;
+  ASSERT_TRUE(meanInRadiusFilter.BASE::configure(getMeanInRadiusConfig()));
+  GridMap fullOutput;
+  ASSERT_TRUE(meanInRadiusFilter.update(map, fullOutput));
+  ASSERT_TRUE(memoizedOutput.exists("elevation_smooth"));
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    const float expected = fullOutput.at("elevation_smooth", *iterator);
+    const float value = memoizedOutput.at("elevation_smooth", *iterator);
+    if (std::isnan(expected)) {
+      EXPECT_TRUE(std::isnan(value)) << "Index: " << (*iterator).transpose();
+    } else {
+      EXPECT_NEAR(expected, value, 1e-5) << "Index: " << (*iterator).transpose();
+    }
+  }
+}
+
+}  // namespace
+
+TEST(MemoizationFilter, ReusesUnchangedTiles) {  // NOLINT
+  MemoizationFilter memoizationFilter;
+  ASSERT_TRUE(memoizationFilter.BASE::configure(getMemoizationConfig()));
+
+  GridMap map({"elevation"});
+  map.setGeometry(Length(4.0, 3.0), 0.1);
+  map.move(Position(0.33, -0.52));  // Non-default start index.
+  map["elevation"].setRandom();
+  const size_t numberOfCells = map.getSize().prod();
+
+  // First update runs on the full map.
+  GridMap output;
+  ASSERT_TRUE(memoizationFilter.update(map, output));
+  EXPECT_EQ(numberOfCells, memoizationFilter.getNumberOfComputedCells());
+  expectSameAsFullMap(map, output);
+
+  // Unchanged inputs, other layers do not matter.
+  map.add("other", 1.0);
+  ASSERT_TRUE(memoizationFilter.update(map, output));
+  EXPECT_EQ(0u, memoizationFilter.getNumberOfComputedCells());
+  EXPECT_TRUE(output.exists("other"));
+  expectSameAsFullMap(map, output);
+
+  // Local changes (buffer indices), also at the wrap of the circular buffer and the border of the map.
+  const Index lastIndex = getBufferIndexFromIndex(map.getSize() - 1, map.getSize(), map.getStartIndex());
+  for (const auto& index : {Index(10, 20), Index(map.getStartIndex()), lastIndex}) {
+    map.at("elevation", index) += 1.0;
+    ASSERT_TRUE(memoizationFilter.update(map, output));
+    EXPECT_GT(memoizationFilter.getNumberOfComputedCells(), 0u);
+    EXPECT_LT(memoizationFilter.getNumberOfComputedCells(), numberOfCells / 2);
+    expectSameAsFullMap(map, output);
+  }
+
+  // Other geometry.
+  map.setPosition(Position(10.0, 0.0));
+  ASSERT_TRUE(memoizationFilter.update(map, output));
+  EXPECT_EQ(numberOfCells, memoizationFilter.getNumberOfComputedCells());
+  expectSameAsFullMap(map, output);
+
+  // Missing input layer.
+  map.erase("elevation");
+  EXPECT_FALSE(memoizationFilter.update(map, output));
+}
+
+TEST(MemoizationFilter, RecomputesNewRegionsAfterMove) {  // NOLINT
+  MemoizationFilter memoizationFilter;
+  ASSERT_TRUE(memoizationFilter.BASE::configure(getMemoizationConfig()));
+
+  GridMap map({"elevation"});
+  map.setGeometry(Length(10.0, 8.0), 0.1);
+  map["elevation"].setRandom();
+  const size_t numberOfCells = map.getSize().prod();
+  GridMap output;
+  ASSERT_TRUE(memoizationFilter.update(map, output));
+  EXPECT_EQ(numberOfCells, memoizationFilter.getNumberOfComputedCells());
+
+  // Only the new regions and the borders are recomputed (also across the wrap of the circular buffer).
+  for (const auto& position : {Position(0.5, -0.5), Position(0.3, -0.2), Position(-0.4, -0.2), Position(-0.4, 0.7)}) {
+    std::vector<BufferRegion> newRegions;
+    map.move(position, newRegions);
+    for (const auto& newRegion : newRegions) {
+      map["elevation"]
+          .block(newRegion.getStartIndex()(0), newRegion.getStartIndex()(1), newRegion.getSize()(0), newRegion.getSize()(1))
+          .setRandom();
+    }
+    ASSERT_TRUE(memoizationFilter.update(map, output));
+    EXPECT_GT(memoizationFilter.getNumberOfComputedCells(), 0u);
+    EXPECT_LT(memoizationFilter.getNumberOfComputedCells(), numberOfCells / 2);
+    expectSameAsFullMap(map, output);
+  }
+
+  // Moved and changed.
+  map.move(Position(0.0, 0.0));
+  map["elevation"].setRandom();
+  ASSERT_TRUE(memoizationFilter.update(map, output));
+  EXPECT_EQ(numberOfCells, memoizationFilter.getNumberOfComputedCells());
+  expectSameAsFullMap(map, output);
+}
@@ -0,0 +1,71 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filters/filter_base.hpp>
+#include <grid_map_core/GridMap.hpp>
+#include <grid_map_core/iterators/GridMapIterator.hpp>
+
+#include "grid_map_filters/MeanInRadiusFilter.hpp"
+#include "grid_map_filters/RegionOfInterestFilter.hpp"
+
+#include <cmath>
+
+using namespace grid_map;
+using namespace ::testing;
+
+using BASE = filters::FilterBase<grid_map::GridMap>;
+
+TEST(RegionOfInterestFilter, SameAsFullMapInsideRegion) {  // NOLINT
+  // Mean in radius, on the full map and in the region of interest.
+  XmlRpc::XmlRpcValue meanParams;
+  meanParams["input_layer"] = "elevation";
+  meanParams["output_layer"] = "elevation_smooth";
+  meanParams["radius"] = 0.25;
+  meanParams["support_radius"] = 0.25;
+
+  XmlRpc::XmlRpcValue meanConfig;
+  meanConfig["name"] = "mean_in_radius";
+  meanConfig["type"] = "gridMapFilters/MeanInRadiusFilter";
+  meanConfig["params"] = meanParams;
+
+  MeanInRadiusFilter meanInRadiusFilter;
+  ASSERT_TRUE(meanInRadiusFilter.BASE::configure(meanConfig));
+
+  XmlRpc::XmlRpcValue params;
+  params["length_x"] = 1.0;
+  params["length_y"] = 0.6;
+  params["filters"][0] = meanConfig;
+
+  XmlRpc::XmlRpcValue config;
+  config["name"] = "region_of_interest";
+  config["type"] = "gridMapFilters/RegionOfInterestFilter";
+  config["params"] = params;
+
+  RegionOfInterestFilter regionOfInterestFilter;
+  ASSERT_TRUE(regionOfInterestFilter.BASE::configure(config));
+
+  GridMap filterInput({"elevation"});
+  filterInput.setGeometry(Length(4.0, 3.0), 0.1);
+  filterInput["elevation"].setRandom();
+  filterInput.move(Position(0.33, -0.52));  // Non-default start index.
+  filterInput["elevation"].setRandom();
+
+  GridMap fullOutput;
+  ASSERT_TRUE(meanInRadiusFilter.update(filterInput, fullOutput));
+  GridMap regionOutput;
+  ASSERT_TRUE(regionOfInterestFilter.update(filterInput, regionOutput));
+
+  ASSERT_TRUE(regionOutput.exists("elevation_smooth"));
+  for (GridMapIterator iterator(regionOutput); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    regionOutput.getPosition(*iterator, position);
+    const Position relativePosition = (position - filterInput.getPosition()).cwiseAbs();
+    const float value = regionOutput.at("elevation_smooth", *iterator);
+    if (relativePosition.x() < 0.5 && relativePosition.y() < 0.3) {
+      EXPECT_NEAR(fullOutput.at("elevation_smooth", *iterator), value, 1e-5) << "Index: " << (*iterator).transpose();
+    } else if (relativePosition.x() > 0.5 + 0.1 || relativePosition.y() > 0.3 + 0.1) {
+      EXPECT_TRUE(std::isnan(value)) << "Index: " << (*iterator).transpose();
+    }
+    EXPECT_EQ(filterInput.at("elevation", *iterator), regionOutput.at("elevation", *iterator));
+  }
+}
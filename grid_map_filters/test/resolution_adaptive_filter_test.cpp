@@ -0,0 +1,139 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filters/filter_base.hpp>
+#include <grid_map_core/GridMap.hpp>
+#include <grid_map_core/iterators/GridMapIterator.hpp>
+
+#include "grid_map_filters/MeanInRadiusFilter.hpp"
+#include "grid_map_filters/ResolutionAdaptiveFilter.hpp"
+
+#include <cmath>
+
+using namespace grid_map;
+using namespace ::testing;
+
+using BASE = filters::FilterBase<grid_map::GridMap>;
+
+TEST(ResolutionAdaptiveFilter, DownsamplePooling) {  // NOLINT
+  GridMap map({"layer"});
+  map.setGeometry(Length(0.3, 0.3), 0.1);
+  map["layer"] << 1.0, 2.0, 3.0, 4.0, NAN, 6.0, 7.0, 8.0, NAN;
+
+  GridMap coarseMap;
+  ResolutionAdaptiveFilter::downsample(map, {"layer"}, 2, ResolutionAdaptiveFilter::Pooling::Mean, coarseMap);
+  ASSERT_EQ(2, coarseMap.getSize()(0));
+  ASSERT_EQ(2, coarseMap.getSize()(1));
+  EXPECT_DOUBLE_EQ(0.2, coarseMap.getResolution());
+
+  // Same top left corner.
+  Position finePosition;
+  Position coarsePosition;
+  map.getPosition(Index(0, 0), finePosition);
+  coarseMap.getPosition(Index(0, 0), coarsePosition);
+  EXPECT_NEAR(finePosition.x() + 0.05, coarsePosition.x() + 0.1, 1e-9);
+  EXPECT_NEAR(finePosition.y() + 0.05, coarsePosition.y() + 0.1, 1e-9);
+
+  EXPECT_FLOAT_EQ(7.0 / 3.0, coarseMap.at("layer", Index(0, 0)));
+  EXPECT_FLOAT_EQ(4.5, coarseMap.at("layer", Index(0, 1)));
+  EXPECT_FLOAT_EQ(7.5, coarseMap.at("layer", Index(1, 0)));
+  EXPECT_TRUE(std::isnan(coarseMap.at("layer", Index(1, 1))));
+
+  ResolutionAdaptiveFilter::downsample(map, {"layer"}, 2, ResolutionAdaptiveFilter::Pooling::Min, coarseMap);
+  EXPECT_FLOAT_EQ(1.0, coarseMap.at("layer", Index(0, 0)));
+  EXPECT_FLOAT_EQ(3.0, coarseMap.at("layer", Index(0, 1)));
+  EXPECT_TRUE(std::isnan(coarseMap.at("layer", Index(1, 1))));
+
+  ResolutionAdaptiveFilter::downsample(map, {"layer"}, 2, ResolutionAdaptiveFilter::Pooling::Max, coarseMap);
+  EXPECT_FLOAT_EQ(4.0, coarseMap.at("layer", Index(0, 0)));
+  EXPECT_FLOAT_EQ(8.0, coarseMap.at("layer", Index(1, 0)));
+  EXPECT_TRUE(std::isnan(coarseMap.at("layer", Index(1, 1))));
+}
+
+TEST(ResolutionAdaptiveFilter, UpsampleLinearFunction) {  // NOLINT
+  // Mean pooling and bilinear upsampling reproduce a linear function away from the border.
+  GridMap map({"layer"});
+  map.setGeometry(Length(4.0, 3.2), 0.1);  // Multiple of the factors.
+  map.move(Position(0.33, -0.52));  // Non-default start index.
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    map.at("layer", *iterator) = position.x() + 2.0 * position.y();
+  }
+
+  for (const int factor : {2, 4}) {
+    GridMap coarseMap;
+    ResolutionAdaptiveFilter::downsample(map, {"layer"}, factor, ResolutionAdaptiveFilter::Pooling::Mean, coarseMap);
+    GridMap upsampledMap = map;
+    upsampledMap.erase("layer");
+    ResolutionAdaptiveFilter::upsample(coarseMap, {"layer"}, factor, upsampledMap);
+    ASSERT_TRUE(upsampledMap.exists("layer"));
+
+    for (GridMapIterator iterator(upsampledMap); !iterator.isPastEnd(); ++iterator) {
+      const Index index = iterator.getUnwrappedIndex();
+      if ((index < factor / 2).any() || (index >= map.getSize() - factor / 2).any()) {
+        continue;
+      }
+      EXPECT_NEAR(map.at("layer", *iterator), upsampledMap.at("layer", *iterator), 1e-4)
+          << "Factor: " << factor << ", index: " << index.transpose();
+    }
+  }
+}
+
+TEST(ResolutionAdaptiveFilter, CloseToFullResolution) {  // NOLINT
+  XmlRpc::XmlRpcValue meanParams;
+  meanParams["input_layer"] = "elevation";
+  meanParams["output_layer"] = "elevation_smooth";
+  meanParams["radius"] = 0.4;
+
+  XmlRpc::XmlRpcValue meanConfig;
+  meanConfig["name"] = "mean_in_radius";
+  meanConfig["type"] = "gridMapFilters/MeanInRadiusFilter";
+  meanConfig["params"] = meanParams;
+
+  MeanInRadiusFilter meanInRadiusFilter;
+  ASSERT_TRUE(meanInRadiusFilter.BASE::configure(meanConfig));
+
+  XmlRpc::XmlRpcValue params;
+  params["factor"] = 2;
+  params["input_layers"][0] = "elevation";
+  params["output_layers"][0] = "elevation_smooth";
+  params["filters"][0] = meanConfig;
+
+  XmlRpc::XmlRpcValue config;
+  config["name"] = "resolution_adaptive";
+  config["type"] = "gridMapFilters/ResolutionAdaptiveFilter";
+  config["params"] = params;
+
+  ResolutionAdaptiveFilter resolutionAdaptiveFilter;
+  ASSERT_TRUE(resolutionAdaptiveFilter.BASE::configure(config));
+
+  // Smooth surface.
+  GridMap filterInput({"elevation"});
+  filterInput.setGeometry(Length(4.0, 3.0), 0.05);
+  filterInput.move(Position(0.33, -0.52));
+  for (GridMapIterator iterator(filterInput); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    filterInput.getPosition(*iterator, position);
+    filterInput.at("elevation", *iterator) = std::sin(position.x()) * std::cos(position.y());
+  }
+
+  GridMap fullOutput;
+  ASSERT_TRUE(meanInRadiusFilter.update(filterInput, fullOutput));
+  GridMap adaptiveOutput;
+  ASSERT_TRUE(resolutionAdaptiveFilter.update(filterInput, adaptiveOutput));
+
+  ASSERT_TRUE(adaptiveOutput.exists("elevation_smooth"));
+  EXPECT_EQ(filterInput.getSize()(0), adaptiveOutput.getSize()(0));
+  EXPECT_EQ(filterInput.getSize()(1), adaptiveOutput.getSize()(1));
+  for (GridMapIterator iterator(adaptiveOutput); !iterator.isPastEnd(); ++iterator) {
+    EXPECT_EQ(filterInput.at("elevation", *iterator), adaptiveOutput.at("elevation", *iterator));
+    EXPECT_NEAR(fullOutput.at("elevation_smooth", *iterator), adaptiveOutput.at("elevation_smooth", *iterator), 0.02)
+        << "Index: " << (*iterator).transpose();
+  }
+
+  // Missing input layer.
+  filterInput.erase("elevation");
+  filterInput.add("other", 0.0);
+  EXPECT_FALSE(resolutionAdaptiveFilter.update(filterInput, adaptiveOutput));
+}
@@ -0,0 +1,222 @@
+/*
+ * GridMapStreamer.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <grid_map_loader/GridMapTileStore.hpp>
+
+// ROS
+#include <ros/ros.h>
+#include <geometry_msgs/PoseStamped.h>
+
+// Grid map
+#include <grid_map_ros/grid_map_ros.hpp>
+
+// STD
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace grid_map_loader {
+
+/*!
+ * Streams a large map stored as tiles (see `GridMapTileStore`) as a window centered at the
+ * robot. The window follows a pose topic, only the newly exposed regions of the window are
+ * loaded and published. Tiles ahead of the motion are prefetched on a background thread into
+ * a bounded cache, such that startup time and memory are independent of the size of the map.
+ * Tiles that are not cached when they are needed are queued to the background thread as well,
+ * their part of the window is filled and published once they are loaded. The entire window is
+ * republished (latched) periodically while moving, for late subscribers.
+ */
+class GridMapStreamer
+{
+ public:
+
+  /*!
+   * Constructor.
+   * @param nodeHandle the ROS node handle.
+   */
+  GridMapStreamer(ros::NodeHandle nodeHandle);
+
+  /*!
+   * Destructor.
+   */
+  virtual ~GridMapStreamer();
+
+  /*!
+  * Reads and verifies the ROS parameters.
+  * @return true if successful.
+  */
+  bool readParameters();
+
+ private:
+  using TileKey = std::pair<int, int>;
+
+  //! Cached tile, nullptr if the tile is not stored.
+  struct CachedTile
+  {
+    std::shared_ptr<const grid_map::GridMap> tile;
+    uint64_t lastUsed;
+  };
+
+  /*!
+   * Moves the window to the robot pose, fills and publishes the newly exposed regions.
+   * @param pose the robot pose.
+   */
+  void poseCallback(const geometry_msgs::PoseStamped& pose);
+
+  /*!
+   * Initializes the window at a position and fills it.
+   * @param position the position of the robot.
+   * @return true if successful, false if no tile is stored at the position.
+   */
+  bool initializeWindow(const grid_map::Position& position);
+
+  /*!
+   * Fills a region of the window from the cached tiles, requests the tiles that are not cached.
+   * @param region the buffer region of the window.
+   */
+  void fillRegion(const grid_map::BufferRegion& region);
+
+  /*!
+   * Fills and publishes the parts of the window covered by requested tiles that have been loaded.
+   * Requested tiles that are not cached (e.g. evicted before they were filled in) are requested
+   * again while they cover the window, the others are dropped.
+   */
+  void fillPendingTiles(const ros::TimerEvent& timerEvent);
+
+  /*!
+   * Publishes a region of the window on the update topic.
+   * @param region the buffer region of the window.
+   */
+  void publishRegion(const grid_map::BufferRegion& region);
+
+  /*!
+   * Publishes a submap of the window on the update topic.
+   * @param center the center of the submap.
+   * @param length the side lengths of the submap.
+   */
+  void publishSubmap(const grid_map::Position& center, const grid_map::Length& length);
+
+  /*!
+   * Publishes the entire window.
+   */
+  void publishWindow();
+
+  /*!
+   * Gets a tile from the cache, requests it from the background thread if it is not cached.
+   * @param[in] tileIndex the tile index.
+   * @param[out] tile the tile, nullptr if the tile is not stored or not cached.
+   * @return true if the tile was cached, false if it is requested.
+   */
+  bool getTile(const grid_map::Index& tileIndex, std::shared_ptr<const grid_map::GridMap>& tile);
+
+  /*!
+   * Queues the tiles covered by the window at a position for prefetching.
+   * @param position the position of the window.
+   */
+  void prefetch(const grid_map::Position& position);
+
+  /*!
+   * Loads the requested and queued tiles into the cache, requested tiles first (background thread).
+   */
+  void prefetchThread();
+
+  /*!
+   * Inserts a tile into the cache and evicts the least recently used tiles.
+   * Note: `cacheMutex_` needs to be locked.
+   * @param key the tile key.
+   * @param tile the tile.
+   */
+  void insertTile(const TileKey& key, std::shared_ptr<const grid_map::GridMap> tile);
+
+  //! ROS nodehandle.
+  ros::NodeHandle nodeHandle_;
+
+  //! Publisher of the entire window.
+  ros::Publisher publisher_;
+
+  //! Publisher of the newly exposed regions of the window.
+  ros::Publisher updatePublisher_;
+
+  //! Subscriber of the robot pose.
+  ros::Subscriber poseSubscriber_;
+
+  //! Timer to fill the window from requested tiles.
+  ros::Timer pendingTilesTimer_;
+
+  //! Tiles on disk.
+  std::unique_ptr<GridMapTileStore> tileStore_;
+
+  //! Window of the map around the robot.
+  grid_map::GridMap window_;
+
+  //! True if the window is initialized.
+  bool isWindowInitialized_;
+
+  //! Last robot position and time, to predict the motion.
+  grid_map::Position lastPosition_;
+  ros::Time lastTime_;
+
+  //! Time the entire window was last published.
+  ros::Time lastWindowPublishTime_;
+
+  //! Requested tiles that are not filled into the window yet.
+  std::set<TileKey> pendingTiles_;
+
+  //! Tile cache.
+  std::mutex cacheMutex_;
+  std::map<TileKey, CachedTile> cache_;
+  uint64_t cacheCounter_;
+
+  //! Tiles to load, requested ones and ones to prefetch.
+  std::mutex prefetchMutex_;
+  std::condition_variable prefetchCondition_;
+  std::deque<grid_map::Index> requestQueue_;
+  std::deque<grid_map::Index> prefetchQueue_;
+  bool isShutdown_;
+  std::thread prefetchThread_;
+
+  //! Directory of the tiles.
+  std::string tileDirectory_;
+
+  //! Side length of the tiles [m].
+  double tileLength_;
+
+  //! Topic name of the grid map in the tile bags.
+  std::string bagTopic_;
+
+  //! Topic names of the window and of the updates.
+  std::string publishTopic_;
+  std::string updateTopic_;
+
+  //! Topic name of the robot pose.
+  std::string poseTopic_;
+
+  //! Side lengths of the window [m].
+  grid_map::Length windowLength_;
+
+  //! Time horizon to prefetch tiles along the predicted motion [s].
+  double prefetchHorizon_;
+
+  //! Maximum number of cached tiles.
+  int maxCachedTiles_;
+
+  //! Minimum period to republish the entire window while moving [s].
+  double windowPublishPeriod_;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+} /* namespace */
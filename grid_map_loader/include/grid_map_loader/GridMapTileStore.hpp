@@ -0,0 +1,129 @@
+/*
+ * GridMapTileStore.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+// Grid map
+#include <grid_map_core/GridMap.hpp>
+
+// STD
+#include <map>
+#include <string>
+#include <utility>
+
+namespace grid_map_loader {
+
+/*!
+ * Grid map stored on disk as square tiles, one bag file per tile, such that parts of
+ * maps larger than memory can be loaded on demand.
+ * The tiles form a regular grid in the map frame: tile (i, j) covers the area
+ * [i * tileLength, (i + 1) * tileLength) x [j * tileLength, (j + 1) * tileLength)
+ * and is stored as `<directory>/tile_<i>_<j>.bag`. Missing tiles are treated as empty.
+ */
+class GridMapTileStore
+{
+ public:
+  /*!
+   * Constructor.
+   * @param directory the directory of the tiles.
+   * @param tileLength the side length of the tiles [m].
+   * @param bagTopic the topic of the grid map in the tile bags.
+   */
+  GridMapTileStore(const std::string& directory, double tileLength, const std::string& bagTopic = "/grid_map");
+
+  /*!
+   * Gets the index of the tile containing a position.
+   * @param position the position in the map frame.
+   * @return the tile index.
+   */
+  grid_map::Index getTileIndex(const grid_map::Position& position) const;
+
+  /*!
+   * Gets the center of a tile.
+   * @param tileIndex the tile index.
+   * @return the center of the tile in the map frame.
+   */
+  grid_map::Position getTileCenter(const grid_map::Index& tileIndex) const;
+
+  /*!
+   * Gets the path of the bag file of a tile.
+   * @param tileIndex the tile index.
+   * @return the path.
+   */
+  std::string getTilePath(const grid_map::Index& tileIndex) const;
+
+  /*!
+   * Checks if a tile is stored.
+   * @param tileIndex the tile index.
+   * @return true if the tile is stored.
+   */
+  bool hasTile(const grid_map::Index& tileIndex) const;
+
+  /*!
+   * Loads a tile.
+   * @param[in] tileIndex the tile index.
+   * @param[out] tile the tile.
+   * @return true if successful, false if the tile is not stored.
+   */
+  bool loadTile(const grid_map::Index& tileIndex, grid_map::GridMap& tile) const;
+
+  /*!
+   * Splits a map into tiles and stores them.
+   * The cells of the tiles are aligned to the resolution of the map, the tile length
+   * should be a multiple of the resolution.
+   * @param map the map.
+   * @param mergeWithStoredTiles if true, the valid cells of the map are written into the stored
+   * tiles (with the same resolution), otherwise existing tiles are overwritten.
+   * @return the number of stored tiles.
+   */
+  size_t writeTiles(const grid_map::GridMap& map, bool mergeWithStoredTiles = false) const;
+
+  /*!
+   * Splits the maps of a bag into tiles, one message at a time, and merges them into the stored
+   * tiles (see `writeTiles()`). The tiles touched by the messages are merged in memory and stored
+   * once after the last message, such that a bag holding a map as a sequence of overlapping submaps
+   * is tiled without a disk round-trip per message and tile. Memory is bounded by the touched
+   * tiles, not by the messages, which are read one at a time.
+   * @param pathToBag the path to the bag.
+   * @param topic the topic of the maps in the bag.
+   * @return the number of maps read from the bag, or -1 if the bag could not be read (no tile is
+   * stored in this case).
+   */
+  int writeTilesFromBag(const std::string& pathToBag, const std::string& topic) const;
+
+  double getTileLength() const;
+
+ private:
+  using TileKey = std::pair<int, int>;
+
+  /*!
+   * Splits a map into tiles and merges them into the tiles in memory.
+   * Tiles which are not in memory yet are loaded from disk if `mergeWithStoredTiles` is true.
+   * @param[in] map the map.
+   * @param[in] mergeWithStoredTiles if true, the stored tiles are loaded to be merged with the map.
+   * @param[in/out] tiles the tiles in memory, the tiles touched by the map are added.
+   */
+  void mergeIntoTiles(const grid_map::GridMap& map, bool mergeWithStoredTiles,
+                      std::map<TileKey, grid_map::GridMap>& tiles) const;
+
+  /*!
+   * Stores tiles.
+   * @param tiles the tiles.
+   * @return the number of stored tiles.
+   */
+  size_t saveTiles(const std::map<TileKey, grid_map::GridMap>& tiles) const;
+
+  //! Directory of the tiles.
+  std::string directory_;
+
+  //! Side length of the tiles [m].
+  double tileLength_;
+
+  //! Topic of the grid map in the tile bags.
+  std::string bagTopic_;
+};
+
+} /* namespace */
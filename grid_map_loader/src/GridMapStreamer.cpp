@@ -0,0 +1,340 @@
+/*
+ * GridMapStreamer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <grid_map_loader/GridMapStreamer.hpp>
+#include <grid_map_msgs/GridMap.h>
+
+// STD
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace grid_map;
+
+namespace grid_map_loader {
+
+GridMapStreamer::GridMapStreamer(ros::NodeHandle nodeHandle)
+    : nodeHandle_(nodeHandle),
+      isWindowInitialized_(false),
+      cacheCounter_(0),
+      isShutdown_(false)
+{
+  readParameters();
+  tileStore_.reset(new GridMapTileStore(tileDirectory_, tileLength_, bagTopic_));
+  publisher_ = nodeHandle_.advertise<grid_map_msgs::GridMap>(publishTopic_, 1, true);
+  updatePublisher_ = nodeHandle_.advertise<grid_map_msgs::GridMap>(updateTopic_, 10);
+  prefetchThread_ = std::thread(&GridMapStreamer::prefetchThread, this);
+  poseSubscriber_ = nodeHandle_.subscribe(poseTopic_, 1, &GridMapStreamer::poseCallback, this);
+  pendingTilesTimer_ = nodeHandle_.createTimer(ros::Duration(0.05), &GridMapStreamer::fillPendingTiles, this);
+}
+
+GridMapStreamer::~GridMapStreamer()
+{
+  {
+    std::lock_guard<std::mutex> lock(prefetchMutex_);
+    isShutdown_ = true;
+  }
+  prefetchCondition_.notify_all();
+  if (prefetchThread_.joinable()) prefetchThread_.join();
+}
+
+bool GridMapStreamer::readParameters()
+{
+  nodeHandle_.param("tile_directory", tileDirectory_, std::string());
+  nodeHandle_.param("tile_length", tileLength_, 10.0);
+  nodeHandle_.param("bag_topic", bagTopic_, std::string("/grid_map"));
+  nodeHandle_.param("publish_topic", publishTopic_, std::string("grid_map"));
+  nodeHandle_.param("update_topic", updateTopic_, std::string("grid_map_update"));
+  nodeHandle_.param("pose_topic", poseTopic_, std::string("/pose"));
+  nodeHandle_.param("window_length_x", windowLength_.x(), 20.0);
+  nodeHandle_.param("window_length_y", windowLength_.y(), 20.0);
+  nodeHandle_.param("prefetch_horizon", prefetchHorizon_, 2.0);
+  nodeHandle_.param("max_cached_tiles", maxCachedTiles_, 64);
+  nodeHandle_.param("window_publish_period", windowPublishPeriod_, 1.0);
+
+  // The cache has to hold the tiles of the current and of the prefetched window.
+  const Index tilesPerWindow = (windowLength_ / tileLength_).ceil().cast<int>() + 1;
+  const int minCachedTiles = 2 * tilesPerWindow.prod();
+  if (maxCachedTiles_ < minCachedTiles) {
+    ROS_WARN("Increasing max_cached_tiles to %i to hold the tiles of the window.", minCachedTiles);
+    maxCachedTiles_ = minCachedTiles;
+  }
+  return true;
+}
+
+void GridMapStreamer::poseCallback(const geometry_msgs::PoseStamped& pose)
+{
+  const Position position(pose.pose.position.x, pose.pose.position.y);
+  const ros::Time time = pose.header.stamp.isZero() ? ros::Time::now() : pose.header.stamp;
+
+  if (!isWindowInitialized_) {
+    if (!initializeWindow(position)) {
+      ROS_WARN_THROTTLE(5.0, "No tile of the map is loaded at the robot position (%f, %f).", position.x(), position.y());
+      return;
+    }
+    window_.setTimestamp(time.toNSec());
+    publishWindow();
+    lastWindowPublishTime_ = time;
+  } else {
+    std::vector<BufferRegion> newRegions;
+    window_.move(position, newRegions);
+    window_.setTimestamp(time.toNSec());
+    for (const auto& region : newRegions) {
+      fillRegion(region);
+    }
+    for (const auto& region : newRegions) {
+      publishRegion(region);
+    }
+    // The latched window has to follow the robot for late subscribers.
+    if (!newRegions.empty() && (time - lastWindowPublishTime_).toSec() >= windowPublishPeriod_) {
+      publishWindow();
+      lastWindowPublishTime_ = time;
+    }
+  }
+
+  // Prefetch along the predicted motion.
+  const double duration = (time - lastTime_).toSec();
+  if (isWindowInitialized_ && duration > 0.0) {
+    const Position velocity = (position - lastPosition_) / duration;
+    prefetch(position + prefetchHorizon_ * velocity);
+  }
+  lastPosition_ = position;
+  lastTime_ = time;
+  isWindowInitialized_ = true;
+}
+
+bool GridMapStreamer::initializeWindow(const Position& position)
+{
+  // The tile at the robot is requested, the window is initialized on a later pose once it is loaded.
+  std::shared_ptr<const GridMap> tile;
+  if (!getTile(tileStore_->getTileIndex(position), tile) || !tile) return false;
+
+  window_ = GridMap(tile->getLayers());
+  window_.setBasicLayers(tile->getBasicLayers());
+  window_.setFrameId(tile->getFrameId());
+  const double resolution = tile->getResolution();
+  window_.setGeometry(windowLength_, resolution, Position::Zero());
+
+  // Align the cells of the window with the cells of the tiles.
+  const Length halfLength = 0.5 * window_.getLength();
+  const Position corner = (((position.array() - halfLength) / resolution).round() * resolution).matrix();
+  window_.setPosition((corner.array() + halfLength).matrix());
+  fillRegion(BufferRegion(Index::Zero(), window_.getSize(), BufferRegion::Quadrant::Undefined));
+  ROS_INFO("Initialized streaming window of size %i x %i at (%f, %f).", window_.getSize()(0), window_.getSize()(1),
+           window_.getPosition().x(), window_.getPosition().y());
+  return true;
+}
+
+void GridMapStreamer::fillRegion(const BufferRegion& region)
+{
+  TileKey currentKey(std::numeric_limits<int>::min(), std::numeric_limits<int>::min());
+  std::shared_ptr<const GridMap> tile;
+  std::vector<std::pair<Matrix*, const Matrix*>> layers;
+
+  for (SubmapIterator iterator(window_, region); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    window_.getPosition(*iterator, position);
+    const Index tileIndex = tileStore_->getTileIndex(position);
+    const TileKey key(tileIndex(0), tileIndex(1));
+    if (key != currentKey) {
+      // Look up the tile and its layers once per run of cells in the same tile.
+      currentKey = key;
+      getTile(tileIndex, tile);
+      layers.clear();
+      if (tile) {
+        for (const auto& layer : window_.getLayers()) {
+          if (tile->exists(layer)) layers.emplace_back(&window_.get(layer), &tile->get(layer));
+        }
+      }
+    }
+    Index indexInTile;
+    if (!tile || !tile->getIndex(position, indexInTile)) continue;
+    for (const auto& layer : layers) {
+      (*layer.first)((*iterator)(0), (*iterator)(1)) = (*layer.second)(indexInTile(0), indexInTile(1));
+    }
+  }
+}
+
+void GridMapStreamer::fillPendingTiles(const ros::TimerEvent& /*timerEvent*/)
+{
+  for (auto pendingTile = pendingTiles_.begin(); pendingTile != pendingTiles_.end();) {
+    std::shared_ptr<const GridMap> tile;
+    bool isCached = false;
+    {
+      std::lock_guard<std::mutex> lock(cacheMutex_);
+      const auto cached = cache_.find(*pendingTile);
+      if (cached != cache_.end()) {
+        cached->second.lastUsed = ++cacheCounter_;
+        tile = cached->second.tile;
+        isCached = true;
+      }
+    }
+    const Index tileIndex(pendingTile->first, pendingTile->second);
+
+    // Part of the window covered by the tile, the cells of the window are aligned with the tile borders.
+    const Position windowHalfLength = 0.5 * window_.getLength().matrix();
+    const Position tileHalfLength = Position::Constant(0.5 * tileStore_->getTileLength());
+    const Position tileCenter = tileStore_->getTileCenter(tileIndex);
+    const Position minPosition = (window_.getPosition() - windowHalfLength).cwiseMax(tileCenter - tileHalfLength);
+    const Position maxPosition = (window_.getPosition() + windowHalfLength).cwiseMin(tileCenter + tileHalfLength);
+    const bool isInWindow = isWindowInitialized_ && (minPosition.array() < maxPosition.array()).all();
+
+    if (!isCached) {
+      if (!isInWindow) {
+        pendingTile = pendingTiles_.erase(pendingTile);
+        continue;
+      }
+      // Still loading, or evicted from the cache before it was filled in, then it is requested again.
+      {
+        std::lock_guard<std::mutex> lock(prefetchMutex_);
+        if (std::none_of(requestQueue_.begin(), requestQueue_.end(),
+                         [&](const Index& index) { return (index == tileIndex).all(); })) {
+          requestQueue_.push_back(tileIndex);
+        }
+      }
+      prefetchCondition_.notify_one();
+      ++pendingTile;
+      continue;
+    }
+    pendingTile = pendingTiles_.erase(pendingTile);
+    if (!tile || !isInWindow) continue;
+    const Position center = 0.5 * (minPosition + maxPosition);
+    // Shrink the length by half a cell to not depend on rounding at the cell borders.
+    const Length length = (maxPosition - minPosition).array() - 0.5 * window_.getResolution();
+
+    bool isSuccess;
+    const SubmapGeometry submap(window_, center, length, isSuccess);
+    if (!isSuccess) continue;
+    fillRegion(BufferRegion(submap.getStartIndex(), submap.getSize(), BufferRegion::Quadrant::Undefined));
+    publishSubmap(center, length);
+  }
+}
+
+void GridMapStreamer::publishRegion(const BufferRegion& region)
+{
+  const Size& size = region.getSize();
+  const double resolution = window_.getResolution();
+  if ((size == window_.getSize()).all()) {
+    publishWindow();
+    return;
+  }
+
+  // The region spans the entire window in (at least) one dimension, and is not wrapped in the other.
+  Position firstPosition, lastPosition;
+  window_.getPosition(region.getStartIndex(), firstPosition);
+  window_.getPosition(region.getStartIndex() + size - Index::Ones(), lastPosition);
+  Position center = 0.5 * (firstPosition + lastPosition);
+  for (int i = 0; i < 2; ++i) {
+    if (size(i) == window_.getSize()(i)) center(i) = window_.getPosition()(i);
+  }
+  // Shrink the requested length by half a cell to not depend on rounding at the cell borders.
+  publishSubmap(center, (size.cast<double>() - 0.5) * resolution);
+}
+
+void GridMapStreamer::publishSubmap(const Position& center, const Length& length)
+{
+  grid_map_msgs::GridMap message;
+  if (!GridMapRosConverter::toSubmapMessage(window_, center, length, window_.getLayers(), message)) {
+    ROS_WARN("Could not publish updated region of the window.");
+    return;
+  }
+  updatePublisher_.publish(message);
+}
+
+void GridMapStreamer::publishWindow()
+{
+  grid_map_msgs::GridMap message;
+  GridMapRosConverter::toMessage(window_, message);
+  publisher_.publish(message);
+}
+
+bool GridMapStreamer::getTile(const Index& tileIndex, std::shared_ptr<const GridMap>& tile)
+{
+  const TileKey key(tileIndex(0), tileIndex(1));
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    const auto cached = cache_.find(key);
+    if (cached != cache_.end()) {
+      cached->second.lastUsed = ++cacheCounter_;
+      tile = cached->second.tile;
+      return true;
+    }
+  }
+
+  // Not prefetched in time, request it without blocking the callback.
+  tile.reset();
+  if (pendingTiles_.insert(key).second) {
+    {
+      std::lock_guard<std::mutex> lock(prefetchMutex_);
+      requestQueue_.push_back(tileIndex);
+    }
+    prefetchCondition_.notify_one();
+  }
+  return false;
+}
+
+void GridMapStreamer::prefetch(const Position& position)
+{
+  const Position halfLength = 0.5 * windowLength_.matrix();
+  const Index minTile = tileStore_->getTileIndex(position - halfLength);
+  const Index maxTile = tileStore_->getTileIndex(position + halfLength);
+
+  std::vector<Index> tileIndices;
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    for (int i = minTile(0); i <= maxTile(0); ++i) {
+      for (int j = minTile(1); j <= maxTile(1); ++j) {
+        if (cache_.count(TileKey(i, j)) == 0) tileIndices.emplace_back(i, j);
+      }
+    }
+  }
+  if (tileIndices.empty()) return;
+  {
+    std::lock_guard<std::mutex> lock(prefetchMutex_);
+    // Only the latest prediction is relevant.
+    prefetchQueue_.assign(tileIndices.begin(), tileIndices.end());
+  }
+  prefetchCondition_.notify_one();
+}
+
+void GridMapStreamer::prefetchThread()
+{
+  while (true) {
+    Index tileIndex;
+    {
+      std::unique_lock<std::mutex> lock(prefetchMutex_);
+      prefetchCondition_.wait(lock, [this]() { return isShutdown_ || !requestQueue_.empty() || !prefetchQueue_.empty(); });
+      if (isShutdown_) return;
+      std::deque<Index>& queue = requestQueue_.empty() ? prefetchQueue_ : requestQueue_;
+      tileIndex = queue.front();
+      queue.pop_front();
+    }
+    const TileKey key(tileIndex(0), tileIndex(1));
+    {
+      std::lock_guard<std::mutex> lock(cacheMutex_);
+      if (cache_.count(key) > 0) continue;
+    }
+    std::shared_ptr<GridMap> tile = std::make_shared<GridMap>();
+    if (!tileStore_->loadTile(tileIndex, *tile)) tile.reset();
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    insertTile(key, tile);
+  }
+}
+
+void GridMapStreamer::insertTile(const TileKey& key, std::shared_ptr<const GridMap> tile)
+{
+  cache_[key] = CachedTile{std::move(tile), ++cacheCounter_};
+  while (cache_.size() > static_cast<size_t>(maxCachedTiles_)) {
+    auto leastRecentlyUsed = cache_.begin();
+    for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+      if (it->second.lastUsed < leastRecentlyUsed->second.lastUsed) leastRecentlyUsed = it;
+    }
+    cache_.erase(leastRecentlyUsed);
+  }
+}
+
+} /* namespace */
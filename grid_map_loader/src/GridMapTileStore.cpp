@@ -0,0 +1,165 @@
+/*
+ * GridMapTileStore.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <grid_map_loader/GridMapTileStore.hpp>
+#include <grid_map_core/iterators/GridMapIterator.hpp>
+#include <grid_map_ros/GridMapRosConverter.hpp>
+#include <grid_map_ros/GridMapSerialization.hpp>
+
+// ROS
+#include <rosbag/bag.h>
+#include <rosbag/view.h>
+
+// STD
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <utility>
+#include <vector>
+
+using namespace grid_map;
+
+namespace grid_map_loader {
+
+GridMapTileStore::GridMapTileStore(const std::string& directory, const double tileLength, const std::string& bagTopic)
+    : directory_(directory),
+      tileLength_(tileLength),
+      bagTopic_(bagTopic)
+{
+}
+
+Index GridMapTileStore::getTileIndex(const Position& position) const
+{
+  return Index(static_cast<int>(std::floor(position.x() / tileLength_)),
+               static_cast<int>(std::floor(position.y() / tileLength_)));
+}
+
+Position GridMapTileStore::getTileCenter(const Index& tileIndex) const
+{
+  return (tileIndex.cast<double>() + 0.5).matrix() * tileLength_;
+}
+
+std::string GridMapTileStore::getTilePath(const Index& tileIndex) const
+{
+  return directory_ + "/tile_" + std::to_string(tileIndex(0)) + "_" + std::to_string(tileIndex(1)) + ".bag";
+}
+
+bool GridMapTileStore::hasTile(const Index& tileIndex) const
+{
+  return std::ifstream(getTilePath(tileIndex)).good();
+}
+
+bool GridMapTileStore::loadTile(const Index& tileIndex, GridMap& tile) const
+{
+  if (!hasTile(tileIndex)) return false;
+  return GridMapRosConverter::loadFromBag(getTilePath(tileIndex), bagTopic_, tile);
+}
+
+size_t GridMapTileStore::writeTiles(const GridMap& map, const bool mergeWithStoredTiles) const
+{
+  std::map<TileKey, GridMap> tiles;
+  mergeIntoTiles(map, mergeWithStoredTiles, tiles);
+  return saveTiles(tiles);
+}
+
+int GridMapTileStore::writeTilesFromBag(const std::string& pathToBag, const std::string& topic) const
+{
+  int nMaps = 0;
+  std::map<TileKey, GridMap> tiles;
+  try {
+    rosbag::Bag bag;
+    bag.open(pathToBag, rosbag::bagmode::Read);
+    rosbag::View view(bag, rosbag::TopicQuery(topic));
+    for (const auto& messageInstance : view) {
+      // Deserialized directly into a map, without an intermediate message.
+      const auto submap = messageInstance.instantiate<DeserializableGridMap>();
+      if (!submap) {
+        ROS_WARN("Unable to read grid map from the bag %s.", pathToBag.c_str());
+        return -1;
+      }
+      mergeIntoTiles(submap->getGridMap(), true, tiles);
+      ++nMaps;
+    }
+    bag.close();
+  } catch (const rosbag::BagException& exception) {
+    ROS_ERROR("Unable to read the bag %s: %s", pathToBag.c_str(), exception.what());
+    return -1;
+  }
+  saveTiles(tiles);
+  return nMaps;
+}
+
+void GridMapTileStore::mergeIntoTiles(const GridMap& map, const bool mergeWithStoredTiles,
+                                      std::map<TileKey, GridMap>& tiles) const
+{
+  const Position halfLength = 0.5 * map.getLength().matrix();
+  const Index minTile = getTileIndex(map.getPosition() - halfLength);
+  const Index maxTile = getTileIndex(map.getPosition() + halfLength);
+
+  for (int i = minTile(0); i <= maxTile(0); ++i) {
+    for (int j = minTile(1); j <= maxTile(1); ++j) {
+      const Index tileIndex(i, j);
+      const auto insertion = tiles.emplace(TileKey(i, j), GridMap());
+      GridMap& tile = insertion.first->second;
+      // Tiles already in memory are always merged, the others only if they are stored.
+      const bool hasStoredData = !insertion.second || (mergeWithStoredTiles && loadTile(tileIndex, tile));
+      const bool isMerged = hasStoredData &&
+                            std::abs(tile.getResolution() - map.getResolution()) < 1e-6 * map.getResolution();
+      if (isMerged) {
+        for (const auto& layer : map.getLayers()) {
+          if (!tile.exists(layer)) tile.add(layer);
+        }
+      } else {
+        tile = GridMap(map.getLayers());
+        tile.setBasicLayers(map.getBasicLayers());
+        tile.setFrameId(map.getFrameId());
+        tile.setGeometry(Length::Constant(tileLength_), map.getResolution(), getTileCenter(tileIndex));
+      }
+      tile.setTimestamp(map.getTimestamp());
+
+      // Look up the layers once, not for every cell.
+      std::vector<std::pair<const Matrix*, Matrix*>> layerData;
+      layerData.reserve(map.getLayers().size());
+      for (const auto& layer : map.getLayers()) {
+        layerData.emplace_back(&map.get(layer), &tile.get(layer));
+      }
+
+      bool hasData = false;
+      for (GridMapIterator iterator(tile); !iterator.isPastEnd(); ++iterator) {
+        Position position;
+        Index index;
+        tile.getPosition(*iterator, position);
+        if (!map.getIndex(position, index)) continue;
+        const Index tileCell(*iterator);
+        for (const auto& data : layerData) {
+          const float value = (*data.first)(index(0), index(1));
+          // Merged maps only overwrite the stored data with valid cells.
+          if (!isMerged || std::isfinite(value)) (*data.second)(tileCell(0), tileCell(1)) = value;
+        }
+        hasData = true;
+      }
+      // Tiles without cells of the map are not written.
+      if (!hasData && insertion.second) tiles.erase(insertion.first);
+    }
+  }
+}
+
+size_t GridMapTileStore::saveTiles(const std::map<TileKey, GridMap>& tiles) const
+{
+  size_t nTiles = 0;
+  for (const auto& tile : tiles) {
+    const Index tileIndex(tile.first.first, tile.first.second);
+    if (GridMapRosConverter::saveToBag(tile.second, getTilePath(tileIndex), bagTopic_)) ++nTiles;
+  }
+  return nTiles;
+}
+
+double GridMapTileStore::getTileLength() const
+{
+  return tileLength_;
+}
+
+} /* namespace */
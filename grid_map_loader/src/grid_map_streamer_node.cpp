@@ -0,0 +1,17 @@
+/*
+ * grid_map_streamer_node.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <grid_map_loader/GridMapStreamer.hpp>
+#include <ros/ros.h>
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "grid_map_streamer");
+  ros::NodeHandle nodeHandle("~");
+  grid_map_loader::GridMapStreamer gridMapStreamer(nodeHandle);
+  ros::spin();
+  return 0;
+}
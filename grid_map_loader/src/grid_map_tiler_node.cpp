@@ -0,0 +1,34 @@
+/*
+ * grid_map_tiler_node.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <grid_map_loader/GridMapTileStore.hpp>
+#include <ros/ros.h>
+
+// STD
+#include <string>
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "grid_map_tiler");
+  ros::NodeHandle nodeHandle("~");
+  std::string filePath, bagTopic, tileDirectory;
+  double tileLength;
+  nodeHandle.param("file_path", filePath, std::string());
+  nodeHandle.param("bag_topic", bagTopic, std::string("/grid_map"));
+  nodeHandle.param("tile_directory", tileDirectory, std::string());
+  nodeHandle.param("tile_length", tileLength, 10.0);
+  if (filePath.empty() || tileDirectory.empty()) {
+    ROS_ERROR("The parameters file_path and tile_directory are required.");
+    return 1;
+  }
+
+  ROS_INFO_STREAM("Writing tiles of the grid maps in " << filePath << " to " << tileDirectory << ".");
+  const grid_map_loader::GridMapTileStore tileStore(tileDirectory, tileLength, bagTopic);
+  const int nMaps = tileStore.writeTilesFromBag(filePath, bagTopic);
+  if (nMaps < 0) return 1;
+  ROS_INFO("Tiled %i grid maps.", nMaps);
+  return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ * GridMapTileStoreTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <grid_map_loader/GridMapTileStore.hpp>
+#include <grid_map_core/iterators/GridMapIterator.hpp>
+#include <grid_map_ros/GridMapRosConverter.hpp>
+
+// ROS
+#include <rosbag/bag.h>
+
+// gtest
+#include <gtest/gtest.h>
+
+// STD
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+using namespace grid_map;
+using namespace grid_map_loader;
+
+TEST(GridMapTileStore, TileIndices)
+{
+  const GridMapTileStore tileStore("/tmp", 10.0);
+  EXPECT_TRUE((Index(0, 0) == tileStore.getTileIndex(Position(0.1, 9.9))).all());
+  EXPECT_TRUE((Index(-1, 2) == tileStore.getTileIndex(Position(-0.1, 20.0))).all());
+  EXPECT_DOUBLE_EQ(-5.0, tileStore.getTileCenter(Index(-1, 2)).x());
+  EXPECT_DOUBLE_EQ(25.0, tileStore.getTileCenter(Index(-1, 2)).y());
+  EXPECT_EQ("/tmp/tile_-1_2.bag", tileStore.getTilePath(Index(-1, 2)));
+}
+
+TEST(GridMapTileStore, WriteAndLoad)  // NOLINT
+{
+  char directoryTemplate[] = "/tmp/grid_map_tiles_XXXXXX";
+  ASSERT_NE(nullptr, mkdtemp(directoryTemplate));
+  const GridMapTileStore tileStore(directoryTemplate, 2.0);
+
+  GridMap map({"elevation", "variance"});
+  map.setFrameId("map");
+  map.setGeometry(Length(5.0, 3.0), 0.1, Position(1.0, -0.5));
+  map["elevation"].setRandom();
+  map["variance"].setRandom();
+  // Tiles x: [-2, 4) -> 3 tiles, y: [-2, 2) -> 2 tiles.
+  EXPECT_EQ(6u, tileStore.writeTiles(map));
+  EXPECT_FALSE(tileStore.hasTile(Index(5, 5)));
+
+  for (int i = -1; i <= 1; ++i) {
+    for (int j = -1; j <= 0; ++j) {
+      GridMap tile;
+      ASSERT_TRUE(tileStore.loadTile(Index(i, j), tile));
+      EXPECT_EQ("map", tile.getFrameId());
+      for (GridMapIterator iterator(tile); !iterator.isPastEnd(); ++iterator) {
+        Position position;
+        tile.getPosition(*iterator, position);
+        Index index;
+        if (!map.getIndex(position, index)) {
+          EXPECT_TRUE(std::isnan(tile.at("elevation", *iterator)));
+          continue;
+        }
+        EXPECT_EQ(map.at("elevation", index), tile.at("elevation", *iterator));
+        EXPECT_EQ(map.at("variance", index), tile.at("variance", *iterator));
+      }
+    }
+  }
+}
+
+TEST(GridMapTileStore, WriteFromBag)  // NOLINT
+{
+  char directoryTemplate[] = "/tmp/grid_map_tiles_XXXXXX";
+  ASSERT_NE(nullptr, mkdtemp(directoryTemplate));
+  const std::string directory(directoryTemplate);
+  const GridMapTileStore tileStore(directory, 2.0);
+
+  // The map is stored as a sequence of two overlapping submaps.
+  GridMap first({"elevation"});
+  first.setFrameId("map");
+  first.setGeometry(Length(3.0, 2.0), 0.1, Position(0.5, 0.0));
+  first["elevation"].setConstant(1.0);
+  GridMap second = first;
+  second.setPosition(Position(2.5, 0.0));
+  second["elevation"].setConstant(2.0);
+  second.atPosition("elevation", Position(1.55, -0.55)) = NAN;
+
+  const std::string pathToBag = directory + "/submaps.bag";
+  rosbag::Bag bag;
+  bag.open(pathToBag, rosbag::bagmode::Write);
+  for (const auto& submap : {first, second}) {
+    grid_map_msgs::GridMap message;
+    GridMapRosConverter::toMessage(submap, message);
+    bag.write("/grid_map", ros::Time(1.0), message);
+  }
+  bag.close();
+
+  EXPECT_EQ(2, tileStore.writeTilesFromBag(pathToBag, "/grid_map"));
+  EXPECT_EQ(-1, tileStore.writeTilesFromBag(directory + "/missing.bag", "/grid_map"));
+
+  // Both submaps are merged into the tiles, later ones overwrite with their valid cells.
+  GridMap tile;
+  ASSERT_TRUE(tileStore.loadTile(Index(0, 0), tile));
+  EXPECT_FLOAT_EQ(1.0, tile.atPosition("elevation", Position(0.45, 0.55)));
+  EXPECT_FLOAT_EQ(2.0, tile.atPosition("elevation", Position(1.55, 0.55)));
+  ASSERT_TRUE(tileStore.loadTile(Index(0, -1), tile));
+  EXPECT_FLOAT_EQ(1.0, tile.atPosition("elevation", Position(1.55, -0.55)));
+  ASSERT_TRUE(tileStore.loadTile(Index(1, -1), tile));
+  EXPECT_FLOAT_EQ(2.0, tile.atPosition("elevation", Position(3.05, -0.55)));
+  // Cells not covered by any submap stay empty.
+  ASSERT_TRUE(tileStore.loadTile(Index(-1, 0), tile));
+  EXPECT_TRUE(std::isnan(tile.atPosition("elevation", Position(-1.95, 1.95))));
+}
@@ -0,0 +1,140 @@
+/*
+ * GridMapLayerSelectionPublisher.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <grid_map_core/GridMap.hpp>
+
+// STL
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ROS
+#include <ros/ros.h>
+
+namespace grid_map {
+
+/*!
+ * Publisher of grid maps that sends each subscriber only the layers it selected.
+ * All layers are published on `topic`. Subsets of layers (selections) are published on `topic/<name>`,
+ * declared by the publisher with `addSelection()` or by the subscribers with the parameter
+ * `topic/layer_selections/<name>` (list of layers, relative to the node handle of the publisher), e.g.
+ *
+ *   rosparam set /grid_map/layer_selections/rviz "[elevation, color]"
+ *   rostopic echo /grid_map/rviz
+ *
+ * The parameter is checked on every `publish()` and topics for new selections are advertised.
+ * On `publish()`, each distinct set of layers that has subscribers is serialized once, directly from the map
+ * (see `SerializableGridMap`), and the bytes are sent on all topics that selected it.
+ */
+class GridMapLayerSelectionPublisher
+{
+ public:
+  /*!
+   * Constructor, advertises the topic with all layers.
+   * @param nodeHandle the node handle.
+   * @param topic the topic with all layers, and namespace of the selections.
+   * @param queueSize the queue size of the publishers.
+   * @param latch whether the publishers are latched. Latched topics are published without subscribers.
+   */
+  GridMapLayerSelectionPublisher(ros::NodeHandle& nodeHandle, const std::string& topic, uint32_t queueSize = 1, bool latch = false);
+
+  /*!
+   * Destructor.
+   */
+  virtual ~GridMapLayerSelectionPublisher() = default;
+
+  /*!
+   * Adds a selection of layers, published on `topic/name`. Replaces an existing selection with the same name.
+   * @param name the name of the selection.
+   * @param layers the selected layers, empty for all layers.
+   */
+  void addSelection(const std::string& name, const std::vector<std::string>& layers);
+
+  /*!
+   * Adds the selections from the parameter `topic/layer_selections` (see class description).
+   */
+  void updateSelections();
+
+  /*!
+   * Publishes the map on all topics that have subscribers (or are latched).
+   * @param map the map.
+   */
+  void publish(const GridMap& map);
+
+  /*!
+   * Gets the names of the selections.
+   * @return the names of the selections.
+   */
+  std::vector<std::string> getSelectionNames() const;
+
+  /*!
+   * Gets the number of serializations of the map in the last `publish()`.
+   * @return the number of distinct layer sets that were published.
+   */
+  size_t getNumberOfSerializations() const;
+
+  /*!
+   * Gets the layers of a map that are published for a selection, in the order of the map.
+   * Selected layers that do not exist in the map are skipped.
+   * @param map the map.
+   * @param selection the selected layers, empty for all layers.
+   * @return the published layers.
+   */
+  static std::vector<std::string> getSelectedLayers(const GridMap& map, const std::vector<std::string>& selection);
+
+  /*!
+   * Serializes layers of a map in the wire format of `grid_map_msgs::GridMap`.
+   * @param map the map.
+   * @param layers the layers.
+   * @return the serialized map (without the length prefix of the message).
+   */
+  static std::shared_ptr<const std::vector<uint8_t>> serialize(const GridMap& map, const std::vector<std::string>& layers);
+
+ private:
+  //! Selection of layers.
+  struct Selection
+  {
+    //! Selected layers, empty for all layers.
+    std::vector<std::string> layers;
+
+    //! Publisher of the selection.
+    ros::Publisher publisher;
+  };
+
+  /*!
+   * Checks if a publisher needs the map.
+   * @param publisher the publisher.
+   * @return true if the publisher has subscribers or is latched.
+   */
+  bool isPublished(const ros::Publisher& publisher) const;
+
+  //! Node handle.
+  ros::NodeHandle nodeHandle_;
+
+  //! Topic with all layers.
+  std::string topic_;
+
+  //! Queue size of the publishers.
+  uint32_t queueSize_;
+
+  //! Whether the publishers are latched.
+  bool latch_;
+
+  //! Publisher of all layers.
+  ros::Publisher publisher_;
+
+  //! Selections by name.
+  std::map<std::string, Selection> selections_;
+
+  //! Number of serializations in the last publish.
+  size_t numberOfSerializations_;
+};
+
+} /* namespace grid_map */
@@ -81,6 +81,22 @@ class GridMapRosConverter
   static void toMessage(const grid_map::GridMap& gridMap, const std::vector<std::string>& layers,
                         grid_map_msgs::GridMap& message);
 
+  /*!
+   * Converts requested layers of a submap of a grid map object to a ROS grid map message.
+   * Same result as `toMessage(gridMap.getSubmap(position, length, isSuccess), layers, message)`,
+   * but the data is copied directly from the circular buffers of the map into the message
+   * without creating the submap.
+   * @param[in] gridMap the grid map object.
+   * @param[in] position the requested position of the submap (usually the center).
+   * @param[in] length the requested length of the submap.
+   * @param[in] layers the layers to be added to the message.
+   * @param[out] message the grid map message to be populated.
+   * @return true if successful, false if the submap is outside of the map or a layer is missing.
+   */
+  static bool toSubmapMessage(const grid_map::GridMap& gridMap, const grid_map::Position& position,
+                              const grid_map::Length& length, const std::vector<std::string>& layers,
+                              grid_map_msgs::GridMap& message);
+
   /*!
    * Converts a grid map object to a ROS PointCloud2 message. Set the layer to be transformed
    * as the points of the point cloud with `pointLayer`, all other types will be added as
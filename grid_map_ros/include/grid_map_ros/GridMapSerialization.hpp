@@ -0,0 +1,445 @@
+/*
+ * GridMapSerialization.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <grid_map_core/GridMap.hpp>
+#include <grid_map_msgs/GridMap.h>
+#include "grid_map_ros/GridMapMsgHelpers.hpp"
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ROS
+#include <ros/exception.h>
+#include <ros/message_traits.h>
+#include <ros/serialization.h>
+#include <std_msgs/MultiArrayLayout.h>
+
+namespace grid_map {
+
+/*!
+ * Adapter to publish a grid map without converting it to a `grid_map_msgs::GridMap` first.
+ * It is serialized in the wire format of `grid_map_msgs::GridMap` (as `GridMapRosConverter::toMessage()`),
+ * with the layer data streamed directly from the buffers of the map:
+ *
+ *   ros::Publisher publisher = nodeHandle.advertise<grid_map_msgs::GridMap>("grid_map", 1);
+ *   publisher.publish(SerializableGridMap(map));
+ *
+ * The adapter only references the map, which has to outlive it.
+ */
+class SerializableGridMap
+{
+ public:
+  /*!
+   * Constructor, for all layers of the map.
+   * @param gridMap the map to serialize.
+   */
+  explicit SerializableGridMap(const GridMap& gridMap)
+      : gridMap_(gridMap),
+        layers_(gridMap.getLayers())
+  {
+  }
+
+  /*!
+   * Constructor.
+   * @param gridMap the map to serialize.
+   * @param layers the layers to serialize.
+   */
+  SerializableGridMap(const GridMap& gridMap, std::vector<std::string> layers)
+      : gridMap_(gridMap),
+        layers_(std::move(layers))
+  {
+  }
+
+  //! Map to serialize.
+  const GridMap& gridMap_;
+
+  //! Layers to serialize.
+  std::vector<std::string> layers_;
+};
+
+/*!
+ * Adapter to receive a grid map without an intermediate `grid_map_msgs::GridMap`: the layer data is read
+ * from the wire format directly into the buffers of the map, reusing the buffers of existing layers.
+ * The map holds all layers of the message afterwards, other layers (including all sparse layers) are removed.
+ * Default constructed, the adapter owns its map, such that it can be used as subscription type:
+ *
+ *   nodeHandle.subscribe<DeserializableGridMap>("grid_map", 1, callback);
+ *
+ * To fill an existing map in place (e.g. with `ros::serialization::deserializeMessage()`), it can reference one instead.
+ */
+class DeserializableGridMap
+{
+ public:
+  /*!
+   * Constructor, owning the map.
+   */
+  DeserializableGridMap()
+      : ownedGridMap_(new GridMap()),
+        gridMap_(ownedGridMap_.get())
+  {
+  }
+
+  /*!
+   * Constructor, referencing a map to fill. The map has to outlive the adapter.
+   * @param gridMap the map to fill.
+   */
+  explicit DeserializableGridMap(GridMap& gridMap)
+      : gridMap_(&gridMap)
+  {
+  }
+
+  /*!
+   * Gets the map.
+   * @return the map.
+   */
+  GridMap& getGridMap() { return *gridMap_; }
+  const GridMap& getGridMap() const { return *gridMap_; }
+
+ private:
+  //! Map if owned by the adapter.
+  std::shared_ptr<GridMap> ownedGridMap_;
+
+  //! Map to fill.
+  GridMap* gridMap_;
+};
+
+/*!
+ * Grid map that is already serialized in the wire format of `grid_map_msgs::GridMap` (e.g. from a
+ * `SerializableGridMap`), to publish the same bytes on several topics without serializing the map again.
+ */
+class SerializedGridMap
+{
+ public:
+  /*!
+   * Constructor.
+   * @param data the serialized map (without the length prefix of the message).
+   */
+  explicit SerializedGridMap(std::shared_ptr<const std::vector<uint8_t>> data)
+      : data_(std::move(data))
+  {
+  }
+
+  //! Serialized map.
+  std::shared_ptr<const std::vector<uint8_t>> data_;
+};
+
+namespace serialization {
+
+/*!
+ * Gets the info of a grid map as it is written by `GridMapRosConverter::toMessage()`.
+ * @param gridMap the map.
+ * @return the info message.
+ */
+inline grid_map_msgs::GridMapInfo getInfoMessage(const GridMap& gridMap)
+{
+  grid_map_msgs::GridMapInfo info;
+  info.header.stamp.fromNSec(gridMap.getTimestamp());
+  info.header.frame_id = gridMap.getFrameId();
+  info.resolution = gridMap.getResolution();
+  info.length_x = gridMap.getLength().x();
+  info.length_y = gridMap.getLength().y();
+  info.pose.position.x = gridMap.getPosition().x();
+  info.pose.position.y = gridMap.getPosition().y();
+  info.pose.position.z = 0.0;
+  info.pose.orientation.w = 1.0;
+  return info;
+}
+
+/*!
+ * Gets the layout of a layer as it is written by `matrixEigenCopyToMultiArrayMessage()`.
+ * @param gridMap the map.
+ * @return the layout message.
+ */
+inline std_msgs::MultiArrayLayout getLayoutMessage(const GridMap& gridMap)
+{
+  std_msgs::MultiArrayLayout layout;
+  layout.dim.resize(nDimensions());
+  layout.dim[0].label = storageIndexNames[StorageIndices::Column];
+  layout.dim[0].size = gridMap.getSize()(1);
+  layout.dim[0].stride = gridMap.getSize().prod();
+  layout.dim[1].label = storageIndexNames[StorageIndices::Row];
+  layout.dim[1].size = gridMap.getSize()(0);
+  layout.dim[1].stride = gridMap.getSize()(0);
+  return layout;
+}
+
+/*!
+ * Writes the layers of a grid map in the wire format of `grid_map_msgs::GridMap`.
+ * @param stream the output stream.
+ * @param gridMap the map.
+ * @param layers the layers to write.
+ */
+template<typename Stream>
+void writeGridMap(Stream& stream, const GridMap& gridMap, const std::vector<std::string>& layers)
+{
+  stream.next(getInfoMessage(gridMap));
+  stream.next(layers);
+  stream.next(gridMap.getBasicLayers());
+
+  const std_msgs::MultiArrayLayout layout = getLayoutMessage(gridMap);
+  const auto numberOfCells = static_cast<uint32_t>(gridMap.getSize().prod());
+  stream.next(static_cast<uint32_t>(layers.size()));
+  for (const auto& layer : layers) {
+    stream.next(layout);
+    stream.next(numberOfCells);
+    const uint32_t numberOfBytes = numberOfCells * sizeof(float);
+    std::memcpy(stream.advance(numberOfBytes), gridMap.get(layer).data(), numberOfBytes);
+  }
+
+  stream.next(static_cast<uint16_t>(gridMap.getStartIndex()(0)));
+  stream.next(static_cast<uint16_t>(gridMap.getStartIndex()(1)));
+}
+
+/*!
+ * Gets the length of a grid map in the wire format of `grid_map_msgs::GridMap`.
+ * @param gridMap the map.
+ * @param layers the layers to write.
+ * @return the length in bytes.
+ */
+inline uint32_t getSerializedLength(const GridMap& gridMap, const std::vector<std::string>& layers)
+{
+  const auto numberOfLayers = static_cast<uint32_t>(layers.size());
+  const uint32_t layerLength = ros::serialization::serializationLength(getLayoutMessage(gridMap)) + 4 +
+                               static_cast<uint32_t>(gridMap.getSize().prod()) * sizeof(float);
+  return ros::serialization::serializationLength(getInfoMessage(gridMap)) + ros::serialization::serializationLength(layers) +
+         ros::serialization::serializationLength(gridMap.getBasicLayers()) + 4 + numberOfLayers * layerLength + 2 * sizeof(uint16_t);
+}
+
+/*!
+ * Reads a grid map from the wire format of `grid_map_msgs::GridMap`, directly into the buffers of the map.
+ * @param stream the input stream.
+ * @param gridMap the map to fill.
+ * @throw ros::Exception if the layout of a layer does not match the geometry of the map.
+ */
+template<typename Stream>
+void readGridMap(Stream& stream, GridMap& gridMap)
+{
+  grid_map_msgs::GridMapInfo info;
+  std::vector<std::string> layers;
+  std::vector<std::string> basicLayers;
+  stream.next(info);
+  stream.next(layers);
+  stream.next(basicLayers);
+
+  gridMap.setTimestamp(info.header.stamp.toNSec());
+  gridMap.setFrameId(info.header.frame_id);
+
+  // Remove the layers that are not in the message, including all sparse layers (messages only hold
+  // dense layers), keep the buffers of the others.
+  for (const auto& layer : std::vector<std::string>(gridMap.getLayers())) {
+    if (std::find(layers.begin(), layers.end(), layer) == layers.end()) {
+      gridMap.erase(layer);
+    }
+  }
+  for (const auto& layer : std::vector<std::string>(gridMap.getSparseLayers())) {
+    gridMap.erase(layer);
+  }
+
+  // All cells of the message layers are overwritten, the layers are only resized (without clearing)
+  // if the geometry changed.
+  const Length length(info.length_x, info.length_y);
+  const Position position(info.pose.position.x, info.pose.position.y);
+  const Size size(static_cast<int>(std::round(length(0) / info.resolution)), static_cast<int>(std::round(length(1) / info.resolution)));
+  if ((gridMap.getSize() != size).any() || gridMap.getResolution() != info.resolution) {
+    for (const auto& layer : std::vector<std::string>(gridMap.getLayers())) {
+      gridMap.erase(layer);
+    }
+    gridMap.setGeometry(length, info.resolution, position);
+  } else {
+    gridMap.setPosition(position);
+  }
+
+  uint32_t numberOfLayers;
+  stream.next(numberOfLayers);
+  if (numberOfLayers != layers.size()) {
+    throw ros::Exception("Different number of layers and data in grid map message.");
+  }
+  for (const auto& layer : layers) {
+    std_msgs::MultiArrayLayout layout;
+    stream.next(layout);
+    uint32_t numberOfCells;
+    stream.next(numberOfCells);
+    const uint8_t* data = stream.advance(numberOfCells * sizeof(float));
+
+    const auto expectedNumberOfCells = static_cast<uint32_t>(size.prod());
+    if (layout.dim.size() != 2 || layout.dim[0].size * layout.dim[1].size != expectedNumberOfCells ||
+        numberOfCells < expectedNumberOfCells) {
+      throw ros::Exception("Size of layer '" + layer + "' in grid map message does not match its geometry.");
+    }
+    const bool isRowMajor = layout.dim[0].label == storageIndexNames[StorageIndices::Row];
+    const auto readLayer = [&](Matrix& matrix) {
+      if (isRowMajor) {
+        // Row-major data, e.g. not written by grid_map.
+        Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rowMajor(size(0), size(1));
+        std::memcpy(rowMajor.data(), data, expectedNumberOfCells * sizeof(float));
+        matrix = rowMajor;
+      } else {
+        std::memcpy(matrix.data(), data, expectedNumberOfCells * sizeof(float));
+      }
+    };
+    if (gridMap.exists(layer)) {
+      readLayer(gridMap.get(layer));
+    } else {
+      Matrix matrix(size(0), size(1));
+      readLayer(matrix);
+      gridMap.add(layer, std::move(matrix));
+    }
+  }
+  gridMap.setBasicLayers(basicLayers);
+
+  uint16_t outerStartIndex;
+  uint16_t innerStartIndex;
+  stream.next(outerStartIndex);
+  stream.next(innerStartIndex);
+  gridMap.setStartIndex(Index(outerStartIndex, innerStartIndex));
+}
+
+} /* namespace serialization */
+} /* namespace grid_map */
+
+namespace ros {
+namespace message_traits {
+
+// The adapters are advertised and received as grid_map_msgs::GridMap.
+template<>
+struct IsMessage<grid_map::SerializableGridMap> : public TrueType {};
+
+template<>
+struct MD5Sum<grid_map::SerializableGridMap>
+{
+  static const char* value() { return MD5Sum<grid_map_msgs::GridMap>::value(); }
+  static const char* value(const grid_map::SerializableGridMap&) { return value(); }
+};
+
+template<>
+struct DataType<grid_map::SerializableGridMap>
+{
+  static const char* value() { return DataType<grid_map_msgs::GridMap>::value(); }
+  static const char* value(const grid_map::SerializableGridMap&) { return value(); }
+};
+
+template<>
+struct Definition<grid_map::SerializableGridMap>
+{
+  static const char* value() { return Definition<grid_map_msgs::GridMap>::value(); }
+  static const char* value(const grid_map::SerializableGridMap&) { return value(); }
+};
+
+template<>
+struct IsMessage<grid_map::DeserializableGridMap> : public TrueType {};
+
+template<>
+struct MD5Sum<grid_map::DeserializableGridMap>
+{
+  static const char* value() { return MD5Sum<grid_map_msgs::GridMap>::value(); }
+  static const char* value(const grid_map::DeserializableGridMap&) { return value(); }
+};
+
+template<>
+struct DataType<grid_map::DeserializableGridMap>
+{
+  static const char* value() { return DataType<grid_map_msgs::GridMap>::value(); }
+  static const char* value(const grid_map::DeserializableGridMap&) { return value(); }
+};
+
+template<>
+struct Definition<grid_map::DeserializableGridMap>
+{
+  static const char* value() { return Definition<grid_map_msgs::GridMap>::value(); }
+  static const char* value(const grid_map::DeserializableGridMap&) { return value(); }
+};
+
+
+template<>
+struct IsMessage<grid_map::SerializedGridMap> : public TrueType {};
+
+template<>
+struct MD5Sum<grid_map::SerializedGridMap>
+{
+  static const char* value() { return MD5Sum<grid_map_msgs::GridMap>::value(); }
+  static const char* value(const grid_map::SerializedGridMap&) { return value(); }
+};
+
+template<>
+struct DataType<grid_map::SerializedGridMap>
+{
+  static const char* value() { return DataType<grid_map_msgs::GridMap>::value(); }
+  static const char* value(const grid_map::SerializedGridMap&) { return value(); }
+};
+
+template<>
+struct Definition<grid_map::SerializedGridMap>
+{
+  static const char* value() { return Definition<grid_map_msgs::GridMap>::value(); }
+  static const char* value(const grid_map::SerializedGridMap&) { return value(); }
+};
+
+} /* namespace message_traits */
+
+namespace serialization {
+
+template<>
+struct Serializer<grid_map::SerializableGridMap>
+{
+  template<typename Stream>
+  inline static void write(Stream& stream, const grid_map::SerializableGridMap& t)
+  {
+    grid_map::serialization::writeGridMap(stream, t.gridMap_, t.layers_);
+  }
+
+  inline static uint32_t serializedLength(const grid_map::SerializableGridMap& t)
+  {
+    return grid_map::serialization::getSerializedLength(t.gridMap_, t.layers_);
+  }
+};
+
+template<>
+struct Serializer<grid_map::DeserializableGridMap>
+{
+  template<typename Stream>
+  inline static void write(Stream& stream, const grid_map::DeserializableGridMap& t)
+  {
+    grid_map::serialization::writeGridMap(stream, t.getGridMap(), t.getGridMap().getLayers());
+  }
+
+  template<typename Stream>
+  inline static void read(Stream& stream, grid_map::DeserializableGridMap& t)
+  {
+    grid_map::serialization::readGridMap(stream, t.getGridMap());
+  }
+
+  inline static uint32_t serializedLength(const grid_map::DeserializableGridMap& t)
+  {
+    return grid_map::serialization::getSerializedLength(t.getGridMap(), t.getGridMap().getLayers());
+  }
+};
+
+template<>
+struct Serializer<grid_map::SerializedGridMap>
+{
+  template<typename Stream>
+  inline static void write(Stream& stream, const grid_map::SerializedGridMap& t)
+  {
+    std::memcpy(stream.advance(t.data_->size()), t.data_->data(), t.data_->size());
+  }
+
+  inline static uint32_t serializedLength(const grid_map::SerializedGridMap& t)
+  {
+    return t.data_->size();
+  }
+};
+
+} /* namespace serialization */
+} /* namespace ros */
@@ -0,0 +1,245 @@
+/*
+ * GridMapServiceServer.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <grid_map_core/GridMap.hpp>
+#include <grid_map_msgs/GetGridMap.h>
+#include <grid_map_msgs/GridMap.h>
+#include "grid_map_ros/GridMapSerialization.hpp"
+
+// STL
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ROS
+#include <ros/ros.h>
+#include <ros/service_traits.h>
+
+namespace grid_map {
+
+/*!
+ * Response of the `grid_map_msgs::GetGridMap` service that is already serialized (see `SerializedGridMap`),
+ * such that cached responses are sent without copying the layers into a message first.
+ */
+class SerializedGetGridMapResponse
+{
+ public:
+  /*!
+   * Constructor.
+   */
+  SerializedGetGridMapResponse()
+      : map(std::make_shared<const std::vector<uint8_t>>())
+  {
+  }
+
+  //! Serialized map (the only field of the response).
+  SerializedGridMap map;
+};
+
+/*!
+ * Server for the `grid_map_msgs::GetGridMap` service.
+ * The map is held as an immutable snapshot that is swapped on `setMap()`, such that requests
+ * are served without blocking the writer of the map (and vice versa). The requested layers and
+ * region are copied directly from the circular buffers of the snapshot into the response (see
+ * `GridMapRosConverter::toSubmapMessage()`). The responses are cached serialized for identical
+ * requests until the map is updated (least recently used responses are evicted first), and sent
+ * as such by the service (see `SerializedGetGridMapResponse`).
+ * The server can be used with a multi-threaded spinner to handle concurrent requests.
+ */
+class GridMapServiceServer
+{
+ public:
+  /*!
+   * Constructor.
+   * @param maxCacheSize the maximum number of cached responses per map version.
+   */
+  explicit GridMapServiceServer(size_t maxCacheSize = 16);
+
+  /*!
+   * Destructor.
+   */
+  virtual ~GridMapServiceServer() = default;
+
+  /*!
+   * Advertises the service.
+   * @param nodeHandle the node handle.
+   * @param serviceName the name of the service.
+   */
+  void advertise(ros::NodeHandle& nodeHandle, const std::string& serviceName);
+
+  /*!
+   * Sets the map to serve (copied) and invalidates the cache.
+   * @param map the map.
+   */
+  void setMap(const GridMap& map);
+
+  /*!
+   * Sets the map to serve (moved) and invalidates the cache.
+   * @param map the map.
+   */
+  void setMap(GridMap&& map);
+
+  /*!
+   * Sets the map to serve and invalidates the cache. The map must not be modified afterwards.
+   * @param map the map.
+   */
+  void setMap(std::shared_ptr<const GridMap> map);
+
+  /*!
+   * Gets the version of the map, incremented on every `setMap()`.
+   * @return the version.
+   */
+  uint64_t getMapVersion() const;
+
+  /*!
+   * Gets the number of cached responses.
+   * @return the number of cached responses.
+   */
+  size_t getCacheSize() const;
+
+  /*!
+   * Gets the number of requests served from the cache.
+   * @return the number of cache hits.
+   */
+  size_t getNumberOfCacheHits() const;
+
+  /*!
+   * Computes the response to a request (as the service callback).
+   * If the frame id of the request is empty, the frame of the map is assumed.
+   * @param[in] request the request.
+   * @param[out] response the response.
+   * @return true if successful, false if no map is set, the frame does not match, a layer
+   * is missing or the submap is outside of the map.
+   */
+  bool getSubmap(const grid_map_msgs::GetGridMap::Request& request, grid_map_msgs::GetGridMap::Response& response);
+
+  /*!
+   * Computes the serialized response to a request (as the service callback), see `getSubmap()`.
+   * @param[in] request the request.
+   * @param[out] response the serialized response.
+   * @return true if successful.
+   */
+  bool getSerializedSubmap(const grid_map_msgs::GetGridMap::Request& request, SerializedGetGridMapResponse& response);
+
+ private:
+  //! Serialized map of a response.
+  using SerializedData = std::shared_ptr<const std::vector<uint8_t>>;
+
+  //! Cached responses with their request keys, most recently used first.
+  using CacheList = std::list<std::pair<std::string, SerializedData>>;
+
+  /*!
+   * ROS service callback.
+   */
+  bool serviceCallback(grid_map_msgs::GetGridMap::Request& request, SerializedGetGridMapResponse& response);
+
+  //! Service server.
+  ros::ServiceServer serviceServer_;
+
+  //! Mutex for the map snapshot, only held to swap or copy the pointer.
+  mutable std::mutex mapMutex_;
+
+  //! Current map snapshot.
+  std::shared_ptr<const GridMap> map_;
+
+  //! Version of the map snapshot.
+  uint64_t mapVersion_;
+
+  //! Mutex for the cache.
+  mutable std::mutex cacheMutex_;
+
+  //! Map version of the cached responses.
+  uint64_t cacheVersion_;
+
+  //! Cached responses, most recently used first.
+  CacheList cache_;
+
+  //! Cached responses by request key.
+  std::unordered_map<std::string, CacheList::iterator> cacheEntries_;
+
+  //! Maximum number of cached responses.
+  size_t maxCacheSize_;
+
+  //! Number of requests served from the cache.
+  size_t numberOfCacheHits_;
+};
+
+} /* namespace grid_map */
+
+namespace ros {
+namespace message_traits {
+
+// The serialized response is sent as grid_map_msgs::GetGridMap::Response.
+template<>
+struct IsMessage<grid_map::SerializedGetGridMapResponse> : public TrueType {};
+
+template<>
+struct MD5Sum<grid_map::SerializedGetGridMapResponse>
+{
+  static const char* value() { return MD5Sum<grid_map_msgs::GetGridMap::Response>::value(); }
+  static const char* value(const grid_map::SerializedGetGridMapResponse&) { return value(); }
+};
+
+template<>
+struct DataType<grid_map::SerializedGetGridMapResponse>
+{
+  static const char* value() { return DataType<grid_map_msgs::GetGridMap::Response>::value(); }
+  static const char* value(const grid_map::SerializedGetGridMapResponse&) { return value(); }
+};
+
+template<>
+struct Definition<grid_map::SerializedGetGridMapResponse>
+{
+  static const char* value() { return Definition<grid_map_msgs::GetGridMap::Response>::value(); }
+  static const char* value(const grid_map::SerializedGetGridMapResponse&) { return value(); }
+};
+
+} /* namespace message_traits */
+
+namespace service_traits {
+
+template<>
+struct MD5Sum<grid_map::SerializedGetGridMapResponse>
+{
+  static const char* value() { return MD5Sum<grid_map_msgs::GetGridMap>::value(); }
+  static const char* value(const grid_map::SerializedGetGridMapResponse&) { return value(); }
+};
+
+template<>
+struct DataType<grid_map::SerializedGetGridMapResponse>
+{
+  static const char* value() { return DataType<grid_map_msgs::GetGridMap>::value(); }
+  static const char* value(const grid_map::SerializedGetGridMapResponse&) { return value(); }
+};
+
+} /* namespace service_traits */
+
+namespace serialization {
+
+template<>
+struct Serializer<grid_map::SerializedGetGridMapResponse>
+{
+  template<typename Stream>
+  inline static void write(Stream& stream, const grid_map::SerializedGetGridMapResponse& t)
+  {
+    stream.next(t.map);
+  }
+
+  inline static uint32_t serializedLength(const grid_map::SerializedGetGridMapResponse& t)
+  {
+    return serializationLength(t.map);
+  }
+};
+
+} /* namespace serialization */
+} /* namespace ros */
@@ -13,3 +13,6 @@
 #include <grid_map_ros/GridMapRosConverter.hpp>
 #include <grid_map_ros/PolygonRosConverter.hpp>
 #include <grid_map_ros/GridMapMsgHelpers.hpp>
+#include <grid_map_ros/GridMapServiceServer.hpp>
+#include <grid_map_ros/GridMapSerialization.hpp>
+#include <grid_map_ros/GridMapLayerSelectionPublisher.hpp>
@@ -0,0 +1,132 @@
+/*
+ * GridMapLayerSelectionPublisher.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_ros/GridMapLayerSelectionPublisher.hpp"
+#include "grid_map_ros/GridMapSerialization.hpp"
+
+// STL
+#include <algorithm>
+#include <utility>
+
+namespace grid_map {
+
+GridMapLayerSelectionPublisher::GridMapLayerSelectionPublisher(ros::NodeHandle& nodeHandle, const std::string& topic,
+                                                               const uint32_t queueSize, const bool latch)
+    : nodeHandle_(nodeHandle),
+      topic_(topic),
+      queueSize_(queueSize),
+      latch_(latch),
+      numberOfSerializations_(0)
+{
+  publisher_ = nodeHandle_.advertise<grid_map_msgs::GridMap>(topic_, queueSize_, latch_);
+}
+
+void GridMapLayerSelectionPublisher::addSelection(const std::string& name, const std::vector<std::string>& layers)
+{
+  auto selection = selections_.find(name);
+  if (selection == selections_.end()) {
+    selection = selections_.emplace(name, Selection()).first;
+    selection->second.publisher = nodeHandle_.advertise<grid_map_msgs::GridMap>(topic_ + "/" + name, queueSize_, latch_);
+    ROS_DEBUG("Added layer selection '%s' of grid map topic '%s'.", name.c_str(), topic_.c_str());
+  }
+  selection->second.layers = layers;
+}
+
+void GridMapLayerSelectionPublisher::updateSelections()
+{
+  XmlRpc::XmlRpcValue selections;
+  if (!nodeHandle_.getParamCached(topic_ + "/layer_selections", selections)) {
+    return;
+  }
+  if (selections.getType() != XmlRpc::XmlRpcValue::TypeStruct) {
+    ROS_ERROR("Parameter '%s/layer_selections' must be a dictionary of layer lists.", topic_.c_str());
+    return;
+  }
+
+  for (auto& selection : selections) {
+    if (selection.second.getType() != XmlRpc::XmlRpcValue::TypeArray) {
+      ROS_ERROR("Layer selection '%s' of grid map topic '%s' must be a list of layers.", selection.first.c_str(), topic_.c_str());
+      continue;
+    }
+    std::vector<std::string> layers;
+    for (int i = 0; i < selection.second.size(); ++i) {
+      if (selection.second[i].getType() == XmlRpc::XmlRpcValue::TypeString) {
+        layers.push_back(static_cast<std::string>(selection.second[i]));
+      }
+    }
+    addSelection(selection.first, layers);
+  }
+}
+
+void GridMapLayerSelectionPublisher::publish(const GridMap& map)
+{
+  updateSelections();
+
+  // Group the publishers by the published layers.
+  std::map<std::vector<std::string>, std::vector<ros::Publisher*>> publishersByLayers;
+  if (isPublished(publisher_)) {
+    publishersByLayers[map.getLayers()].push_back(&publisher_);
+  }
+  for (auto& selection : selections_) {
+    if (isPublished(selection.second.publisher)) {
+      publishersByLayers[getSelectedLayers(map, selection.second.layers)].push_back(&selection.second.publisher);
+    }
+  }
+
+  // Serialize each group once.
+  for (const auto& layersAndPublishers : publishersByLayers) {
+    const SerializedGridMap serializedGridMap(serialize(map, layersAndPublishers.first));
+    for (const auto& publisher : layersAndPublishers.second) {
+      publisher->publish(serializedGridMap);
+    }
+  }
+  numberOfSerializations_ = publishersByLayers.size();
+}
+
+std::vector<std::string> GridMapLayerSelectionPublisher::getSelectionNames() const
+{
+  std::vector<std::string> names;
+  for (const auto& selection : selections_) {
+    names.push_back(selection.first);
+  }
+  return names;
+}
+
+size_t GridMapLayerSelectionPublisher::getNumberOfSerializations() const
+{
+  return numberOfSerializations_;
+}
+
+std::vector<std::string> GridMapLayerSelectionPublisher::getSelectedLayers(const GridMap& map, const std::vector<std::string>& selection)
+{
+  if (selection.empty()) {
+    return map.getLayers();
+  }
+  std::vector<std::string> layers;
+  for (const auto& layer : map.getLayers()) {
+    if (std::find(selection.begin(), selection.end(), layer) != selection.end()) {
+      layers.push_back(layer);
+    }
+  }
+  return layers;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> GridMapLayerSelectionPublisher::serialize(const GridMap& map,
+                                                                                   const std::vector<std::string>& layers)
+{
+  const SerializableGridMap serializableGridMap(map, layers);
+  auto data = std::make_shared<std::vector<uint8_t>>(ros::serialization::serializationLength(serializableGridMap));
+  ros::serialization::OStream stream(data->data(), data->size());
+  ros::serialization::serialize(stream, serializableGridMap);
+  return data;
+}
+
+bool GridMapLayerSelectionPublisher::isPublished(const ros::Publisher& publisher) const
+{
+  return latch_ || publisher.getNumSubscribers() > 0;
+}
+
+} /* namespace grid_map */
@@ -18,6 +18,7 @@
 #include <rosbag/view.h>
 
 // STL
+#include <cmath>
 #include <limits>
 #include <algorithm>
 #include <vector>
@@ -114,6 +115,79 @@ void GridMapRosConverter::toMessage(const grid_map::GridMap& gridMap, const std:
   message.inner_start_index = gridMap.getStartIndex()(1);
 }
 
+bool GridMapRosConverter::toSubmapMessage(const grid_map::GridMap& gridMap, const grid_map::Position& position,
+                                          const grid_map::Length& length, const std::vector<std::string>& layers,
+                                          grid_map_msgs::GridMap& message)
+{
+  for (const auto& layer : layers) {
+    if (!gridMap.exists(layer)) {
+      ROS_ERROR("toSubmapMessage() failed because layer %s does not exist.", layer.c_str());
+      return false;
+    }
+  }
+
+  bool isSuccess;
+  const SubmapGeometry submapGeometry(gridMap, position, length, isSuccess);
+  if (!isSuccess) return false;
+  const Size& size = submapGeometry.getSize();
+  std::vector<BufferRegion> bufferRegions;
+  if (!getBufferRegionsForSubmap(bufferRegions, submapGeometry.getStartIndex(), size, gridMap.getSize(),
+                                 gridMap.getStartIndex())) {
+    return false;
+  }
+
+  message.info.header.stamp.fromNSec(gridMap.getTimestamp());
+  message.info.header.frame_id = gridMap.getFrameId();
+  message.info.resolution = gridMap.getResolution();
+  message.info.length_x = submapGeometry.getLength().x();
+  message.info.length_y = submapGeometry.getLength().y();
+  message.info.pose.position.x = submapGeometry.getPosition().x();
+  message.info.pose.position.y = submapGeometry.getPosition().y();
+  message.info.pose.position.z = 0.0;
+  message.info.pose.orientation.x = 0.0;
+  message.info.pose.orientation.y = 0.0;
+  message.info.pose.orientation.z = 0.0;
+  message.info.pose.orientation.w = 1.0;
+
+  message.layers = layers;
+  message.basic_layers = gridMap.getBasicLayers();
+
+  // Same layout as `matrixEigenCopyToMultiArrayMessage()` for a column-major matrix with start index zero.
+  message.data.resize(layers.size());
+  for (size_t i = 0; i < layers.size(); ++i) {
+    std_msgs::Float32MultiArray& dataArray = message.data[i];
+    dataArray.layout.dim.resize(nDimensions());
+    dataArray.layout.dim[0].stride = size.prod();
+    dataArray.layout.dim[0].size = size(1);
+    dataArray.layout.dim[0].label = storageIndexNames[StorageIndices::Column];
+    dataArray.layout.dim[1].stride = size(0);
+    dataArray.layout.dim[1].size = size(0);
+    dataArray.layout.dim[1].label = storageIndexNames[StorageIndices::Row];
+    dataArray.layout.data_offset = 0;
+    dataArray.data.resize(size.prod());
+
+    // Copy the contiguous column segments of each buffer region directly into the message.
+    const Matrix& data = gridMap.get(layers[i]);
+    for (const auto& bufferRegion : bufferRegions) {
+      const Index& regionStart = bufferRegion.getStartIndex();
+      const Size& regionSize = bufferRegion.getSize();
+      const BufferRegion::Quadrant quadrant = bufferRegion.getQuadrant();
+      const bool isTop = quadrant == BufferRegion::Quadrant::TopLeft || quadrant == BufferRegion::Quadrant::TopRight;
+      const bool isLeft = quadrant == BufferRegion::Quadrant::TopLeft || quadrant == BufferRegion::Quadrant::BottomLeft;
+      const Index targetStart(isTop ? 0 : size(0) - regionSize(0), isLeft ? 0 : size(1) - regionSize(1));
+      for (int column = 0; column < regionSize(1); ++column) {
+        const float* source = &data(regionStart(0), regionStart(1) + column);
+        std::copy(source, source + regionSize(0),
+                  dataArray.data.begin() + (targetStart(1) + column) * size(0) + targetStart(0));
+      }
+    }
+  }
+
+  message.outer_start_index = 0;
+  message.inner_start_index = 0;
+  return true;
+}
+
 void GridMapRosConverter::toPointCloud(const grid_map::GridMap& gridMap,
                                        const std::string& pointLayer,
                                        sensor_msgs::PointCloud2& pointCloud)
@@ -484,8 +558,11 @@ bool GridMapRosConverter::toImage(const grid_map::GridMap& gridMap, const std::s
 bool GridMapRosConverter::toCvImage(const grid_map::GridMap& gridMap, const std::string& layer,
                                     const std::string encoding, cv_bridge::CvImage& cvImage)
 {
-  const float minValue = gridMap.get(layer).minCoeffOfFinites();
-  const float maxValue = gridMap.get(layer).maxCoeffOfFinites();
+  const grid_map::Matrix& data = gridMap.get(layer);
+  const grid_map::simd::FiniteStatistics statistics = grid_map::simd::computeFiniteStatistics(data.data(), data.size());
+  // Without finite values, NAN as from minCoeffOfFinites() and maxCoeffOfFinites().
+  const float minValue = statistics.count > 0 ? statistics.min : NAN;
+  const float maxValue = statistics.count > 0 ? statistics.max : NAN;
   return toCvImage(gridMap, layer, encoding, minValue, maxValue, cvImage);
 }
 
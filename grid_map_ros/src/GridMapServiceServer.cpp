@@ -0,0 +1,175 @@
+/*
+ * GridMapServiceServer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_ros/GridMapServiceServer.hpp"
+#include "grid_map_ros/GridMapRosConverter.hpp"
+
+// STL
+#include <utility>
+
+// ROS
+#include <ros/serialization.h>
+
+namespace grid_map {
+
+namespace {
+
+//! Appends the bytes of a value to the key.
+template <typename Type>
+void appendToKey(std::string& key, const Type& value)
+{
+  key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+//! Key identifying a request (geometry compared bitwise).
+std::string getRequestKey(const grid_map_msgs::GetGridMap::Request& request, const std::vector<std::string>& layers)
+{
+  std::string key;
+  appendToKey(key, request.position_x);
+  appendToKey(key, request.position_y);
+  appendToKey(key, request.length_x);
+  appendToKey(key, request.length_y);
+  for (const auto& layer : layers) {
+    key.append(layer);
+    key.push_back('\0');
+  }
+  return key;
+}
+
+}  // namespace
+
+GridMapServiceServer::GridMapServiceServer(const size_t maxCacheSize)
+    : mapVersion_(0),
+      cacheVersion_(0),
+      maxCacheSize_(maxCacheSize),
+      numberOfCacheHits_(0)
+{
+}
+
+void GridMapServiceServer::advertise(ros::NodeHandle& nodeHandle, const std::string& serviceName)
+{
+  serviceServer_ = nodeHandle.advertiseService(serviceName, &GridMapServiceServer::serviceCallback, this);
+}
+
+void GridMapServiceServer::setMap(const GridMap& map)
+{
+  setMap(std::make_shared<const GridMap>(map));
+}
+
+void GridMapServiceServer::setMap(GridMap&& map)
+{
+  setMap(std::make_shared<const GridMap>(std::move(map)));
+}
+
+void GridMapServiceServer::setMap(std::shared_ptr<const GridMap> map)
+{
+  // The previous snapshot is released outside of the lock (or by the last request using it).
+  std::lock_guard<std::mutex> lock(mapMutex_);
+  map_.swap(map);
+  ++mapVersion_;
+}
+
+uint64_t GridMapServiceServer::getMapVersion() const
+{
+  std::lock_guard<std::mutex> lock(mapMutex_);
+  return mapVersion_;
+}
+
+size_t GridMapServiceServer::getCacheSize() const
+{
+  std::lock_guard<std::mutex> lock(cacheMutex_);
+  return cache_.size();
+}
+
+size_t GridMapServiceServer::getNumberOfCacheHits() const
+{
+  std::lock_guard<std::mutex> lock(cacheMutex_);
+  return numberOfCacheHits_;
+}
+
+bool GridMapServiceServer::getSubmap(const grid_map_msgs::GetGridMap::Request& request,
+                                     grid_map_msgs::GetGridMap::Response& response)
+{
+  SerializedGetGridMapResponse serializedResponse;
+  if (!getSerializedSubmap(request, serializedResponse)) {
+    return false;
+  }
+  const std::vector<uint8_t>& data = *serializedResponse.map.data_;
+  ros::serialization::IStream stream(const_cast<uint8_t*>(data.data()), data.size());
+  ros::serialization::deserialize(stream, response.map);
+  return true;
+}
+
+bool GridMapServiceServer::getSerializedSubmap(const grid_map_msgs::GetGridMap::Request& request,
+                                               SerializedGetGridMapResponse& response)
+{
+  std::shared_ptr<const GridMap> map;
+  uint64_t version;
+  {
+    std::lock_guard<std::mutex> lock(mapMutex_);
+    map = map_;
+    version = mapVersion_;
+  }
+  if (!map) {
+    ROS_WARN("GetGridMap request failed because no map is set.");
+    return false;
+  }
+  if (!request.frame_id.empty() && request.frame_id != map->getFrameId()) {
+    ROS_ERROR("GetGridMap request failed because the frame %s does not match the frame %s of the map.",
+              request.frame_id.c_str(), map->getFrameId().c_str());
+    return false;
+  }
+
+  const std::vector<std::string>& layers = request.layers.empty() ? map->getLayers() : request.layers;
+  const std::string key = getRequestKey(request, layers);
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (cacheVersion_ == version) {
+      const auto entry = cacheEntries_.find(key);
+      if (entry != cacheEntries_.end()) {
+        // Mark as most recently used.
+        cache_.splice(cache_.begin(), cache_, entry->second);
+        response.map.data_ = entry->second->second;
+        ++numberOfCacheHits_;
+        return true;
+      }
+    }
+  }
+
+  grid_map_msgs::GridMap message;
+  if (!GridMapRosConverter::toSubmapMessage(*map, Position(request.position_x, request.position_y),
+                                            Length(request.length_x, request.length_y), layers, message)) {
+    return false;
+  }
+  auto data = std::make_shared<std::vector<uint8_t>>(ros::serialization::serializationLength(message));
+  ros::serialization::OStream stream(data->data(), data->size());
+  ros::serialization::serialize(stream, message);
+  response.map.data_ = data;
+
+  std::lock_guard<std::mutex> lock(cacheMutex_);
+  if (cacheVersion_ < version) {
+    cache_.clear();
+    cacheEntries_.clear();
+    cacheVersion_ = version;
+  }
+  if (cacheVersion_ == version && maxCacheSize_ > 0 && cacheEntries_.count(key) == 0) {
+    if (cache_.size() >= maxCacheSize_) {
+      // Evict the least recently used response.
+      cacheEntries_.erase(cache_.back().first);
+      cache_.pop_back();
+    }
+    cache_.emplace_front(key, std::move(data));
+    cacheEntries_[key] = cache_.begin();
+  }
+  return true;
+}
+
+bool GridMapServiceServer::serviceCallback(grid_map_msgs::GetGridMap::Request& request, SerializedGetGridMapResponse& response)
+{
+  return getSerializedSubmap(request, response);
+}
+
+} /* namespace grid_map */
@@ -0,0 +1,53 @@
+/*
+ * GridMapLayerSelectionPublisherTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_ros/GridMapLayerSelectionPublisher.hpp"
+#include "grid_map_ros/GridMapRosConverter.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STD
+#include <string>
+#include <vector>
+
+using namespace grid_map;
+
+TEST(GridMapLayerSelectionPublisher, SelectedLayers)
+{
+  GridMap map({"elevation", "color", "traversability"});
+  map.setGeometry(Length(1.0, 1.0), 0.5);
+
+  EXPECT_EQ(map.getLayers(), GridMapLayerSelectionPublisher::getSelectedLayers(map, {}));
+
+  // In the order of the map, missing layers are skipped.
+  const std::vector<std::string> expectedLayers{"elevation", "traversability"};
+  EXPECT_EQ(expectedLayers, GridMapLayerSelectionPublisher::getSelectedLayers(map, {"traversability", "missing", "elevation"}));
+  EXPECT_TRUE(GridMapLayerSelectionPublisher::getSelectedLayers(map, {"missing"}).empty());
+}
+
+TEST(GridMapLayerSelectionPublisher, SerializeSameAsMessage)
+{
+  GridMap map({"elevation", "color", "traversability"});
+  map.setFrameId("map");
+  map.setGeometry(Length(2.0, 1.5), 0.1, Position(0.5, -0.5));
+  map.move(Position(0.73, -0.21));  // Non-default start index.
+  map["elevation"].setRandom();
+  map["color"].setRandom();
+  map["traversability"].setRandom();
+  const std::vector<std::string> layers{"elevation", "traversability"};
+
+  grid_map_msgs::GridMap message;
+  GridMapRosConverter::toMessage(map, layers, message);
+  std::vector<uint8_t> messageData(ros::serialization::serializationLength(message));
+  ros::serialization::OStream stream(messageData.data(), messageData.size());
+  ros::serialization::serialize(stream, message);
+
+  const auto data = GridMapLayerSelectionPublisher::serialize(map, layers);
+  ASSERT_TRUE(data != nullptr);
+  EXPECT_EQ(messageData, *data);
+}
@@ -10,6 +10,7 @@
 #include "grid_map_core/iterators/GridMapIterator.hpp"
 #include "grid_map_core/gtest_eigen.hpp"
 #include "grid_map_ros/GridMapRosConverter.hpp"
+#include "grid_map_ros/GridMapSerialization.hpp"
 #include "grid_map_msgs/GridMap.h"
 
 // gtest
@@ -55,6 +56,80 @@ TEST(RosMessageConversion, roundTrip)
   EXPECT_TRUE((mapIn.getSize() == mapOut.getSize()).all());
 }
 
+TEST(RosMessageSerialization, sameAsMessage)
+{
+  GridMap mapIn({"layer", "other_layer"});
+  mapIn.setGeometry(Length(2.0, 3.0), 0.5, Position(1.0, 1.5));
+  mapIn.setFrameId("map");
+  mapIn.setTimestamp(1234567890123);
+  mapIn.setBasicLayers({"layer"});
+  mapIn["layer"].setRandom();
+  mapIn["other_layer"].setRandom();
+  mapIn.move(Position(1.5, 0.5));
+  ASSERT_FALSE((mapIn.getStartIndex() == 0).all());
+
+  // Serialize through a message and directly.
+  grid_map_msgs::GridMap message;
+  GridMapRosConverter::toMessage(mapIn, {"other_layer"}, message);
+  std::vector<uint8_t> messageBuffer(ros::serialization::serializationLength(message));
+  ros::serialization::OStream messageStream(messageBuffer.data(), messageBuffer.size());
+  ros::serialization::serialize(messageStream, message);
+
+  const SerializableGridMap serializableGridMap(mapIn, {"other_layer"});
+  std::vector<uint8_t> buffer(ros::serialization::serializationLength(serializableGridMap));
+  ros::serialization::OStream stream(buffer.data(), buffer.size());
+  ros::serialization::serialize(stream, serializableGridMap);
+
+  EXPECT_EQ(0u, stream.getLength());
+  EXPECT_EQ(messageBuffer, buffer);
+}
+
+TEST(RosMessageSerialization, roundTripInPlace)
+{
+  GridMap mapIn({"layer", "other_layer"});
+  mapIn.setGeometry(Length(2.0, 3.0), 0.5, Position(1.0, 1.5));
+  mapIn.setFrameId("map");
+  mapIn["layer"].setRandom();
+  mapIn["other_layer"].setRandom();
+  mapIn.move(Position(1.5, 0.5));
+
+  std::vector<uint8_t> buffer(ros::serialization::serializationLength(SerializableGridMap(mapIn)));
+  ros::serialization::OStream stream(buffer.data(), buffer.size());
+  ros::serialization::serialize(stream, SerializableGridMap(mapIn));
+
+  // Deserialize into a map with different geometry and layers.
+  GridMap mapOut({"other_layer", "removed_layer"});
+  mapOut.setGeometry(Length(1.0, 1.0), 0.1);
+  mapOut.addSparse("layer");  // Replaced by the dense layer of the message.
+  mapOut.addSparse("sparse_layer");  // Removed, as it is not in the message.
+  DeserializableGridMap deserializableGridMap(mapOut);
+  ros::serialization::IStream inputStream(buffer.data(), buffer.size());
+  ros::serialization::deserialize(inputStream, deserializableGridMap);
+
+  EXPECT_EQ(0u, inputStream.getLength());
+  EXPECT_EQ(mapIn.getLayers().size(), mapOut.getLayers().size());
+  EXPECT_FALSE(mapOut.exists("removed_layer"));
+  EXPECT_EQ(mapIn.getFrameId(), mapOut.getFrameId());
+  EXPECT_TRUE((mapIn.getLength() == mapOut.getLength()).all());
+  EXPECT_TRUE((mapIn.getPosition().array() == mapOut.getPosition().array()).all());
+  EXPECT_TRUE((mapIn.getStartIndex() == mapOut.getStartIndex()).all());
+  for (const auto& layer : mapIn.getLayers()) {
+    ASSERT_TRUE(mapOut.exists(layer));
+    EXPECT_TRUE((mapIn[layer].array() == mapOut[layer].array()).all());
+  }
+  EXPECT_FALSE(mapOut.isSparse("layer"));
+  EXPECT_FALSE(mapOut.exists("sparse_layer"));
+
+  // Deserialize again with the same geometry, the layer buffers are reused.
+  const float* layerData = mapOut["layer"].data();
+  mapOut["layer"].setZero();
+  ros::serialization::IStream secondInputStream(buffer.data(), buffer.size());
+  ros::serialization::deserialize(secondInputStream, deserializableGridMap);
+  EXPECT_EQ(layerData, mapOut["layer"].data());
+  EXPECT_TRUE((mapIn["layer"].array() == mapOut["layer"].array()).all());
+  EXPECT_TRUE((mapIn.getStartIndex() == mapOut.getStartIndex()).all());
+}
+
 TEST(RosbagHandling, saveLoad)
 {
   string layer = "layer";
@@ -0,0 +1,142 @@
+/*
+ * GridMapServiceServerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_core/GridMap.hpp"
+#include "grid_map_ros/GridMapRosConverter.hpp"
+#include "grid_map_ros/GridMapServiceServer.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STD
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+GridMap createMap()
+{
+  GridMap map({"a", "b", "c"});
+  map.setFrameId("map");
+  map.setGeometry(Length(5.0, 4.0), 0.1, Position(1.0, 2.0));
+  map.move(Position(1.73, 1.21));  // Non-default start index.
+  map["a"].setRandom();
+  map["b"].setRandom();
+  map["c"].setRandom();
+  return map;
+}
+
+grid_map_msgs::GetGridMap::Request createRequest(const std::vector<std::string>& layers)
+{
+  grid_map_msgs::GetGridMap::Request request;
+  request.frame_id = "map";
+  request.position_x = 3.5;  // Across the buffer boundary.
+  request.position_y = 2.7;
+  request.length_x = 1.4;
+  request.length_y = 2.2;
+  request.layers = layers;
+  return request;
+}
+
+}  // namespace
+
+TEST(GridMapServiceServer, SubmapMessageSameAsGetSubmap)
+{
+  const GridMap map = createMap();
+  const std::vector<std::string> layers{"c", "a"};
+  const Position position(3.5, 2.7);
+  const Length length(1.4, 2.2);
+
+  bool isSuccess;
+  const GridMap submap = map.getSubmap(position, length, isSuccess);
+  ASSERT_TRUE(isSuccess);
+  grid_map_msgs::GridMap expected;
+  GridMapRosConverter::toMessage(submap, layers, expected);
+
+  grid_map_msgs::GridMap message;
+  ASSERT_TRUE(GridMapRosConverter::toSubmapMessage(map, position, length, layers, message));
+  EXPECT_EQ(expected, message);
+
+  EXPECT_FALSE(GridMapRosConverter::toSubmapMessage(map, position, length, {"d"}, message));
+  EXPECT_FALSE(GridMapRosConverter::toSubmapMessage(map, Position(20.0, 0.0), length, layers, message));
+}
+
+TEST(GridMapServiceServer, Cache)
+{
+  GridMapServiceServer server;
+  grid_map_msgs::GetGridMap::Response response;
+  EXPECT_FALSE(server.getSubmap(createRequest({}), response));
+
+  GridMap map = createMap();
+  server.setMap(map);
+  ASSERT_TRUE(server.getSubmap(createRequest({"b"}), response));
+  EXPECT_EQ(1u, server.getCacheSize());
+  const grid_map_msgs::GridMap first = response.map;
+  ASSERT_TRUE(server.getSubmap(createRequest({"b"}), response));
+  EXPECT_EQ(first, response.map);
+  EXPECT_EQ(1u, server.getCacheSize());
+  ASSERT_TRUE(server.getSubmap(createRequest({}), response));
+  EXPECT_EQ(3u, response.map.layers.size());
+  EXPECT_EQ(2u, server.getCacheSize());
+
+  // A new map version invalidates the cache.
+  map["b"].setConstant(1.0);
+  server.setMap(std::move(map));
+  EXPECT_EQ(2u, server.getMapVersion());
+  ASSERT_TRUE(server.getSubmap(createRequest({"b"}), response));
+  EXPECT_EQ(1u, server.getCacheSize());
+  for (const float value : response.map.data[0].data) {
+    EXPECT_EQ(1.0, value);
+  }
+
+  grid_map_msgs::GetGridMap::Request request = createRequest({"b"});
+  request.frame_id = "odom";
+  EXPECT_FALSE(server.getSubmap(request, response));
+}
+
+TEST(GridMapServiceServer, SerializedResponse)
+{
+  GridMapServiceServer server;
+  server.setMap(createMap());
+  grid_map_msgs::GetGridMap::Response response;
+  ASSERT_TRUE(server.getSubmap(createRequest({"a", "c"}), response));
+
+  // The same bytes as the serialized message, also when served from the cache.
+  std::vector<uint8_t> expected(ros::serialization::serializationLength(response));
+  ros::serialization::OStream stream(expected.data(), expected.size());
+  ros::serialization::serialize(stream, response);
+  for (int i = 0; i < 2; ++i) {
+    SerializedGetGridMapResponse serializedResponse;
+    ASSERT_TRUE(server.getSerializedSubmap(createRequest({"a", "c"}), serializedResponse));
+    ASSERT_EQ(expected.size(), ros::serialization::serializationLength(serializedResponse));
+    std::vector<uint8_t> data(expected.size());
+    ros::serialization::OStream dataStream(data.data(), data.size());
+    ros::serialization::serialize(dataStream, serializedResponse);
+    EXPECT_EQ(expected, data);
+  }
+  EXPECT_EQ(2u, server.getNumberOfCacheHits());
+}
+
+TEST(GridMapServiceServer, LeastRecentlyUsedEviction)
+{
+  GridMapServiceServer server(2);
+  server.setMap(createMap());
+  grid_map_msgs::GetGridMap::Response response;
+  ASSERT_TRUE(server.getSubmap(createRequest({"a"}), response));
+  ASSERT_TRUE(server.getSubmap(createRequest({"b"}), response));
+  ASSERT_TRUE(server.getSubmap(createRequest({"a"}), response));  // Hit, "a" is the most recently used.
+  EXPECT_EQ(1u, server.getNumberOfCacheHits());
+  ASSERT_TRUE(server.getSubmap(createRequest({"c"}), response));  // Evicts "b".
+  EXPECT_EQ(2u, server.getCacheSize());
+
+  ASSERT_TRUE(server.getSubmap(createRequest({"a"}), response));
+  EXPECT_EQ(2u, server.getNumberOfCacheHits());
+  ASSERT_TRUE(server.getSubmap(createRequest({"b"}), response));
+  EXPECT_EQ(2u, server.getNumberOfCacheHits());
+}
@@ -0,0 +1,157 @@
+/*
+ * DynamicDistanceMap.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <functional>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <grid_map_core/BufferRegion.hpp>
+#include <grid_map_core/GridMap.hpp>
+#include <grid_map_core/TypeDefs.hpp>
+
+namespace grid_map {
+
+/**
+ * 2D signed distance map of an occupancy layer that is updated incrementally when cells change, based on the dynamic brushfire
+ * algorithm of Lau et al. ("Efficient grid-based spatial representations for robot navigation in dynamic environments", RAS 2013).
+ *
+ * Each cell stores its nearest obstacle (and, for the negative part of the signed distance, its nearest free cell). Newly occupied
+ * cells start a lower wave, freed cells a raise wave that invalidates the cells that referred to them, such that only the cells
+ * affected by a change are updated. The distances are the same as the ones of signedDistanceFromOccupancy (distance from the cell
+ * center to the border of the closest obstacle cell), up to rare cells where the propagation over the 8-neighborhood does not find
+ * the exact closest obstacle.
+ *
+ * The cells are stored in the circular buffer layout of the grid map, and the nearest obstacles in map-independent cell coordinates,
+ * such that the distance map can follow GridMap::move() without recomputing the cells that stay in the map.
+ */
+class DynamicDistanceMap {
+ public:
+  /** Default constructor: creates an empty distance map. */
+  DynamicDistanceMap() = default;
+
+  /**
+   * Create the distance map for an occupancy layer in the grid map.
+   * @param gridMap : map with the occupancy layer.
+   * @param occupancyLayer : name of the occupancy layer, cells with a value above the threshold are occupied (NAN is free).
+   * @param occupancyThreshold : threshold of the occupied cells.
+   */
+  DynamicDistanceMap(const GridMap& gridMap, const std::string& occupancyLayer, float occupancyThreshold = 0.5F);
+
+  /**
+   * (Re-)computes the distance map from the occupancy layer of the grid map.
+   * @param gridMap : map with the occupancy layer.
+   * @param occupancyLayer : name of the occupancy layer, cells with a value above the threshold are occupied (NAN is free).
+   * @param occupancyThreshold : threshold of the occupied cells.
+   */
+  void initialize(const GridMap& gridMap, const std::string& occupancyLayer, float occupancyThreshold = 0.5F);
+
+  /**
+   * Updates the distance map for changed cells. Cells that are already in the given state are ignored.
+   * @param occupiedCells : (buffer) indices of the newly occupied cells.
+   * @param freedCells : (buffer) indices of the newly freed cells.
+   */
+  void update(const std::vector<Index>& occupiedCells, const std::vector<Index>& freedCells);
+
+  /**
+   * Follows a move of the grid map. Obstacles that left the map are removed, and the new cells are read from the occupancy layer.
+   * @param gridMap : map after the move (same size and resolution as on initialization).
+   * @param newRegions : the new regions returned by GridMap::move().
+   */
+  void move(const GridMap& gridMap, const std::vector<BufferRegion>& newRegions);
+
+  /**
+   * Checks if a cell is occupied.
+   * @param index : (buffer) index of the cell.
+   * @return true if occupied.
+   */
+  bool isOccupied(const Index& index) const;
+
+  /**
+   * Gets the signed distance of a cell: positive in free space, negative in obstacles,
+   * +INF if there are no obstacles and -INF if there are only obstacles.
+   * @param index : (buffer) index of the cell.
+   * @return signed distance [m].
+   */
+  float getSignedDistance(const Index& index) const;
+
+  /**
+   * Gets the closest obstacle of a cell.
+   * @param index [in] : (buffer) index of the cell.
+   * @param obstacleIndex [out] : (buffer) index of the closest obstacle cell.
+   * @return false if there are no obstacles.
+   */
+  bool getNearestObstacle(const Index& index, Index& obstacleIndex) const;
+
+  /**
+   * Writes the signed distance of all cells to a layer of the grid map (added if it does not exist).
+   * @param gridMap : map with the same geometry as the distance map.
+   * @param layer : name of the layer.
+   */
+  void toLayer(GridMap& gridMap, const std::string& layer) const;
+
+  /** Size of the distance map */
+  const Size& getSize() const noexcept { return size_; }
+
+ private:
+  //! Cell of the brushfire propagation, with the nearest site in map-independent cell coordinates.
+  struct Cell {
+    int siteX;
+    int siteY;
+    int squareDistance;  // In units of (half cells)^2, exact integers.
+    bool raise;
+  };
+
+  using QueueEntry = std::pair<int, size_t>;
+  using Queue = std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>>;
+
+  //! Distances to the sites, either the occupied cells or the free cells.
+  struct DistanceLayer {
+    std::vector<Cell> cells;
+    Queue queue;
+    bool sitesAreOccupied;
+  };
+
+  bool isSite(const DistanceLayer& layer, int siteX, int siteY) const;
+  void setSite(DistanceLayer& layer, size_t linearIndex);
+  void removeSite(DistanceLayer& layer, size_t linearIndex);
+  void propagate(DistanceLayer& layer);
+  void updateGeometry(const GridMap& gridMap, bool resetCellCoordinates);
+  float getDistance(const Cell& cell) const;
+  Index getUnwrappedIndex(size_t linearIndex) const;
+  size_t getLinearIndex(const Index& unwrappedIndex) const;
+
+  //! Size of the map.
+  Size size_{Size::Zero()};
+
+  //! Start index of the circular buffer.
+  Index startIndex_{Index::Zero()};
+
+  //! Position of the first cell on initialization, origin of the cell coordinates.
+  Position referencePosition_{Position::Zero()};
+
+  //! Cell coordinates of the unwrapped index (0, 0).
+  Index cellOffset_{Index::Zero()};
+
+  //! Resolution of the map.
+  float resolution_{1.0F};
+
+  //! Occupancy layer and threshold.
+  std::string occupancyLayer_;
+  float occupancyThreshold_{0.5F};
+
+  //! Occupancy per cell (in buffer order).
+  std::vector<bool> occupied_;
+
+  //! Distances to the obstacles and to the free space.
+  DistanceLayer obstacleDistance_;
+  DistanceLayer freeSpaceDistance_;
+};
+
+}  // namespace grid_map
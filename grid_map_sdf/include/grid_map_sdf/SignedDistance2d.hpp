@@ -17,6 +17,16 @@
 namespace grid_map {
 namespace signed_distance_field {
 
+/**
+ * 1D distance transform of a line, in place: each element i becomes the minimum over j of squarePixelBorderDistance(i, j, input[j]).
+ * Applying it along each dimension in turn gives the distance transform in any number of dimensions.
+ * Thread safe, the work memory is kept per thread.
+ *
+ * @param squareDistance1d : [in/out] input squared distance of each element (0.0 for sites, INF elsewhere), output (squared) distance.
+ * @param takeSqrt : take the square root of the result, for the last dimension.
+ */
+void distanceTransform1d(Eigen::Ref<Eigen::VectorXf> squareDistance1d, bool takeSqrt);
+
 /**
  * Computes the signed distance field at a specified height for a given elevation map.
  *
@@ -55,5 +65,19 @@ void signedDistanceAtHeightTranspose(const Matrix& elevationMap, Matrix& sdfTran
  */
 Matrix signedDistanceFromOccupancy(const Eigen::Matrix<bool, -1, -1>& occupancyGrid, float resolution);
 
+/**
+ * Same as above, but also computes the feature transform: for each cell the index of the closest cell across the occupancy border,
+ * i.e. the closest obstacle for free cells and the closest free cell for obstacles. The indices are -1 if there is no border.
+ * Computed in the same passes as the distance.
+ *
+ * @param occupancyGrid : occupancy grid with true = obstacle, false = free space
+ * @param resolution : resolution of the grid.
+ * @param nearestRow : [output] row index of the closest cell across the border.
+ * @param nearestCol : [output] column index of the closest cell across the border.
+ * @return signed distance for each point in the grid to the occupancy border.
+ */
+Matrix signedDistanceFromOccupancy(const Eigen::Matrix<bool, -1, -1>& occupancyGrid, float resolution, Eigen::MatrixXi& nearestRow,
+                                  Eigen::MatrixXi& nearestCol);
+
 }  // namespace signed_distance_field
 }  // namespace grid_map
\ No newline at end of file
@@ -0,0 +1,35 @@
+/*
+ * SignedDistance3d.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <grid_map_core/TypeDefs.hpp>
+
+#include "Gridmap3dLookup.hpp"
+#include "Utils.hpp"
+
+namespace grid_map {
+namespace signed_distance_field {
+
+/**
+ * Gets the 3D signed distance from a voxel occupancy grid.
+ * The transform is separable: the 1D transform of SignedDistance2d is applied along x, then y, then z. The lines of each pass are processed
+ * in parallel. The distance is exact, measured from the voxel center to the border of the closest voxel across the occupancy border.
+ * Returns +INF if there are no obstacles, and -INF if there are only obstacles.
+ *
+ * @param occupancy : occupancy per voxel in the linear layout of Gridmap3dLookup, true = obstacle.
+ * @param gridsize : size of the voxel grid.
+ * @param resolution : size of a voxel.
+ * @param numberOfThreads : maximum number of threads, 0 for the number of hardware threads.
+ * @return signed distance per voxel in the linear layout of Gridmap3dLookup.
+ */
+std::vector<float> signedDistanceFromOccupancy3d(const std::vector<bool>& occupancy, const Gridmap3dLookup::size_t_3d& gridsize,
+                                                 float resolution, unsigned int numberOfThreads = 0);
+
+}  // namespace signed_distance_field
+}  // namespace grid_map
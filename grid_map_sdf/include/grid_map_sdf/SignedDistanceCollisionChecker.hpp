@@ -0,0 +1,134 @@
+/*
+ * SignedDistanceCollisionChecker.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <grid_map_core/TypeDefs.hpp>
+
+#include "SignedDistanceField.hpp"
+
+namespace grid_map {
+
+/**
+ * Collision checking of robot bodies (spheres and capsules) against a SignedDistanceField, for many configurations at once.
+ *
+ * On construction, the field is summarized in a coarse grid of blocks of nodes, storing the minimum distance and the maximum gradient
+ * norm per block. They give a lower bound of SignedDistanceField::value for all positions whose nearest node lies in the block, such that
+ * bodies far from any obstacle are cleared without fine lookups. The bodies of a configuration are evaluated in the order of their
+ * lower bounds, and the evaluation stops as soon as no remaining body can be closer than the closest one found (or, with early exit, at
+ * the first collision). Configurations are evaluated in parallel.
+ *
+ * The field has to outlive the checker.
+ */
+class SignedDistanceCollisionChecker {
+ public:
+  using Derivative3 = SignedDistanceField::Derivative3;
+
+  /** Sphere in the frame of the field. */
+  struct Sphere {
+    Position3 center;
+    double radius;
+  };
+
+  /** Capsule (segment with a radius) in the frame of the field. */
+  struct Capsule {
+    Position3 start;
+    Position3 end;
+    double radius;
+  };
+
+  /** Bodies of one robot configuration, in the frame of the field. */
+  struct Configuration {
+    std::vector<Sphere> spheres;
+    std::vector<Capsule> capsules;
+  };
+
+  /** Result of checking a configuration. */
+  struct Result {
+    //! True if a body is closer to the obstacles than the safety margin.
+    bool isInCollision{false};
+
+    //! Clearance of the reported body: signed distance minus radius, negative values are penetration depths.
+    double clearance{std::numeric_limits<double>::infinity()};
+
+    //! Point on the axis of the reported body where the clearance is attained.
+    Position3 closestPoint{Position3::Zero()};
+
+    //! Gradient of the signed distance at the closest point, the direction to move the body out of collision.
+    Derivative3 gradient{Derivative3::Zero()};
+
+    //! Index of the reported body: spheres first, then capsules. -1 if the configuration has no bodies.
+    int bodyIndex{-1};
+  };
+
+  /**
+   * Constructor.
+   * @param signedDistanceField : field to check against.
+   * @param blockSize : number of nodes per dimension of the blocks of the coarse grid.
+   */
+  explicit SignedDistanceCollisionChecker(const SignedDistanceField& signedDistanceField, size_t blockSize = 8);
+
+  /**
+   * Checks one configuration.
+   * @param configuration : bodies of the configuration.
+   * @param earlyExit : stop at the first body in collision and report it. Otherwise, the body with the smallest clearance is reported.
+   * @param safetyMargin : bodies with a clearance below the margin are in collision.
+   * @return result for the configuration.
+   */
+  Result check(const Configuration& configuration, bool earlyExit = true, double safetyMargin = 0.0) const;
+
+  /**
+   * Checks several configurations in parallel.
+   * @param configurations : bodies of the configurations.
+   * @param earlyExit : stop at the first body in collision and report it. Otherwise, the body with the smallest clearance is reported.
+   * @param safetyMargin : bodies with a clearance below the margin are in collision.
+   * @param numberOfThreads : maximum number of threads, 0 for the number of hardware threads.
+   * @return results, one per configuration.
+   */
+  std::vector<Result> check(const std::vector<Configuration>& configurations, bool earlyExit = true, double safetyMargin = 0.0,
+                            unsigned int numberOfThreads = 0) const;
+
+ private:
+  //! Bounds of the nodes of a block.
+  struct BlockBounds {
+    float minDistance;
+    float maxGradientNorm;
+  };
+
+  /**
+   * Lower bound of SignedDistanceField::value over an axis aligned box.
+   * @param lower : lower corner of the box.
+   * @param upper : upper corner of the box.
+   */
+  double lowerBound(const Position3& lower, const Position3& upper) const;
+
+  /**
+   * Evaluates the clearance of a body with fine lookups.
+   * @param configuration : bodies of the configuration.
+   * @param bodyIndex : index of the body (spheres first, then capsules).
+   * @param result [out] : clearance, closest point and gradient are written.
+   */
+  void evaluateBody(const Configuration& configuration, size_t bodyIndex, Result& result) const;
+
+  //! Field to check against.
+  const SignedDistanceField& signedDistanceField_;
+
+  //! Number of nodes per dimension of a block.
+  size_t blockSize_;
+
+  //! Number of blocks per dimension.
+  signed_distance_field::Gridmap3dLookup::size_t_3d numberOfBlocks_;
+
+  //! Bounds per block, in the linear layout (x fastest, then y, then z).
+  std::vector<BlockBounds> blockBounds_;
+};
+
+}  // namespace grid_map
@@ -46,6 +46,30 @@ class SignedDistanceField {
    */
   SignedDistanceField(const GridMap& gridMap, const std::string& elevationLayer, double minHeight, double maxHeight);
 
+  /**
+   * Create a signed distance field and its derivative for a 3D voxel occupancy grid, e.g. the voxels of an octomap in a bounding box.
+   * Unlike the elevation based field, this supports overhangs. The distance is exact, see signedDistanceFromOccupancy3d.
+   * If there are no obstacles (only obstacles), the distance is +INF (-INF) and the derivative zero.
+   *
+   * @param grid : geometry of the 3D grid.
+   * @param occupancy : occupancy per voxel in the linear layout of the grid, true = obstacle.
+   * @param frameId : frame of the grid.
+   * @param timestamp : time of the occupancy data (nanoseconds).
+   */
+  SignedDistanceField(const signed_distance_field::Gridmap3dLookup& grid, const std::vector<bool>& occupancy, const std::string& frameId,
+                      Time timestamp = 0);
+
+  /**
+   * Same as above, for sparse occupancy: the voxels containing the occupied points are obstacles, points outside the grid are ignored.
+   *
+   * @param grid : geometry of the 3D grid.
+   * @param occupiedPoints : positions of the occupied points, e.g. the centers of the occupied octomap leaves or a point cloud.
+   * @param frameId : frame of the grid.
+   * @param timestamp : time of the occupancy data (nanoseconds).
+   */
+  SignedDistanceField(const signed_distance_field::Gridmap3dLookup& grid, const std::vector<Position3>& occupiedPoints,
+                      const std::string& frameId, Time timestamp = 0);
+
   /**
    * Get the signed distance value at a 3D position.
    * @param position : 3D position in the frame of the gridmap.
@@ -73,6 +97,9 @@ class SignedDistanceField {
 
   Time getTime() const noexcept;
 
+  /** Geometry of the 3D grid */
+  const signed_distance_field::Gridmap3dLookup& getGridLookup() const noexcept { return gridmap3DLookup_; }
+
   /**
    * Calls a function on each point in the signed distance field. The points are processed in the order they are stored in memory.
    * @param func : function taking the node position, signed distance value, and signed distance derivative.
@@ -87,6 +114,12 @@ class SignedDistanceField {
    */
   void computeSignedDistance(const Matrix& elevation);
 
+  /**
+   * Implementation of the signed distance field computation from voxel occupancy.
+   * @param occupancy : occupancy per voxel in the linear layout of gridmap3DLookup_.
+   */
+  void computeSignedDistance(const std::vector<bool>& occupancy);
+
   /**
    * Simultaneously compute the signed distance and derivative in x direction at a given height
    * @param elevation [in] : elevation data
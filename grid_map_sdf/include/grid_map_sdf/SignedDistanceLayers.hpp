@@ -0,0 +1,45 @@
+/*
+ * SignedDistanceLayers.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <string>
+
+#include <grid_map_core/GridMap.hpp>
+#include <grid_map_core/TypeDefs.hpp>
+
+namespace grid_map {
+namespace signed_distance_field {
+
+/**
+ * Computes the 2D signed distance of an occupancy layer and stores it as layers of the grid map:
+ *  - distanceLayer : signed distance [m] (+INF if there are no obstacles, -INF if there are only obstacles),
+ *  - distanceLayer + "_nearest_x", distanceLayer + "_nearest_y" : position of the closest cell across the occupancy border, i.e. the
+ *    closest obstacle for free cells and the closest free cell for obstacles (NAN if there is no border).
+ * The nearest positions are in the map frame, such that they stay valid when the map is moved.
+ *
+ * @param gridMap : map with the occupancy layer, the layers are added if they do not exist.
+ * @param occupancyLayer : name of the occupancy layer, cells with a value above the threshold are occupied (NAN is free).
+ * @param occupancyThreshold : threshold of the occupied cells.
+ * @param distanceLayer : name of the signed distance layer.
+ */
+void addSignedDistanceLayers(GridMap& gridMap, const std::string& occupancyLayer, float occupancyThreshold,
+                             const std::string& distanceLayer = "signed_distance");
+
+/**
+ * Gets the position of the closest cell across the occupancy border from the layers written by addSignedDistanceLayers.
+ *
+ * @param gridMap : map with the signed distance layers.
+ * @param distanceLayer : name of the signed distance layer.
+ * @param position : query position.
+ * @param nearestPosition : [output] position of the closest obstacle (or closest free cell if the query is inside an obstacle).
+ * @return false if the position is outside the map or there is no occupancy border.
+ */
+bool getNearestBorderPosition(const GridMap& gridMap, const std::string& distanceLayer, const Position& position,
+                              Position& nearestPosition);
+
+}  // namespace signed_distance_field
+}  // namespace grid_map
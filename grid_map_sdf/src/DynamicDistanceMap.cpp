@@ -0,0 +1,287 @@
+/*
+ * DynamicDistanceMap.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_sdf/DynamicDistanceMap.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+#include <grid_map_core/GridMapMath.hpp>
+
+#include "grid_map_sdf/Utils.hpp"
+
+namespace grid_map {
+
+namespace {
+constexpr int INVALID_SITE = std::numeric_limits<int>::min();
+constexpr int INF_SQUARE_DISTANCE = std::numeric_limits<int>::max();
+
+/**
+ * Squared distance from a cell center to the border of the site cell, in units of (half cells)^2.
+ * Same metric as signed_distance_field::pixelBorderDistance, but exact in integers.
+ */
+inline int squareBorderDistance(int dx, int dy) {
+  const int a = std::max(2 * std::abs(dx) - 1, 0);
+  const int b = std::max(2 * std::abs(dy) - 1, 0);
+  return a * a + b * b;
+}
+}  // namespace
+
+DynamicDistanceMap::DynamicDistanceMap(const GridMap& gridMap, const std::string& occupancyLayer, float occupancyThreshold) {
+  initialize(gridMap, occupancyLayer, occupancyThreshold);
+}
+
+void DynamicDistanceMap::initialize(const GridMap& gridMap, const std::string& occupancyLayer, float occupancyThreshold) {
+  size_ = gridMap.getSize();
+  resolution_ = static_cast<float>(gridMap.getResolution());
+  occupancyLayer_ = occupancyLayer;
+  occupancyThreshold_ = occupancyThreshold;
+  updateGeometry(gridMap, true);
+
+  const Matrix& data = gridMap.get(occupancyLayer_);
+  const size_t nCells = static_cast<size_t>(size_.prod());
+  occupied_.resize(nCells);
+  for (size_t i = 0; i < nCells; ++i) {
+    occupied_[i] = data(i) > occupancyThreshold_;  // NaN is free
+  }
+
+  obstacleDistance_.sitesAreOccupied = true;
+  freeSpaceDistance_.sitesAreOccupied = false;
+  for (DistanceLayer* layer : {&obstacleDistance_, &freeSpaceDistance_}) {
+    layer->cells.assign(nCells, Cell{INVALID_SITE, INVALID_SITE, INF_SQUARE_DISTANCE, false});
+    layer->queue = Queue();
+    for (size_t i = 0; i < nCells; ++i) {
+      if (occupied_[i] != layer->sitesAreOccupied) {
+        continue;
+      }
+      const Index cellIndex = getUnwrappedIndex(i) + cellOffset_;
+      layer->cells[i] = Cell{cellIndex.x(), cellIndex.y(), 0, false};
+
+      // Only the sites at the border of their region start a wave.
+      bool isBorder = false;
+      for (int dx = -1; dx <= 1 && !isBorder; ++dx) {
+        for (int dy = -1; dy <= 1 && !isBorder; ++dy) {
+          const Index neighbor = getUnwrappedIndex(i) + Index(dx, dy);
+          if ((neighbor >= 0).all() && (neighbor < size_).all()) {
+            isBorder = occupied_[getLinearIndex(neighbor)] != layer->sitesAreOccupied;
+          }
+        }
+      }
+      if (isBorder) {
+        layer->queue.emplace(0, i);
+      }
+    }
+    propagate(*layer);
+  }
+}
+
+void DynamicDistanceMap::update(const std::vector<Index>& occupiedCells, const std::vector<Index>& freedCells) {
+  for (const Index& index : occupiedCells) {
+    const size_t i = static_cast<size_t>(index.y()) * size_.x() + index.x();
+    if (!occupied_[i]) {
+      occupied_[i] = true;
+      setSite(obstacleDistance_, i);
+      removeSite(freeSpaceDistance_, i);
+    }
+  }
+  for (const Index& index : freedCells) {
+    const size_t i = static_cast<size_t>(index.y()) * size_.x() + index.x();
+    if (occupied_[i]) {
+      occupied_[i] = false;
+      removeSite(obstacleDistance_, i);
+      setSite(freeSpaceDistance_, i);
+    }
+  }
+  propagate(obstacleDistance_);
+  propagate(freeSpaceDistance_);
+}
+
+void DynamicDistanceMap::move(const GridMap& gridMap, const std::vector<BufferRegion>& newRegions) {
+  assert((gridMap.getSize() == size_).all());
+  updateGeometry(gridMap, false);
+
+  // The cells of the new regions are reset and read from the occupancy layer.
+  const Matrix& data = gridMap.get(occupancyLayer_);
+  for (const BufferRegion& region : newRegions) {
+    const Index regionEnd = region.getStartIndex() + region.getSize();
+    for (int column = region.getStartIndex().y(); column < regionEnd.y(); ++column) {
+      for (int row = region.getStartIndex().x(); row < regionEnd.x(); ++row) {
+        const size_t i = static_cast<size_t>(column) * size_.x() + row;
+        occupied_[i] = data(row, column) > occupancyThreshold_;
+        for (DistanceLayer* layer : {&obstacleDistance_, &freeSpaceDistance_}) {
+          if (occupied_[i] == layer->sitesAreOccupied) {
+            setSite(*layer, i);
+          } else {
+            removeSite(*layer, i);
+          }
+        }
+      }
+    }
+  }
+
+  // Sites that left the map were closest to cells at the border of the map, the raise wave starts from there.
+  for (DistanceLayer* layer : {&obstacleDistance_, &freeSpaceDistance_}) {
+    const auto raiseIfRemoved = [&](int row, int column) {
+      const size_t i = getLinearIndex(Index(row, column));
+      Cell& cell = layer->cells[i];
+      if (!cell.raise && cell.siteX != INVALID_SITE && !isSite(*layer, cell.siteX, cell.siteY)) {
+        layer->queue.emplace(cell.squareDistance, i);
+        cell = Cell{INVALID_SITE, INVALID_SITE, INF_SQUARE_DISTANCE, true};
+      }
+    };
+    for (int row = 0; row < size_.x(); ++row) {
+      raiseIfRemoved(row, 0);
+      raiseIfRemoved(row, size_.y() - 1);
+    }
+    for (int column = 0; column < size_.y(); ++column) {
+      raiseIfRemoved(0, column);
+      raiseIfRemoved(size_.x() - 1, column);
+    }
+    propagate(*layer);
+  }
+}
+
+bool DynamicDistanceMap::isOccupied(const Index& index) const {
+  return occupied_[static_cast<size_t>(index.y()) * size_.x() + index.x()];
+}
+
+float DynamicDistanceMap::getSignedDistance(const Index& index) const {
+  const size_t i = static_cast<size_t>(index.y()) * size_.x() + index.x();
+  const Cell& obstacle = obstacleDistance_.cells[i];
+  const Cell& freeSpace = freeSpaceDistance_.cells[i];
+  if (obstacle.squareDistance == INF_SQUARE_DISTANCE) {
+    return signed_distance_field::INF;
+  }
+  if (freeSpace.squareDistance == INF_SQUARE_DISTANCE) {
+    return -signed_distance_field::INF;
+  }
+  return getDistance(obstacle) - getDistance(freeSpace);
+}
+
+bool DynamicDistanceMap::getNearestObstacle(const Index& index, Index& obstacleIndex) const {
+  const Cell& cell = obstacleDistance_.cells[static_cast<size_t>(index.y()) * size_.x() + index.x()];
+  if (cell.siteX == INVALID_SITE) {
+    return false;
+  }
+  obstacleIndex = getBufferIndexFromIndex(Index(cell.siteX, cell.siteY) - cellOffset_, size_, startIndex_);
+  return true;
+}
+
+void DynamicDistanceMap::toLayer(GridMap& gridMap, const std::string& layer) const {
+  assert((gridMap.getSize() == size_).all());
+  if (!gridMap.exists(layer)) {
+    gridMap.add(layer);
+  }
+  Matrix& data = gridMap.get(layer);
+  for (Eigen::Index column = 0; column < data.cols(); ++column) {
+    for (Eigen::Index row = 0; row < data.rows(); ++row) {
+      data(row, column) = getSignedDistance(Index(row, column));
+    }
+  }
+}
+
+bool DynamicDistanceMap::isSite(const DistanceLayer& layer, int siteX, int siteY) const {
+  const Index unwrappedIndex = Index(siteX, siteY) - cellOffset_;
+  if ((unwrappedIndex < 0).any() || (unwrappedIndex >= size_).any()) {
+    return false;
+  }
+  return occupied_[getLinearIndex(unwrappedIndex)] == layer.sitesAreOccupied;
+}
+
+void DynamicDistanceMap::setSite(DistanceLayer& layer, size_t linearIndex) {
+  const Index cellIndex = getUnwrappedIndex(linearIndex) + cellOffset_;
+  layer.cells[linearIndex] = Cell{cellIndex.x(), cellIndex.y(), 0, false};
+  layer.queue.emplace(0, linearIndex);
+}
+
+void DynamicDistanceMap::removeSite(DistanceLayer& layer, size_t linearIndex) {
+  layer.cells[linearIndex] = Cell{INVALID_SITE, INVALID_SITE, INF_SQUARE_DISTANCE, true};
+  layer.queue.emplace(0, linearIndex);
+}
+
+void DynamicDistanceMap::propagate(DistanceLayer& layer) {
+  while (!layer.queue.empty()) {
+    const QueueEntry entry = layer.queue.top();
+    layer.queue.pop();
+    const size_t linearIndex = entry.second;
+    Cell& cell = layer.cells[linearIndex];
+    const Index unwrappedIndex = getUnwrappedIndex(linearIndex);
+
+    if (cell.raise) {
+      // Invalidate the neighbors that refer to removed sites, revisit the others to fill the raised region.
+      for (int dx = -1; dx <= 1; ++dx) {
+        for (int dy = -1; dy <= 1; ++dy) {
+          const Index neighborIndex = unwrappedIndex + Index(dx, dy);
+          if ((dx == 0 && dy == 0) || (neighborIndex < 0).any() || (neighborIndex >= size_).any()) {
+            continue;
+          }
+          const size_t neighborLinearIndex = getLinearIndex(neighborIndex);
+          Cell& neighbor = layer.cells[neighborLinearIndex];
+          if (neighbor.siteX == INVALID_SITE || neighbor.raise) {
+            continue;
+          }
+          layer.queue.emplace(neighbor.squareDistance, neighborLinearIndex);
+          if (!isSite(layer, neighbor.siteX, neighbor.siteY)) {
+            neighbor = Cell{INVALID_SITE, INVALID_SITE, INF_SQUARE_DISTANCE, true};
+          }
+        }
+      }
+      cell.raise = false;
+    } else if (cell.siteX != INVALID_SITE && entry.first == cell.squareDistance && isSite(layer, cell.siteX, cell.siteY)) {
+      // Lower wave: offer the site of the cell to its neighbors.
+      for (int dx = -1; dx <= 1; ++dx) {
+        for (int dy = -1; dy <= 1; ++dy) {
+          const Index neighborIndex = unwrappedIndex + Index(dx, dy);
+          if ((dx == 0 && dy == 0) || (neighborIndex < 0).any() || (neighborIndex >= size_).any()) {
+            continue;
+          }
+          const size_t neighborLinearIndex = getLinearIndex(neighborIndex);
+          Cell& neighbor = layer.cells[neighborLinearIndex];
+          if (neighbor.raise) {
+            continue;
+          }
+          const Index neighborCellIndex = neighborIndex + cellOffset_;
+          const int squareDistance = squareBorderDistance(neighborCellIndex.x() - cell.siteX, neighborCellIndex.y() - cell.siteY);
+          if (squareDistance < neighbor.squareDistance ||
+              (squareDistance == neighbor.squareDistance && !isSite(layer, neighbor.siteX, neighbor.siteY))) {
+            neighbor = Cell{cell.siteX, cell.siteY, squareDistance, false};
+            layer.queue.emplace(squareDistance, neighborLinearIndex);
+          }
+        }
+      }
+    }
+  }
+}
+
+void DynamicDistanceMap::updateGeometry(const GridMap& gridMap, bool resetCellCoordinates) {
+  startIndex_ = gridMap.getStartIndex();
+
+  // Cell coordinates count in the direction of the indices, i.e. opposite to the position axes, relative to the first cell on initialization.
+  const Position firstCellPosition = gridMap.getPosition() + 0.5 * gridMap.getLength().matrix() - Position::Constant(0.5 * gridMap.getResolution());
+  if (resetCellCoordinates) {
+    referencePosition_ = firstCellPosition;
+  }
+  cellOffset_ = ((referencePosition_ - firstCellPosition) / gridMap.getResolution()).array().round().cast<int>();
+}
+
+float DynamicDistanceMap::getDistance(const Cell& cell) const {
+  return 0.5F * resolution_ * std::sqrt(static_cast<float>(cell.squareDistance));
+}
+
+Index DynamicDistanceMap::getUnwrappedIndex(size_t linearIndex) const {
+  const Index bufferIndex(static_cast<int>(linearIndex % size_.x()), static_cast<int>(linearIndex / size_.x()));
+  return getIndexFromBufferIndex(bufferIndex, size_, startIndex_);
+}
+
+size_t DynamicDistanceMap::getLinearIndex(const Index& unwrappedIndex) const {
+  const Index bufferIndex = getBufferIndexFromIndex(unwrappedIndex, size_, startIndex_);
+  return static_cast<size_t>(bufferIndex.y()) * size_.x() + bufferIndex.x();
+}
+
+}  // namespace grid_map
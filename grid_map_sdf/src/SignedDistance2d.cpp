@@ -122,6 +122,40 @@ void extractDistances(Eigen::Ref<Eigen::VectorXf> squareDistance1d,
  }
 }
 
+/**
+* Same as extractSquareDistances, but also stores the location of the minimizing bound (the argmin, i.e. the 1D feature transform).
+* Cells with a value of 0.0 are their own minimum. Takes the sqrt as a final step if requested.
+*/
+template <bool takeSqrt>
+void extractDistancesAndArgmin(Eigen::Ref<Eigen::VectorXf> squareDistance1d, Eigen::Ref<Eigen::VectorXi> argmin1d,
+                              std::vector<DistanceLowerBound>::const_iterator lowerBoundIt, Eigen::Index start) {
+ const auto n = squareDistance1d.size();
+
+ // Store active bound by value to remove indirection
+ auto lastz = lowerBoundIt->z_rhs;
+
+ auto qFloat = static_cast<float>(start);
+ for (Eigen::Index q = start; q < n; ++q) {
+   if (squareDistance1d[q] > 0.0F) {
+     // Find the new active lower bound if q no longer belongs to current interval
+     if (qFloat > lastz) {
+       do {
+         ++lowerBoundIt;
+       } while (lowerBoundIt->z_rhs < qFloat);
+       lastz = lowerBoundIt->z_rhs;
+     }
+
+     const float squareDistance = squarePixelBorderDistance(qFloat, lowerBoundIt->v, lowerBoundIt->f);
+     squareDistance1d[q] = takeSqrt ? std::sqrt(squareDistance) : squareDistance;
+     argmin1d[q] = static_cast<int>(lowerBoundIt->v);
+   } else {
+     argmin1d[q] = static_cast<int>(q);
+   }
+
+   qFloat += 1.0F;
+ }
+}
+
 /**
 * Find the location of the last zero value from the front
 */
@@ -166,6 +200,27 @@ inline void distanceTransform_1d_inplace(Eigen::Ref<Eigen::VectorXf> squareDista
  }
 }
 
+/**
+* Same as squaredDistanceTransform_1d_inplace / distanceTransform_1d_inplace, but also computes the argmin.
+* @param squareDistance1d : input as squared distance, output is the (squared) distance.
+* @param argmin1d : [output] location of the closest zero of the input (or of the minimizing bound for a nonzero input).
+* @param lowerBounds : work vector
+*/
+template <bool takeSqrt>
+inline void distanceAndArgminTransform_1d_inplace(Eigen::Ref<Eigen::VectorXf> squareDistance1d, Eigen::Ref<Eigen::VectorXi> argmin1d,
+                                                 std::vector<DistanceLowerBound>& lowerBounds) {
+ auto start = lastZeroFromFront(squareDistance1d);
+
+ // The first zeros are their own argmin.
+ for (Eigen::Index q = 0; q < std::min(start, squareDistance1d.size()); ++q) {
+   argmin1d[q] = static_cast<int>(q);
+ }
+ if (start < squareDistance1d.size()) {
+   auto startIt = fillLowerBounds(squareDistance1d, lowerBounds, start);
+   extractDistancesAndArgmin<takeSqrt>(squareDistance1d, argmin1d, startIt, start);
+ }
+}
+
 void computePixelDistance2dTranspose(Matrix& input, Matrix& distanceTranspose) {
  const auto n = input.rows();
  const auto m = input.cols();
@@ -186,6 +241,44 @@ void computePixelDistance2dTranspose(Matrix& input, Matrix& distanceTranspose) {
  }
 }
 
+/**
+* Same as computePixelDistance2dTranspose, but also computes the feature transform: the row and column of the closest zero of the input
+* for each cell (in the original, not transposed, layout).
+* The column pass keeps the row of the closest zero per cell. In the row pass, the argmin is the column of the closest zero, and its row
+* is the one found in the column pass for that column.
+*/
+void computePixelDistanceAndFeature2dTranspose(Matrix& input, Matrix& distanceTranspose, Eigen::MatrixXi& nearestRow,
+                                              Eigen::MatrixXi& nearestCol) {
+ const auto n = input.rows();
+ const auto m = input.cols();
+
+ // Allocate a buffer big enough for processing both rowise and columnwise
+ std::vector<DistanceLowerBound> lowerBounds(std::max(n, m));
+
+ // Process columns
+ Eigen::MatrixXi rowArgmin(n, m);
+ for (Eigen::Index i = 0; i < m; ++i) {
+   distanceAndArgminTransform_1d_inplace<false>(input.col(i), rowArgmin.col(i), lowerBounds);
+ }
+
+ // Process rows (= columns after transpose).
+ distanceTranspose = input.transpose();
+ Eigen::MatrixXi colArgminTranspose(m, n);
+ for (Eigen::Index i = 0; i < n; ++i) {
+   distanceAndArgminTransform_1d_inplace<true>(distanceTranspose.col(i), colArgminTranspose.col(i), lowerBounds);
+ }
+
+ nearestRow.resize(n, m);
+ nearestCol.resize(n, m);
+ for (Eigen::Index j = 0; j < m; ++j) {
+   for (Eigen::Index i = 0; i < n; ++i) {
+     const int col = colArgminTranspose(j, i);
+     nearestCol(i, j) = col;
+     nearestRow(i, j) = rowArgmin(i, col);
+   }
+ }
+}
+
 // Initialize with square distance in height direction in pixel units if above the surface
 void initializeObstacleDistance(const Matrix& elevationMap, Matrix& result, float height, float resolution) {
  /* Vectorized implementation of:
@@ -237,8 +330,43 @@ Matrix signedDistanceFromOccupancyTranspose(const Eigen::Matrix<bool, -1, -1>& o
  return resolution * (sdfObstacle - sdfObstacleFree);
 }
 
+Matrix signedDistanceAndFeatureFromOccupancyTranspose(const Eigen::Matrix<bool, -1, -1>& occupancyGrid, float resolution,
+                                                     Eigen::MatrixXi& nearestRow, Eigen::MatrixXi& nearestCol) {
+ // Compute pixel distance to obstacles, and the closest obstacle
+ Matrix sdfObstacle;
+ Matrix init = occupancyGrid.unaryExpr([=](bool val) { return (val) ? 0.0F : INF; });
+ internal::computePixelDistanceAndFeature2dTranspose(init, sdfObstacle, nearestRow, nearestCol);
+
+ // Compute pixel distance to obstacle free space, and the closest free cell
+ Matrix sdfObstacleFree;
+ Eigen::MatrixXi nearestFreeRow;
+ Eigen::MatrixXi nearestFreeCol;
+ init = occupancyGrid.unaryExpr([=](bool val) { return (val) ? INF : 0.0F; });
+ internal::computePixelDistanceAndFeature2dTranspose(init, sdfObstacleFree, nearestFreeRow, nearestFreeCol);
+
+ // Obstacle cells take the closest free cell
+ nearestRow = occupancyGrid.select(nearestFreeRow, nearestRow);
+ nearestCol = occupancyGrid.select(nearestFreeCol, nearestCol);
+
+ return resolution * (sdfObstacle - sdfObstacleFree);
+}
+
 }  // namespace internal
 
+void distanceTransform1d(Eigen::Ref<Eigen::VectorXf> squareDistance1d, bool takeSqrt) {
+ // Work vector, reused between calls of the same thread
+ thread_local std::vector<internal::DistanceLowerBound> lowerBounds;
+ if (lowerBounds.size() < static_cast<size_t>(squareDistance1d.size())) {
+   lowerBounds.resize(squareDistance1d.size());
+ }
+
+ if (takeSqrt) {
+   internal::distanceTransform_1d_inplace(squareDistance1d, lowerBounds);
+ } else {
+   internal::squaredDistanceTransform_1d_inplace(squareDistance1d, lowerBounds);
+ }
+}
+
 void signedDistanceAtHeightTranspose(const Matrix& elevationMap, Matrix& sdfTranspose, Matrix& tmp, Matrix& tmpTranspose, float height,
                                     float resolution, float minHeight, float maxHeight) {
  const bool allPixelsAreObstacles = height < minHeight;
@@ -286,5 +414,20 @@ Matrix signedDistanceFromOccupancy(const Eigen::Matrix<bool, -1, -1>& occupancyG
  }
 }
 
+Matrix signedDistanceFromOccupancy(const Eigen::Matrix<bool, -1, -1>& occupancyGrid, float resolution, Eigen::MatrixXi& nearestRow,
+                                  Eigen::MatrixXi& nearestCol) {
+ auto obstacleCount = occupancyGrid.count();
+ bool hasObstacles = obstacleCount > 0;
+ bool hasFreeSpace = obstacleCount < occupancyGrid.size();
+ if (hasObstacles && hasFreeSpace) {
+   return internal::signedDistanceAndFeatureFromOccupancyTranspose(occupancyGrid, resolution, nearestRow, nearestCol).transpose();
+ } else {
+   // There is no occupancy border -> no closest cell, distance is -INF / INF everywhere
+   nearestRow.setConstant(occupancyGrid.rows(), occupancyGrid.cols(), -1);
+   nearestCol.setConstant(occupancyGrid.rows(), occupancyGrid.cols(), -1);
+   return Matrix::Constant(occupancyGrid.rows(), occupancyGrid.cols(), hasObstacles ? -INF : INF);
+ }
+}
+
 }  // namespace signed_distance_field
 }  // namespace grid_map
\ No newline at end of file
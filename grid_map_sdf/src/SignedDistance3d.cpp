@@ -0,0 +1,104 @@
+/*
+ * SignedDistance3d.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_sdf/SignedDistance3d.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include <grid_map_core/utils/parallel.hpp>
+
+#include "grid_map_sdf/SignedDistance2d.hpp"
+
+namespace grid_map {
+namespace signed_distance_field {
+
+namespace {
+
+/**
+ * Distance transform of all lines of the grid along one dimension.
+ * @param data : [in/out] squared distances of the grid.
+ * @param nLines : number of lines.
+ * @param lineStart : function returning the offset of the first element of a line.
+ * @param length : number of elements of a line.
+ * @param stride : offset between the elements of a line.
+ * @param takeSqrt : take the square root of the result.
+ * @param numberOfThreads : maximum number of threads.
+ */
+template <typename LineStart>
+void distanceTransformLines(std::vector<float>& data, size_t nLines, const LineStart& lineStart, size_t length, size_t stride,
+                            bool takeSqrt, unsigned int numberOfThreads) {
+  parallelFor(
+      0, nLines,
+      [&](size_t begin, size_t end) {
+        Eigen::VectorXf line(length);
+        for (size_t i = begin; i < end; ++i) {
+          float* first = data.data() + lineStart(i);
+          if (stride == 1) {
+            distanceTransform1d(Eigen::Map<Eigen::VectorXf>(first, length), takeSqrt);
+          } else {
+            // Copy strided lines to contiguous memory for the transform.
+            Eigen::Map<Eigen::VectorXf, 0, Eigen::InnerStride<>> stridedLine(first, length, Eigen::InnerStride<>(stride));
+            line = stridedLine;
+            distanceTransform1d(line, takeSqrt);
+            stridedLine = line;
+          }
+        }
+      },
+      numberOfThreads, std::max<size_t>(1, 4096 / std::max<size_t>(length, 1)));
+}
+
+/**
+ * Computes the pixel distance to the sites in place, with data = 0.0 at the sites and INF elsewhere.
+ */
+void computePixelDistance3d(std::vector<float>& data, const Gridmap3dLookup::size_t_3d& gridsize, unsigned int numberOfThreads) {
+  const size_t nx = gridsize.x;
+  const size_t ny = gridsize.y;
+  const size_t nz = gridsize.z;
+
+  // Along x: lines are contiguous
+  distanceTransformLines(data, ny * nz, [nx](size_t i) { return i * nx; }, nx, 1, false, numberOfThreads);
+
+  // Along y: one line per (x, z)
+  distanceTransformLines(data, nx * nz, [nx, ny](size_t i) { return (i / nx) * nx * ny + i % nx; }, ny, nx, false, numberOfThreads);
+
+  // Along z: one line per (x, y), fused with taking the sqrt
+  distanceTransformLines(data, nx * ny, [](size_t i) { return i; }, nz, nx * ny, true, numberOfThreads);
+}
+
+}  // namespace
+
+std::vector<float> signedDistanceFromOccupancy3d(const std::vector<bool>& occupancy, const Gridmap3dLookup::size_t_3d& gridsize,
+                                                 float resolution, unsigned int numberOfThreads) {
+  assert(occupancy.size() == gridsize.x * gridsize.y * gridsize.z);
+
+  const auto obstacleCount = static_cast<size_t>(std::count(occupancy.begin(), occupancy.end(), true));
+  if (obstacleCount == 0) {
+    // No obstacles -> distance is infinite
+    return std::vector<float>(occupancy.size(), INF);
+  } else if (obstacleCount == occupancy.size()) {
+    // Only obstacles -> distance is minus infinity everywhere
+    return std::vector<float>(occupancy.size(), -INF);
+  }
+
+  // Compute pixel distance to obstacles
+  std::vector<float> sdfObstacle(occupancy.size());
+  std::transform(occupancy.begin(), occupancy.end(), sdfObstacle.begin(), [](bool val) { return (val) ? 0.0F : INF; });
+  computePixelDistance3d(sdfObstacle, gridsize, numberOfThreads);
+
+  // Compute pixel distance to obstacle free space
+  std::vector<float> sdfObstacleFree(occupancy.size());
+  std::transform(occupancy.begin(), occupancy.end(), sdfObstacleFree.begin(), [](bool val) { return (val) ? INF : 0.0F; });
+  computePixelDistance3d(sdfObstacleFree, gridsize, numberOfThreads);
+
+  for (size_t i = 0; i < sdfObstacle.size(); ++i) {
+    sdfObstacle[i] = resolution * (sdfObstacle[i] - sdfObstacleFree[i]);
+  }
+  return sdfObstacle;
+}
+
+}  // namespace signed_distance_field
+}  // namespace grid_map
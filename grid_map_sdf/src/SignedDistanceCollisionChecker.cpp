@@ -0,0 +1,166 @@
+/*
+ * SignedDistanceCollisionChecker.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_sdf/SignedDistanceCollisionChecker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <grid_map_core/utils/parallel.hpp>
+
+namespace grid_map {
+
+using signed_distance_field::Gridmap3dLookup;
+
+SignedDistanceCollisionChecker::SignedDistanceCollisionChecker(const SignedDistanceField& signedDistanceField, size_t blockSize)
+    : signedDistanceField_(signedDistanceField), blockSize_(std::max<size_t>(blockSize, 1)) {
+  const auto& gridsize = signedDistanceField_.getGridLookup().gridsize_;
+  numberOfBlocks_ = {(gridsize.x + blockSize_ - 1) / blockSize_, (gridsize.y + blockSize_ - 1) / blockSize_,
+                     (gridsize.z + blockSize_ - 1) / blockSize_};
+  blockBounds_.assign(numberOfBlocks_.x * numberOfBlocks_.y * numberOfBlocks_.z,
+                      BlockBounds{std::numeric_limits<float>::infinity(), 0.0F});
+
+  // The points are processed in memory order: x fastest, then y, then z.
+  size_t linearIndex = 0;
+  signedDistanceField_.filterPoints([&](const Position3& /*position*/, float distance, const Derivative3& derivative) {
+    const size_t rowX = linearIndex % gridsize.x;
+    const size_t colY = (linearIndex / gridsize.x) % gridsize.y;
+    const size_t layerZ = linearIndex / (gridsize.x * gridsize.y);
+    ++linearIndex;
+
+    auto& bounds =
+        blockBounds_[((layerZ / blockSize_) * numberOfBlocks_.y + colY / blockSize_) * numberOfBlocks_.x + rowX / blockSize_];
+    bounds.minDistance = std::min(bounds.minDistance, distance);
+    bounds.maxGradientNorm = std::max(bounds.maxGradientNorm, static_cast<float>(derivative.norm()));
+  });
+}
+
+SignedDistanceCollisionChecker::Result SignedDistanceCollisionChecker::check(const Configuration& configuration, bool earlyExit,
+                                                                             double safetyMargin) const {
+  const size_t numberOfSpheres = configuration.spheres.size();
+  const size_t numberOfBodies = numberOfSpheres + configuration.capsules.size();
+
+  // Lower bounds of the clearance of all bodies from the coarse grid.
+  std::vector<std::pair<double, size_t>> lowerBounds;
+  lowerBounds.reserve(numberOfBodies);
+  for (size_t i = 0; i < numberOfSpheres; ++i) {
+    const auto& sphere = configuration.spheres[i];
+    lowerBounds.emplace_back(lowerBound(sphere.center, sphere.center) - sphere.radius, i);
+  }
+  for (size_t i = 0; i < configuration.capsules.size(); ++i) {
+    const auto& capsule = configuration.capsules[i];
+    lowerBounds.emplace_back(lowerBound(capsule.start.cwiseMin(capsule.end), capsule.start.cwiseMax(capsule.end)) - capsule.radius,
+                             numberOfSpheres + i);
+  }
+  std::sort(lowerBounds.begin(), lowerBounds.end());
+
+  // Evaluate the bodies that can be the closest one, most likely first.
+  Result result;
+  Result bodyResult;
+  for (const auto& lowerBoundAndBody : lowerBounds) {
+    if (lowerBoundAndBody.first >= result.clearance) {
+      break;
+    }
+    evaluateBody(configuration, lowerBoundAndBody.second, bodyResult);
+    if (result.bodyIndex < 0 || bodyResult.clearance < result.clearance) {
+      result = bodyResult;
+    }
+    if (earlyExit && bodyResult.clearance < safetyMargin) {
+      result = bodyResult;
+      break;
+    }
+  }
+  if (result.bodyIndex < 0 && !lowerBounds.empty()) {
+    // All bodies have an infinite clearance (no obstacles).
+    result.bodyIndex = static_cast<int>(lowerBounds.front().second);
+  }
+  result.isInCollision = result.clearance < safetyMargin;
+  return result;
+}
+
+std::vector<SignedDistanceCollisionChecker::Result> SignedDistanceCollisionChecker::check(const std::vector<Configuration>& configurations,
+                                                                                          bool earlyExit, double safetyMargin,
+                                                                                          unsigned int numberOfThreads) const {
+  std::vector<Result> results(configurations.size());
+  parallelFor(
+      0, configurations.size(),
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          results[i] = check(configurations[i], earlyExit, safetyMargin);
+        }
+      },
+      numberOfThreads, 16);
+  return results;
+}
+
+double SignedDistanceCollisionChecker::lowerBound(const Position3& lower, const Position3& upper) const {
+  const auto& lookup = signedDistanceField_.getGridLookup();
+  const double resInv = 1.0 / lookup.resolution_;
+
+  // Range of nearest nodes of the box. The x and y index increase opposite to the position.
+  const auto nodeRange = [&](double fromIndex, double toIndex, double maxIndex, size_t& first, size_t& last) {
+    first = Gridmap3dLookup::getNearestPositiveInteger(fromIndex, maxIndex);
+    last = Gridmap3dLookup::getNearestPositiveInteger(toIndex, maxIndex);
+  };
+  Gridmap3dLookup::size_t_3d first;
+  Gridmap3dLookup::size_t_3d last;
+  nodeRange((lookup.gridOrigin_.x() - upper.x()) * resInv, (lookup.gridOrigin_.x() - lower.x()) * resInv, lookup.gridMaxIndexAsDouble_.x(),
+            first.x, last.x);
+  nodeRange((lookup.gridOrigin_.y() - upper.y()) * resInv, (lookup.gridOrigin_.y() - lower.y()) * resInv, lookup.gridMaxIndexAsDouble_.y(),
+            first.y, last.y);
+  nodeRange((lower.z() - lookup.gridOrigin_.z()) * resInv, (upper.z() - lookup.gridOrigin_.z()) * resInv, lookup.gridMaxIndexAsDouble_.z(),
+            first.z, last.z);
+
+  // Largest distance between a point of the box and its nearest node: half a voxel diagonal, plus the part of the box outside the grid
+  // (where the field is extrapolated).
+  const Position3 gridLower(lookup.gridOrigin_.x() - lookup.gridMaxIndexAsDouble_.x() * lookup.resolution_,
+                            lookup.gridOrigin_.y() - lookup.gridMaxIndexAsDouble_.y() * lookup.resolution_, lookup.gridOrigin_.z());
+  const Position3 gridUpper(lookup.gridOrigin_.x(), lookup.gridOrigin_.y(),
+                            lookup.gridOrigin_.z() + lookup.gridMaxIndexAsDouble_.z() * lookup.resolution_);
+  const Position3 outside = (gridLower - lower).cwiseMax(upper - gridUpper).cwiseMax(0.0);
+  const double maxNodeDistance = 0.5 * std::sqrt(3.0) * lookup.resolution_ + outside.norm();
+
+  double bound = std::numeric_limits<double>::infinity();
+  for (size_t blockZ = first.z / blockSize_; blockZ <= last.z / blockSize_; ++blockZ) {
+    for (size_t blockY = first.y / blockSize_; blockY <= last.y / blockSize_; ++blockY) {
+      for (size_t blockX = first.x / blockSize_; blockX <= last.x / blockSize_; ++blockX) {
+        const auto& bounds = blockBounds_[(blockZ * numberOfBlocks_.y + blockY) * numberOfBlocks_.x + blockX];
+        bound = std::min(bound, bounds.minDistance - bounds.maxGradientNorm * maxNodeDistance);
+      }
+    }
+  }
+  return bound;
+}
+
+void SignedDistanceCollisionChecker::evaluateBody(const Configuration& configuration, size_t bodyIndex, Result& result) const {
+  result.bodyIndex = static_cast<int>(bodyIndex);
+  if (bodyIndex < configuration.spheres.size()) {
+    const auto& sphere = configuration.spheres[bodyIndex];
+    const auto valueAndDerivative = signedDistanceField_.valueAndDerivative(sphere.center);
+    result.clearance = valueAndDerivative.first - sphere.radius;
+    result.closestPoint = sphere.center;
+    result.gradient = valueAndDerivative.second;
+    return;
+  }
+
+  // Capsule: sample the segment with the resolution of the field.
+  const auto& capsule = configuration.capsules[bodyIndex - configuration.spheres.size()];
+  const Position3 segment = capsule.end - capsule.start;
+  const auto numberOfSteps = static_cast<int>(std::max(std::ceil(segment.norm() / signedDistanceField_.getGridLookup().resolution_), 1.0));
+  result.clearance = std::numeric_limits<double>::infinity();
+  for (int i = 0; i <= numberOfSteps; ++i) {
+    const Position3 point = capsule.start + (static_cast<double>(i) / numberOfSteps) * segment;
+    const auto valueAndDerivative = signedDistanceField_.valueAndDerivative(point);
+    if (valueAndDerivative.first - capsule.radius < result.clearance || i == 0) {
+      result.clearance = valueAndDerivative.first - capsule.radius;
+      result.closestPoint = point;
+      result.gradient = valueAndDerivative.second;
+    }
+  }
+}
+
+}  // namespace grid_map
@@ -8,10 +8,12 @@
 
 #include "grid_map_sdf/SignedDistanceField.hpp"
 
+#include <cmath>
 #include <iostream>
 
 #include "grid_map_sdf/DistanceDerivatives.hpp"
 #include "grid_map_sdf/SignedDistance2d.hpp"
+#include "grid_map_sdf/SignedDistance3d.hpp"
 
 namespace grid_map {
 
@@ -21,6 +23,7 @@ using signed_distance_field::Gridmap3dLookup;
 using signed_distance_field::layerCentralDifference;
 using signed_distance_field::layerFiniteDifference;
 using signed_distance_field::signedDistanceAtHeightTranspose;
+using signed_distance_field::signedDistanceFromOccupancy3d;
 
 SignedDistanceField::SignedDistanceField(const GridMap& gridMap, const std::string& elevationLayer, double minHeight, double maxHeight)
     : frameId_(gridMap.getFrameId()), timestamp_(gridMap.getTimestamp()) {
@@ -55,6 +58,31 @@ SignedDistanceField::SignedDistanceField(const GridMap& gridMap, const std::stri
   computeSignedDistance(elevationData);
 }
 
+SignedDistanceField::SignedDistanceField(const Gridmap3dLookup& grid, const std::vector<bool>& occupancy, const std::string& frameId,
+                                         Time timestamp)
+    : gridmap3DLookup_(grid), frameId_(frameId), timestamp_(timestamp) {
+  assert(occupancy.size() == gridmap3DLookup_.linearSize());
+  computeSignedDistance(occupancy);
+}
+
+SignedDistanceField::SignedDistanceField(const Gridmap3dLookup& grid, const std::vector<Position3>& occupiedPoints,
+                                         const std::string& frameId, Time timestamp)
+    : gridmap3DLookup_(grid), frameId_(frameId), timestamp_(timestamp) {
+  // Rasterize the points, skipping the ones outside of the grid
+  std::vector<bool> occupancy(gridmap3DLookup_.linearSize(), false);
+  const double resInv = 1.0 / gridmap3DLookup_.resolution_;
+  for (const auto& point : occupiedPoints) {
+    const Position3 subpixelVector{(gridmap3DLookup_.gridOrigin_.x() - point.x()) * resInv,
+                                   (gridmap3DLookup_.gridOrigin_.y() - point.y()) * resInv,
+                                   (point.z() - gridmap3DLookup_.gridOrigin_.z()) * resInv};
+    const Eigen::Array3d roundedIndex = subpixelVector.array().round();
+    if ((roundedIndex >= 0.0).all() && (roundedIndex <= gridmap3DLookup_.gridMaxIndexAsDouble_.array()).all()) {
+      occupancy[gridmap3DLookup_.linearIndex(gridmap3DLookup_.nearestNode(point))] = true;
+    }
+  }
+  computeSignedDistance(occupancy);
+}
+
 double SignedDistanceField::value(const Position3& position) const noexcept {
   const auto nodeIndex = gridmap3DLookup_.nearestNode(position);
   const auto nodePosition = gridmap3DLookup_.nodePosition(nodeIndex);
@@ -153,6 +181,37 @@ void SignedDistanceField::computeSignedDistance(const Matrix& elevation) {
   // Add the data to the 3D structure
   emplacebackLayerData(currentLayer, dxTranspose, dy, dz);
 }
+void SignedDistanceField::computeSignedDistance(const std::vector<bool>& occupancy) {
+  const auto& gridsize = gridmap3DLookup_.gridsize_;
+  const auto resolution = static_cast<float>(gridmap3DLookup_.resolution_);
+  const std::vector<float> signedDistance = signedDistanceFromOccupancy3d(occupancy, gridsize, resolution);
+
+  // Central difference along one dimension, single sided at the boundaries. Zero if undefined (single voxel or infinite distance).
+  const auto difference = [&](size_t linearIndex, size_t index, size_t size, size_t stride, float delta) {
+    if (size < 2) {
+      return 0.0F;
+    }
+    const size_t previous = (index > 0) ? linearIndex - stride : linearIndex;
+    const size_t next = (index + 1 < size) ? linearIndex + stride : linearIndex;
+    const float value = (signedDistance[next] - signedDistance[previous]) / (static_cast<float>(next - previous) / stride * delta);
+    return std::isfinite(value) ? value : 0.0F;
+  };
+
+  const size_t strideZ = gridsize.x * gridsize.y;
+  data_.clear();
+  data_.reserve(gridmap3DLookup_.linearSize());
+  for (size_t layerZ = 0; layerZ < gridsize.z; ++layerZ) {
+    for (size_t colY = 0; colY < gridsize.y; ++colY) {
+      for (size_t rowX = 0; rowX < gridsize.x; ++rowX) {
+        const size_t index = data_.size();
+        data_.emplace_back(node_data_t{signedDistance[index], difference(index, rowX, gridsize.x, 1, -resolution),
+                                       difference(index, colY, gridsize.y, gridsize.x, -resolution),
+                                       difference(index, layerZ, gridsize.z, strideZ, resolution)});
+      }
+    }
+  }
+}
+
 void SignedDistanceField::computeLayerSdfandDeltaX(const Matrix& elevation, Matrix& currentLayer, Matrix& dxTranspose, Matrix& sdfTranspose,
                                                    Matrix& tmp, Matrix& tmpTranspose, float height, float resolution, float minHeight,
                                                    float maxHeight) const {
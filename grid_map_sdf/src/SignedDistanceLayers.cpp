@@ -0,0 +1,73 @@
+/*
+ * SignedDistanceLayers.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map_sdf/SignedDistanceLayers.hpp"
+
+#include <cmath>
+
+#include <grid_map_core/GridMapMath.hpp>
+#include <grid_map_core/iterators/GridMapIterator.hpp>
+
+#include "grid_map_sdf/SignedDistance2d.hpp"
+
+namespace grid_map {
+namespace signed_distance_field {
+
+void addSignedDistanceLayers(GridMap& gridMap, const std::string& occupancyLayer, float occupancyThreshold,
+                             const std::string& distanceLayer) {
+  const Size& size = gridMap.getSize();
+  const Matrix& occupancyData = gridMap.get(occupancyLayer);
+
+  // The transform works on the unwrapped map.
+  Eigen::Matrix<bool, -1, -1> occupancy(size.x(), size.y());
+  for (GridMapIterator iterator(gridMap); !iterator.isPastEnd(); ++iterator) {
+    const Index unwrappedIndex = iterator.getUnwrappedIndex();
+    occupancy(unwrappedIndex.x(), unwrappedIndex.y()) = occupancyData((*iterator).x(), (*iterator).y()) > occupancyThreshold;
+  }
+
+  Eigen::MatrixXi nearestRow;
+  Eigen::MatrixXi nearestCol;
+  const Matrix signedDistance = signedDistanceFromOccupancy(occupancy, gridMap.getResolution(), nearestRow, nearestCol);
+
+  const std::string nearestXLayer = distanceLayer + "_nearest_x";
+  const std::string nearestYLayer = distanceLayer + "_nearest_y";
+  for (const auto& layer : {distanceLayer, nearestXLayer, nearestYLayer}) {
+    if (!gridMap.exists(layer)) {
+      gridMap.add(layer);
+    }
+  }
+  Matrix& distanceData = gridMap.get(distanceLayer);
+  Matrix& nearestXData = gridMap.get(nearestXLayer);
+  Matrix& nearestYData = gridMap.get(nearestYLayer);
+  for (GridMapIterator iterator(gridMap); !iterator.isPastEnd(); ++iterator) {
+    const Index index = *iterator;
+    const Index unwrappedIndex = iterator.getUnwrappedIndex();
+    distanceData(index.x(), index.y()) = signedDistance(unwrappedIndex.x(), unwrappedIndex.y());
+
+    const Index nearestUnwrappedIndex(nearestRow(unwrappedIndex.x(), unwrappedIndex.y()), nearestCol(unwrappedIndex.x(), unwrappedIndex.y()));
+    Position nearestPosition;
+    if (nearestUnwrappedIndex.x() < 0 ||
+        !gridMap.getPosition(getBufferIndexFromIndex(nearestUnwrappedIndex, size, gridMap.getStartIndex()), nearestPosition)) {
+      nearestPosition.setConstant(NAN);
+    }
+    nearestXData(index.x(), index.y()) = static_cast<float>(nearestPosition.x());
+    nearestYData(index.x(), index.y()) = static_cast<float>(nearestPosition.y());
+  }
+}
+
+bool getNearestBorderPosition(const GridMap& gridMap, const std::string& distanceLayer, const Position& position,
+                              Position& nearestPosition) {
+  Index index;
+  if (!gridMap.getIndex(position, index)) {
+    return false;
+  }
+  nearestPosition.x() = gridMap.at(distanceLayer + "_nearest_x", index);
+  nearestPosition.y() = gridMap.at(distanceLayer + "_nearest_y", index);
+  return std::isfinite(nearestPosition.x());
+}
+
+}  // namespace signed_distance_field
+}  // namespace grid_map
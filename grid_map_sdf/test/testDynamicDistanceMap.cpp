@@ -0,0 +1,123 @@
+/*
+ * testDynamicDistanceMap.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <grid_map_core/GridMap.hpp>
+#include <grid_map_core/iterators/GridMapIterator.hpp>
+
+#include "grid_map_sdf/DynamicDistanceMap.hpp"
+#include "grid_map_sdf/SignedDistance2d.hpp"
+
+using namespace grid_map;
+
+namespace {
+/** Number of cells where the dynamic distance map differs from the full 2D transform of the map. */
+int countDifferences(const DynamicDistanceMap& distanceMap, const GridMap& gridMap, float tolerance) {
+  Eigen::Matrix<bool, -1, -1> occupancy(gridMap.getSize().x(), gridMap.getSize().y());
+  for (GridMapIterator iterator(gridMap); !iterator.isPastEnd(); ++iterator) {
+    const Index unwrappedIndex = iterator.getUnwrappedIndex();
+    occupancy(unwrappedIndex.x(), unwrappedIndex.y()) = gridMap.at("occupancy", *iterator) > 0.5F;
+  }
+  const Matrix signedDistance = signed_distance_field::signedDistanceFromOccupancy(occupancy, gridMap.getResolution());
+
+  int nDifferences = 0;
+  for (GridMapIterator iterator(gridMap); !iterator.isPastEnd(); ++iterator) {
+    const Index unwrappedIndex = iterator.getUnwrappedIndex();
+    const float expected = signedDistance(unwrappedIndex.x(), unwrappedIndex.y());
+    const float actual = distanceMap.getSignedDistance(*iterator);
+    if (expected != actual && !(std::abs(expected - actual) < tolerance)) {
+      ++nDifferences;
+    }
+  }
+  return nDifferences;
+}
+}  // namespace
+
+TEST(testDynamicDistanceMap, emptyAndFull) {
+  GridMap gridMap({"occupancy"});
+  gridMap.setGeometry(Length(2.0, 3.0), 0.1);
+  gridMap["occupancy"].setZero();
+
+  DynamicDistanceMap distanceMap(gridMap, "occupancy");
+  EXPECT_EQ(distanceMap.getSignedDistance(Index(3, 4)), signed_distance_field::INF);
+  Index obstacle;
+  EXPECT_FALSE(distanceMap.getNearestObstacle(Index(3, 4), obstacle));
+
+  gridMap.at("occupancy", Index(10, 10)) = 1.0F;
+  distanceMap.update({Index(10, 10)}, {});
+  EXPECT_TRUE(distanceMap.isOccupied(Index(10, 10)));
+  EXPECT_TRUE(distanceMap.getNearestObstacle(Index(3, 4), obstacle));
+  EXPECT_TRUE((obstacle == Index(10, 10)).all());
+  EXPECT_EQ(countDifferences(distanceMap, gridMap, 1e-4), 0);
+  distanceMap.toLayer(gridMap, "sdf");
+  EXPECT_FLOAT_EQ(gridMap.at("sdf", Index(10, 12)), 0.15F);
+
+  gridMap["occupancy"].setOnes();
+  distanceMap.initialize(gridMap, "occupancy");
+  EXPECT_EQ(distanceMap.getSignedDistance(Index(3, 4)), -signed_distance_field::INF);
+}
+
+TEST(testDynamicDistanceMap, randomUpdates) {
+  GridMap gridMap({"occupancy"});
+  gridMap.setGeometry(Length(8.0, 6.0), 0.1);
+  gridMap["occupancy"].setZero();
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> row(0, gridMap.getSize().x() - 1);
+  std::uniform_int_distribution<int> column(0, gridMap.getSize().y() - 1);
+  for (int i = 0; i < 100; ++i) {
+    gridMap.at("occupancy", Index(row(generator), column(generator))) = 1.0F;
+  }
+
+  DynamicDistanceMap distanceMap(gridMap, "occupancy");
+  EXPECT_EQ(countDifferences(distanceMap, gridMap, 1e-4), 0);
+
+  for (int update = 0; update < 20; ++update) {
+    std::vector<Index> occupiedCells;
+    std::vector<Index> freedCells;
+    for (int i = 0; i < 20; ++i) {
+      const Index index(row(generator), column(generator));
+      float& occupancy = gridMap.at("occupancy", index);
+      if (occupancy > 0.5F) {
+        freedCells.push_back(index);
+        occupancy = 0.0F;
+      } else {
+        occupiedCells.push_back(index);
+        occupancy = 1.0F;
+      }
+    }
+    distanceMap.update(occupiedCells, freedCells);
+    EXPECT_LE(countDifferences(distanceMap, gridMap, 1e-4), 5);
+  }
+}
+
+TEST(testDynamicDistanceMap, move) {
+  GridMap gridMap({"occupancy"});
+  gridMap.setGeometry(Length(6.0, 5.0), 0.1);
+  gridMap["occupancy"].setZero();
+
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> shift(-0.8, 0.8);
+  std::bernoulli_distribution isObstacle(0.03);
+  for (GridMapIterator iterator(gridMap); !iterator.isPastEnd(); ++iterator) {
+    gridMap.at("occupancy", *iterator) = isObstacle(generator) ? 1.0F : 0.0F;
+  }
+  DynamicDistanceMap distanceMap(gridMap, "occupancy");
+
+  for (int i = 0; i < 20; ++i) {
+    std::vector<BufferRegion> newRegions;
+    gridMap.move(gridMap.getPosition() + Position(shift(generator), shift(generator)), newRegions);
+    for (const BufferRegion& region : newRegions) {
+      gridMap["occupancy"].block(region.getStartIndex().x(), region.getStartIndex().y(), region.getSize().x(), region.getSize().y()) =
+          Matrix::NullaryExpr(region.getSize().x(), region.getSize().y(), [&]() { return isObstacle(generator) ? 1.0F : 0.0F; });
+    }
+    distanceMap.move(gridMap, newRegions);
+    EXPECT_LE(countDifferences(distanceMap, gridMap, 1e-4), 5);
+  }
+}
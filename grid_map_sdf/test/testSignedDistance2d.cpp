@@ -10,6 +10,7 @@
 
 #include "grid_map_sdf/PixelBorderDistance.hpp"
 #include "grid_map_sdf/SignedDistance2d.hpp"
+#include "grid_map_sdf/SignedDistanceLayers.hpp"
 
 #include "naiveSignedDistance.hpp"
 
@@ -109,4 +110,60 @@ TEST(testSignedDistance2d, signedDistance2d_random) {
     const auto signedDistance = signedDistanceFromOccupancy(occupancy, resolution);
     ASSERT_TRUE(isEqualSdf(signedDistance, naiveSignedDistance, 1e-4)) << "height: " << height;
   }
-}
\ No newline at end of file
+}
+TEST(testSignedDistance2d, signedDistance2d_feature) {
+  const int n = 20;
+  const int m = 30;
+  const float resolution = 0.1;
+  Matrix map = Matrix::Random(n, m);  // random [-1.0, 1.0]
+
+  float heightStep = 0.1;
+  for (float height = -1.0 - heightStep; height < 1.0 + heightStep; height += heightStep) {
+    const auto occupancy = occupancyAtHeight(map, height);
+
+    Eigen::MatrixXi nearestRow;
+    Eigen::MatrixXi nearestCol;
+    const auto signedDistance = signedDistanceFromOccupancy(occupancy, resolution, nearestRow, nearestCol);
+    ASSERT_TRUE(isEqualSdf(signedDistance, signedDistanceFromOccupancy(occupancy, resolution), 1e-4)) << "height: " << height;
+
+    // The closest cell is across the border, at the computed distance.
+    for (int j = 0; j < m; ++j) {
+      for (int i = 0; i < n; ++i) {
+        if (!std::isfinite(signedDistance(i, j))) {
+          ASSERT_EQ(nearestRow(i, j), -1);
+          continue;
+        }
+        const int row = nearestRow(i, j);
+        const int col = nearestCol(i, j);
+        ASSERT_NE(occupancy(i, j), occupancy(row, col));
+        const float distance = resolution * std::sqrt(squarePixelBorderDistance(i, row, 0.0F) + squarePixelBorderDistance(j, col, 0.0F));
+        ASSERT_NEAR(std::abs(signedDistance(i, j)), distance, 1e-4) << "height: " << height;
+      }
+    }
+  }
+}
+
+TEST(testSignedDistance2d, signedDistance2d_layers) {
+  GridMap gridMap({"occupancy"});
+  gridMap.setGeometry(Length(2.0, 3.0), 0.1);
+  gridMap["occupancy"].setZero();
+  gridMap.move(Position(0.35, -0.42));
+  gridMap.atPosition("occupancy", Position(0.5, 0.5)) = 1.0;
+
+  addSignedDistanceLayers(gridMap, "occupancy", 0.5F, "sdf");
+  ASSERT_TRUE(gridMap.exists("sdf"));
+
+  Index obstacleIndex;
+  gridMap.getIndex(Position(0.5, 0.5), obstacleIndex);
+  Position obstacle;
+  gridMap.getPosition(obstacleIndex, obstacle);
+  Position nearest;
+  ASSERT_TRUE(getNearestBorderPosition(gridMap, "sdf", Position(-0.2, -0.7), nearest));
+  EXPECT_NEAR((nearest - obstacle).norm(), 0.0, 1e-6);
+  EXPECT_FALSE(getNearestBorderPosition(gridMap, "sdf", Position(10.0, 0.0), nearest));
+
+  // Inside the obstacle, the closest free cell is a neighbor.
+  ASSERT_TRUE(getNearestBorderPosition(gridMap, "sdf", obstacle, nearest));
+  EXPECT_NEAR((nearest - obstacle).norm(), 0.1, 1e-6);
+  EXPECT_LT(gridMap.atPosition("sdf", obstacle), 0.0);
+}
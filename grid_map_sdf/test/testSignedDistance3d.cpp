@@ -10,6 +10,7 @@
 
 #include "grid_map_sdf/PixelBorderDistance.hpp"
 #include "grid_map_sdf/SignedDistance2d.hpp"
+#include "grid_map_sdf/SignedDistance3d.hpp"
 #include "grid_map_sdf/SignedDistanceField.hpp"
 
 #include "naiveSignedDistance.hpp"
@@ -190,4 +191,78 @@ TEST(testSignedDistance3d, extrapolation) {
       }
     }
   }
-}
\ No newline at end of file
+}
+TEST(testSignedDistance3d, voxelOccupancy) {
+  const Gridmap3dLookup::size_t_3d gridsize{12, 9, 7};
+  const float resolution = 0.1;
+  const Gridmap3dLookup grid(gridsize, Position3(1.0, 2.0, 0.0), resolution);
+
+  std::vector<bool> occupancy(grid.linearSize());
+  for (size_t i = 0; i < occupancy.size(); ++i) {
+    occupancy[i] = (Eigen::internal::random<int>(0, 9) == 0);
+  }
+
+  const auto signedDistance = signedDistanceFromOccupancy3d(occupancy, gridsize, resolution, 1);
+  ASSERT_EQ(signedDistanceFromOccupancy3d(occupancy, gridsize, resolution, 4), signedDistance);
+
+  // Naive: distance to the border of the closest voxel across the occupancy border
+  for (size_t z = 0; z < gridsize.z; ++z) {
+    for (size_t y = 0; y < gridsize.y; ++y) {
+      for (size_t x = 0; x < gridsize.x; ++x) {
+        const bool isOccupied = occupancy[grid.linearIndex({x, y, z})];
+        float naiveSquareDistance = INF;
+        for (size_t k = 0; k < gridsize.z; ++k) {
+          for (size_t j = 0; j < gridsize.y; ++j) {
+            for (size_t i = 0; i < gridsize.x; ++i) {
+              if (occupancy[grid.linearIndex({i, j, k})] != isOccupied) {
+                naiveSquareDistance =
+                    std::min(naiveSquareDistance, squarePixelBorderDistance(x, i, 0.0F) + squarePixelBorderDistance(y, j, 0.0F) +
+                                                      squarePixelBorderDistance(z, k, 0.0F));
+              }
+            }
+          }
+        }
+        const float naiveSignedDistance = (isOccupied ? -resolution : resolution) * std::sqrt(naiveSquareDistance);
+        ASSERT_NEAR(signedDistance[grid.linearIndex({x, y, z})], naiveSignedDistance, 1e-4);
+      }
+    }
+  }
+}
+
+TEST(testSignedDistance3d, voxelOccupancyField) {
+  const float resolution = 0.1;
+  const Gridmap3dLookup grid({20, 20, 20}, Position3(1.0, 1.0, 0.0), resolution);
+
+  // A horizontal plate with free space above and below (an overhang)
+  std::vector<Position3> points;
+  for (double x = 0.3; x < 0.7; x += 0.1) {
+    for (double y = 0.3; y < 0.7; y += 0.1) {
+      points.emplace_back(x, y, 1.0);
+    }
+  }
+  points.emplace_back(10.0, 10.0, 10.0);  // outside, ignored
+  const SignedDistanceField sdf(grid, points, "map");
+  EXPECT_EQ(sdf.getFrameId(), "map");
+  EXPECT_EQ(sdf.size(), grid.linearSize());
+
+  EXPECT_NEAR(sdf.value(Position3(0.5, 0.5, 0.5)), 0.45, 1e-6);
+  EXPECT_NEAR(sdf.value(Position3(0.5, 0.5, 1.5)), 0.45, 1e-6);
+  EXPECT_LT(sdf.value(Position3(0.5, 0.5, 1.0)), 0.0);
+  EXPECT_NEAR(sdf.derivative(Position3(0.5, 0.5, 0.5)).z(), -1.0, 1e-4);
+  EXPECT_NEAR(sdf.derivative(Position3(0.5, 0.5, 1.5)).z(), 1.0, 1e-4);
+
+  // Dense input gives the same field
+  std::vector<bool> occupancy(grid.linearSize(), false);
+  for (const auto& point : points) {
+    if (point.z() < 2.0) {
+      occupancy[grid.linearIndex(grid.nearestNode(point))] = true;
+    }
+  }
+  const SignedDistanceField denseSdf(grid, occupancy, "map");
+  EXPECT_DOUBLE_EQ(denseSdf.value(Position3(0.2, 0.8, 0.3)), sdf.value(Position3(0.2, 0.8, 0.3)));
+
+  // No obstacles
+  const SignedDistanceField emptySdf(grid, std::vector<Position3>(), "map");
+  EXPECT_EQ(emptySdf.value(Position3(0.5, 0.5, 0.5)), INF);
+  EXPECT_TRUE(emptySdf.derivative(Position3(0.5, 0.5, 0.5)).isZero());
+}
@@ -0,0 +1,94 @@
+/*
+ * testSignedDistanceCollisionChecker.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include "grid_map_sdf/SignedDistanceCollisionChecker.hpp"
+
+using namespace grid_map;
+using namespace signed_distance_field;
+
+namespace {
+/** Field of a horizontal plate at z = 1.0 over [0.3, 0.6] x [0.3, 0.6], in a 2m x 2m x 2m grid */
+SignedDistanceField createPlateField() {
+  const Gridmap3dLookup grid({20, 20, 20}, Position3(1.0, 1.0, 0.0), 0.1);
+  std::vector<Position3> points;
+  for (double x = 0.3; x < 0.65; x += 0.1) {
+    for (double y = 0.3; y < 0.65; y += 0.1) {
+      points.emplace_back(x, y, 1.0);
+    }
+  }
+  return SignedDistanceField(grid, points, "map");
+}
+}  // namespace
+
+TEST(testSignedDistanceCollisionChecker, spheresAndCapsules) {
+  const auto sdf = createPlateField();
+  const SignedDistanceCollisionChecker checker(sdf, 4);
+
+  SignedDistanceCollisionChecker::Configuration configuration;
+  configuration.spheres.push_back({Position3(-0.5, -0.5, 0.3), 0.1});
+  configuration.spheres.push_back({Position3(0.45, 0.45, 1.3), 0.1});
+  auto result = checker.check(configuration, false);
+  EXPECT_FALSE(result.isInCollision);
+  EXPECT_EQ(result.bodyIndex, 1);
+  EXPECT_NEAR(result.clearance, sdf.value(Position3(0.45, 0.45, 1.3)) - 0.1, 1e-9);
+  EXPECT_TRUE(checker.check(configuration, false, 0.2).isInCollision);
+
+  // A capsule touching the plate is in collision, the gradient points out of the plate.
+  configuration.capsules.push_back({Position3(0.45, 0.45, 1.5), Position3(0.45, 0.45, 1.08), 0.05});
+  result = checker.check(configuration);
+  EXPECT_TRUE(result.isInCollision);
+  EXPECT_EQ(result.bodyIndex, 2);
+  EXPECT_LT(result.clearance, 0.0);
+  EXPECT_GT(result.gradient.z(), 0.5);
+
+  // No bodies
+  result = checker.check(SignedDistanceCollisionChecker::Configuration());
+  EXPECT_FALSE(result.isInCollision);
+  EXPECT_EQ(result.bodyIndex, -1);
+}
+
+TEST(testSignedDistanceCollisionChecker, closestBody) {
+  const auto sdf = createPlateField();
+  const SignedDistanceCollisionChecker checker(sdf);
+
+  // Random configurations, partly outside of the grid.
+  std::vector<SignedDistanceCollisionChecker::Configuration> configurations(200);
+  for (auto& configuration : configurations) {
+    for (int i = 0; i < 10; ++i) {
+      configuration.spheres.push_back({Position3::Random() * 1.2 + Position3(0.0, 0.0, 1.0), 0.05});
+    }
+    for (int i = 0; i < 3; ++i) {
+      const Position3 start = Position3::Random() + Position3(0.0, 0.0, 1.0);
+      configuration.capsules.push_back({start, start + 0.3 * Position3::Random(), 0.05});
+    }
+  }
+
+  const auto results = checker.check(configurations, false, 0.0, 4);
+  ASSERT_EQ(results.size(), configurations.size());
+  for (size_t c = 0; c < configurations.size(); ++c) {
+    const auto& configuration = configurations[c];
+
+    // Naive: evaluate all bodies.
+    double minClearance = std::numeric_limits<double>::infinity();
+    for (const auto& sphere : configuration.spheres) {
+      minClearance = std::min(minClearance, sdf.value(sphere.center) - sphere.radius);
+    }
+    for (const auto& capsule : configuration.capsules) {
+      const Position3 segment = capsule.end - capsule.start;
+      const int numberOfSteps = static_cast<int>(std::max(std::ceil(segment.norm() / 0.1), 1.0));
+      for (int i = 0; i <= numberOfSteps; ++i) {
+        minClearance = std::min(minClearance, sdf.value(capsule.start + (static_cast<double>(i) / numberOfSteps) * segment) - capsule.radius);
+      }
+    }
+    EXPECT_DOUBLE_EQ(results[c].clearance, minClearance);
+    EXPECT_EQ(results[c].isInCollision, minClearance < 0.0);
+
+    // Early exit finds a collision if there is one.
+    EXPECT_EQ(checker.check(configuration).isInCollision, minClearance < 0.0);
+  }
+}
@@ -64,6 +64,9 @@ class VectorVisualization : public VisualizationBase
   //! Marker to be published.
   visualization_msgs::Marker marker_;
 
+  //! Prefix of the vector layer.
+  std::string layerPrefix_;
+
   //! Types that are transformed to vectors.
   std::vector<std::string> types_;
 
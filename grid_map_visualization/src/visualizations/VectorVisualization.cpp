@@ -14,9 +14,14 @@
 // Iterator
 #include <grid_map_core/iterators/GridMapIterator.hpp>
 
+// Vector layers
+#include <grid_map_core/VectorLayer.hpp>
+
 // ROS
 #include <geometry_msgs/Point.h>
-#include <geometry_msgs/Vector3.h>
+
+// STL
+#include <cmath>
 
 namespace grid_map_visualization {
 
@@ -33,14 +38,11 @@ bool VectorVisualization::readParameters(XmlRpc::XmlRpcValue& config)
 {
   VisualizationBase::readParameters(config);
 
-  std::string typePrefix;
-  if (!getParam("layer_prefix", typePrefix)) {
+  if (!getParam("layer_prefix", layerPrefix_)) {
     ROS_ERROR("VectorVisualization with name '%s' did not find a 'layer_prefix' parameter.", name_.c_str());
     return false;
   }
-  types_.push_back(typePrefix + "x");
-  types_.push_back(typePrefix + "y");
-  types_.push_back(typePrefix + "z");
+  types_ = grid_map::getVectorLayerNames(layerPrefix_, 3);
 
   if (!getParam("position_layer", positionLayer_)) {
     ROS_ERROR("VectorVisualization with name '%s' did not find a 'position_layer' parameter.", name_.c_str());
@@ -97,26 +99,27 @@ bool VectorVisualization::visualize(const grid_map::GridMap& map)
   marker_.points.clear();
   marker_.colors.clear();
 
+  // Look up the layers once, the cells are accessed by linear index.
+  const grid_map::ConstVectorLayer<3> vectors(map, layerPrefix_);
+  const grid_map::Matrix& positionData = map[positionLayer_];
   for (grid_map::GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator)
   {
-    if (!map.isValid(*iterator, positionLayer_) || !map.isValid(*iterator, types_)) continue;
-    geometry_msgs::Vector3 vector;
-    vector.x = map.at(types_[0], *iterator);
-    vector.y = map.at(types_[1], *iterator);
-    vector.z = map.at(types_[2], *iterator);
-
-    Eigen::Vector3d position;
-    map.getPosition3(positionLayer_, *iterator, position);
+    const Eigen::Index i = iterator.getLinearIndex();
+    if (!std::isfinite(positionData(i)) || !vectors.isValid(i)) continue;
+    const Eigen::Vector3f vector = vectors(i);
+
+    grid_map::Position position;
+    map.getPosition(*iterator, position);
     geometry_msgs::Point startPoint;
     startPoint.x = position.x();
     startPoint.y = position.y();
-    startPoint.z = position.z();
+    startPoint.z = positionData(i);
     marker_.points.push_back(startPoint);
 
     geometry_msgs::Point endPoint;
-    endPoint.x = startPoint.x + scale_ * vector.x;
-    endPoint.y = startPoint.y + scale_ * vector.y;
-    endPoint.z = startPoint.z + scale_ * vector.z;
+    endPoint.x = startPoint.x + scale_ * vector.x();
+    endPoint.y = startPoint.y + scale_ * vector.y();
+    endPoint.z = startPoint.z + scale_ * vector.z();
     marker_.points.push_back(endPoint);
 
     marker_.colors.push_back(color_); // Each vertex needs a color.